@@ -58,9 +58,17 @@ add_subdirectory( src/ENDFtk/HeadRecord/test )
 add_subdirectory( src/ENDFtk/InterpolationRecord/test )
 add_subdirectory( src/ENDFtk/InterpolationSequenceRecord/test )
 add_subdirectory( src/ENDFtk/ListRecord/test )
+add_subdirectory( src/ENDFtk/LogSilencer/test )
 add_subdirectory( src/ENDFtk/Material/test )
+add_subdirectory( src/ENDFtk/MemoryUsage/test )
+add_subdirectory( src/ENDFtk/ParseOptions/test )
+add_subdirectory( src/ENDFtk/binary/test )
 add_subdirectory( src/ENDFtk/record/Base/test )
 add_subdirectory( src/ENDFtk/record/InterpolationBase/test )
+add_subdirectory( src/ENDFtk/record/LazyValues/test )
+add_subdirectory( src/ENDFtk/record/RealFormatter/test )
+add_subdirectory( src/ENDFtk/record/RealParser/test )
+add_subdirectory( src/ENDFtk/record/RealValues/test )
 add_subdirectory( src/ENDFtk/record/Sequence/test )
 add_subdirectory( src/ENDFtk/record/Tail/test )
 add_subdirectory( src/ENDFtk/record/Zipper/test )
@@ -275,8 +283,12 @@ add_subdirectory( src/ENDFtk/TabulationRecord/test )
 add_subdirectory( src/ENDFtk/Tape/test )
 add_subdirectory( src/ENDFtk/TapeIdentification/test )
 add_subdirectory( src/ENDFtk/TextRecord/test )
+add_subdirectory( src/ENDFtk/toString/test )
 add_subdirectory( src/ENDFtk/tree/File/test )
+add_subdirectory( src/ENDFtk/tree/MappedFile/test )
 add_subdirectory( src/ENDFtk/tree/Material/test )
+add_subdirectory( src/ENDFtk/tree/MaterialStream/test )
 add_subdirectory( src/ENDFtk/tree/Section/test )
 add_subdirectory( src/ENDFtk/tree/Tape/test )
+add_subdirectory( src/ENDFtk/tree/TapeIndex/test )
 add_subdirectory( src/ENDFtk/tree/test )
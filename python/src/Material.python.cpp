@@ -6,6 +6,7 @@
 // local includes
 #include "views.hpp"
 #include "ENDFtk/Material.hpp"
+#include "ENDFtk/toString.hpp"
 #include "ENDFtk/tree/Material.hpp"
 #include "ENDFtk/tree/toMaterial.hpp"
 
@@ -172,10 +173,8 @@ void wrapMaterial( python::module& module, python::module& viewmodule ) {
     "to_string",
     [] ( const Material& self ) -> std::string {
 
-      std::string buffer;
-      auto output = std::back_inserter( buffer );
-      self.print( output );
-      return buffer;
+      return njoy::ENDFtk::toString( njoy::ENDFtk::printedLines( self ),
+                                     self );
     },
     "The string representation of the material\n\n"
     "Arguments:\n"
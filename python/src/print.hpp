@@ -5,6 +5,7 @@
 #include <string>
 
 // other includes
+#include "ENDFtk/toString.hpp"
 
 /**
  *  @brief Print a component
@@ -26,6 +27,8 @@ std::string print( const Component& component, int mat, int mf, int mt ) {
 /**
  *  @brief Print a section
  *
+ *  The string is allocated once using the number of lines in the section.
+ *
  *  @param[in] section   the ENDF section
  *  @param[in] mat       the material number
  *  @param[in] mf        the file number
@@ -33,25 +36,23 @@ std::string print( const Component& component, int mat, int mf, int mt ) {
 template < typename Section >
 std::string print( const Section& section, int mat, int mf ) {
 
-  std::string buffer;
-  auto output = std::back_inserter( buffer );
-  section.print( output, mat, mf );
-  return buffer;
+  return njoy::ENDFtk::toString( njoy::ENDFtk::printedLines( section ),
+                                 section, mat, mf );
 }
 
 /**
  *  @brief Print a file
  *
+ *  The string is allocated once using the number of lines in the file.
+ *
  *  @param[in] file   the ENDF section
  *  @param[in] mat    the material number
  */
 template < typename File >
 std::string print( const File& file, int mat ) {
 
-  std::string buffer;
-  auto output = std::back_inserter( buffer );
-  file.print( output, mat );
-  return buffer;
+  return njoy::ENDFtk::toString( njoy::ENDFtk::printedLines( file ),
+                                 file, mat );
 }
 
 #endif
@@ -253,5 +253,19 @@ void wrapTreeFile( python::module& module, python::module& viewmodule ) {
     &File::clean,
     "Clean up the file\n\n"
     "This function removes the sequence numbers from the file."
+  )
+  .def(
+
+    "normalise",
+    &File::normalise,
+    python::arg( "renumber" ) = false,
+    "Normalise the file\n\n"
+    "This function rewrites every line in the file: the first 66 columns are\n"
+    "kept (short lines are padded), the MAT, MF and MT columns are corrected,\n"
+    "the sequence numbers are removed or renumbered and line endings are\n"
+    "normalised.\n\n"
+    "Arguments:\n"
+    "    self       the file\n"
+    "    renumber   renumber the lines (default is False)"
   );
 }
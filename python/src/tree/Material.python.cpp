@@ -177,11 +177,36 @@ void wrapTreeMaterial( python::module& module, python::module& viewmodule ) {
   .def(
 
     "parse",
-    [] ( const Material& self ) -> ParsedMaterial {
+    [] ( const Material& self, unsigned int threads ) -> ParsedMaterial {
 
-      return self.parse();
+      return threads == 1 ? self.parse() : self.parallelParse( threads );
     },
-    "Parse the material"
+    python::arg( "threads" ) = 1,
+    "Parse the material\n\n"
+    "Arguments:\n"
+    "    self       the ENDF tree material\n"
+    "    threads    the number of threads used to parse the sections\n"
+    "               (default is 1, 0 uses all available hardware threads)"
+  )
+  .def(
+
+    "parse",
+    [] ( const Material& self,
+         const std::map< int, std::vector< int > >& selection,
+         unsigned int threads ) -> ParsedMaterial {
+
+      return self.parse( selection, threads );
+    },
+    python::arg( "selection" ), python::arg( "threads" ) = 1,
+    "Parse a selection of files and sections of the material\n\n"
+    "The resulting material only contains the selected files and sections\n"
+    "that are present in the material, other sections are not read.\n\n"
+    "Arguments:\n"
+    "    self         the ENDF tree material\n"
+    "    selection    a dictionary of MF numbers and lists of MT numbers\n"
+    "                 (an empty list selects all sections in the file)\n"
+    "    threads      the number of threads used to parse the sections\n"
+    "                 (default is 1, 0 uses all available hardware threads)"
   )
   .def(
 
@@ -357,5 +382,19 @@ void wrapTreeMaterial( python::module& module, python::module& viewmodule ) {
     &Material::clean,
     "Clean up the material\n\n"
     "This function removes the sequence numbers from the material."
+  )
+  .def(
+
+    "normalise",
+    &Material::normalise,
+    python::arg( "renumber" ) = false,
+    "Normalise the material\n\n"
+    "This function rewrites every line in the material: the first 66 columns are\n"
+    "kept (short lines are padded), the MAT, MF and MT columns are corrected,\n"
+    "the sequence numbers are removed or renumbered and line endings are\n"
+    "normalised.\n\n"
+    "Arguments:\n"
+    "    self       the material\n"
+    "    renumber   renumber the lines (default is False)"
   );
 }
@@ -15,10 +15,111 @@ void wrapTreeSection( python::module& module, python::module& ) {
 
   // type aliases
   using Section = njoy::ENDFtk::tree::Section;
-
+  using SectionHeader = njoy::ENDFtk::tree::SectionHeader;
 
   // wrap views created by this component
 
+  // create the header component
+  python::class_< SectionHeader > header(
+
+    module,
+    "SectionHeader",
+    "ENDF tree section header (the first two records of a section)"
+  );
+
+  // wrap the header component
+  header
+  .def_property_readonly(
+
+    "MAT",
+    &SectionHeader::MAT,
+    "The MAT number of the section"
+  )
+  .def_property_readonly(
+
+    "MF",
+    &SectionHeader::MF,
+    "The MF number of the section"
+  )
+  .def_property_readonly(
+
+    "MT",
+    &SectionHeader::MT,
+    "The MT number of the section"
+  )
+  .def_property_readonly(
+
+    "ZA",
+    &SectionHeader::ZA,
+    "The ZA identifier of the section"
+  )
+  .def_property_readonly(
+
+    "AWR",
+    &SectionHeader::AWR,
+    "The atomic weight ratio of the section"
+  )
+  .def_property_readonly(
+
+    "atomic_weight_ratio",
+    &SectionHeader::atomicWeightRatio,
+    "The atomic weight ratio of the section"
+  )
+  .def_property_readonly(
+
+    "has_second_record",
+    &SectionHeader::hasSecondRecord,
+    "Flag to indicate whether or not the section has a second record"
+  )
+  .def_property_readonly(
+
+    "second_record",
+    &SectionHeader::secondRecord,
+    "The second record of the section, decoded as a CONT record"
+  )
+  .def_property_readonly(
+
+    "LRP",
+    &SectionHeader::LRP,
+    "The resonance parameter flag (MF1 MT451 only)"
+  )
+  .def_property_readonly(
+
+    "LFI",
+    &SectionHeader::LFI,
+    "The fission flag (MF1 MT451 only)"
+  )
+  .def_property_readonly(
+
+    "QM",
+    &SectionHeader::QM,
+    "The mass difference Q value (MF3 only)"
+  )
+  .def_property_readonly(
+
+    "QI",
+    &SectionHeader::QI,
+    "The reaction Q value (MF3 only)"
+  )
+  .def_property_readonly(
+
+    "LTT",
+    &SectionHeader::LTT,
+    "The distribution law flag (MF4 only)"
+  )
+  .def_property_readonly(
+
+    "LCT",
+    &SectionHeader::LCT,
+    "The reference frame flag (MF4 and MF6 only)"
+  )
+  .def_property_readonly(
+
+    "NK",
+    &SectionHeader::NK,
+    "The number of subsections (MF5, MF6 and MF26 only)"
+  );
+
   // create the tree component
   python::class_< Section > tree(
 
@@ -179,6 +280,14 @@ void wrapTreeSection( python::module& module, python::module& ) {
     },
     "Parse the section"
   )
+  .def_property_readonly(
+
+    "header",
+    [] ( const Section& self ) { return self.header(); },
+    "The header of the section\n\n"
+    "Only the first two records of the section are read, the section itself\n"
+    "is not parsed."
+  )
   .def_property_readonly(
 
     "content",
@@ -191,11 +300,31 @@ void wrapTreeSection( python::module& module, python::module& ) {
     &Section::NC,
     "The number of lines in this section"
   )
+  .def_property_readonly(
+
+    "hash",
+    &Section::hash,
+    "A hash of the content of the section that ignores sequence numbers"
+  )
   .def(
 
     "clean",
     &Section::clean,
     "Clean up the section\n\n"
     "This function removes the sequence numbers from the section."
+  )
+  .def(
+
+    "normalise",
+    &Section::normalise,
+    python::arg( "renumber" ) = false,
+    "Normalise the section\n\n"
+    "This function rewrites every line in the section: the first 66 columns are\n"
+    "kept (short lines are padded), the MAT, MF and MT columns are corrected,\n"
+    "the sequence numbers are removed or renumbered and line endings are\n"
+    "normalised.\n\n"
+    "Arguments:\n"
+    "    self       the section\n"
+    "    renumber   renumber the lines (default is False)"
   );
 }
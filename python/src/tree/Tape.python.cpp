@@ -6,7 +6,10 @@
 #include "ENDFtk/TapeIdentification.hpp"
 #include "ENDFtk/tree/Tape.hpp"
 #include "ENDFtk/tree/fromFile.hpp"
+#include "ENDFtk/tree/fromMappedFile.hpp"
+#include "ENDFtk/tree/fromIndexedFile.hpp"
 #include "ENDFtk/tree/updateDirectory.hpp"
+#include "ENDFtk/tree/diff.hpp"
 #include "range/v3/range/operations.hpp"
 #include "views.hpp"
 
@@ -18,6 +21,7 @@ void wrapTreeTape( python::module& module, python::module& viewmodule ) {
   // type aliases
   using TapeIdentification = njoy::ENDFtk::TapeIdentification;
   using Tape = njoy::ENDFtk::tree::Tape;
+  using Difference = njoy::ENDFtk::tree::Difference;
   using ParsedMaterial = njoy::ENDFtk::Material;
   using Material = njoy::ENDFtk::tree::Material;
   using MaterialRange = BidirectionalAnyView< Material >;
@@ -29,6 +33,55 @@ void wrapTreeTape( python::module& module, python::module& viewmodule ) {
       "any_view< tree::Material, bidirectional >" );
 
 
+  // create the difference component
+  python::class_< Difference > difference(
+
+    module,
+    "Difference",
+    "A section that was added, removed or changed between two ENDF trees"
+  );
+
+  // wrap the difference component
+  difference
+  .def_property_readonly(
+
+    "MAT",
+    &Difference::MAT,
+    "The MAT number of the section"
+  )
+  .def_property_readonly(
+
+    "MF",
+    &Difference::MF,
+    "The MF number of the section"
+  )
+  .def_property_readonly(
+
+    "MT",
+    &Difference::MT,
+    "The MT number of the section"
+  )
+  .def_property_readonly(
+
+    "is_added",
+    &Difference::isAdded,
+    "Flag to indicate whether or not the section is only present in the\n"
+    "candidate"
+  )
+  .def_property_readonly(
+
+    "is_removed",
+    &Difference::isRemoved,
+    "Flag to indicate whether or not the section is only present in the\n"
+    "reference"
+  )
+  .def_property_readonly(
+
+    "is_changed",
+    &Difference::isChanged,
+    "Flag to indicate whether or not the content of the section differs"
+  );
+
   // predefined lambda
   auto getMaterial = [] ( Tape& self, int mat )
   -> std::variant< std::reference_wrapper< Material >, MaterialRange > {
@@ -172,16 +225,58 @@ void wrapTreeTape( python::module& module, python::module& viewmodule ) {
   .def_static(
 
     "from_file",
-    [] ( const std::string& filename ) -> Tape {
+    [] ( const std::string& filename, unsigned int threads ) -> Tape {
 
-      return njoy::ENDFtk::tree::fromFile( filename );
+      return njoy::ENDFtk::tree::fromFile( filename, threads );
     },
-    python::arg( "filename" ),
+    python::arg( "filename" ), python::arg( "threads" ) = 1,
     "Read a tape from a file\n\n"
     "An exception is raised if something goes wrong while reading the\n"
     "tape\n\n"
     "Arguments:\n"
-    "    filename    the file name and path"
+    "    filename    the file name and path\n"
+    "    threads     the number of threads used to index the materials\n"
+    "                (default is 1, 0 uses all available hardware threads)"
+  )
+  .def_static(
+
+    "from_mapped_file",
+    [] ( const std::string& filename, unsigned int threads ) -> Tape {
+
+      return njoy::ENDFtk::tree::fromMappedFile( filename, threads );
+    },
+    python::arg( "filename" ), python::arg( "threads" ) = 1,
+    "Read a tape from a memory mapped file\n\n"
+    "The sections in the tape refer to the memory mapped file instead of\n"
+    "holding a copy of their content, until they are modified. An exception\n"
+    "is raised if something goes wrong while reading the tape\n\n"
+    "Arguments:\n"
+    "    filename    the file name and path\n"
+    "    threads     the number of threads used to index the materials\n"
+    "                (default is 1, 0 uses all available hardware threads)"
+  )
+  .def_static(
+
+    "from_indexed_file",
+    [] ( const std::string& filename, unsigned int threads,
+         bool update ) -> Tape {
+
+      return njoy::ENDFtk::tree::fromIndexedFile( filename, threads, update );
+    },
+    python::arg( "filename" ), python::arg( "threads" ) = 1,
+    python::arg( "update" ) = true,
+    "Read a tape from a memory mapped file using its index file\n\n"
+    "The index is read from the file with the .idx extension appended to\n"
+    "the file name. When the index is missing or no longer valid for the\n"
+    "file, the file is indexed as usual and the index file is written if\n"
+    "requested. An exception is raised if something goes wrong while\n"
+    "reading the tape\n\n"
+    "Arguments:\n"
+    "    filename    the file name and path\n"
+    "    threads     the number of threads used to index the materials\n"
+    "                (default is 1, 0 uses all available hardware threads)\n"
+    "    update      write the index file if it is missing or not valid\n"
+    "                (default is True)"
   )
   .def(
 
@@ -189,7 +284,7 @@ void wrapTreeTape( python::module& module, python::module& viewmodule ) {
     [] ( const Tape& self, const std::string& filename ) {
 
       std::ofstream out( filename );
-      out << self.content();
+      self.write( out );
       out.close();
     },
     python::arg( "filename" ),
@@ -263,15 +358,31 @@ void wrapTreeTape( python::module& module, python::module& viewmodule ) {
   .def(
 
     "update_directory",
-    [] ( Tape& self, bool copy_mod = false )
-       { njoy::ENDFtk::tree::updateDirectory( self, copy_mod ); },
-    python::arg( "copy_mod" ) = false,
+    [] ( Tape& self, bool copy_mod, unsigned int threads )
+       { njoy::ENDFtk::tree::updateDirectory( self, copy_mod, threads ); },
+    python::arg( "copy_mod" ) = false, python::arg( "threads" ) = 1,
     "Update the MF1 MT451 directory for all materials in the tape\n\n"
     "An exception will be thrown if a material in the tape has no MF1 MT451\n"
-    "section is not present, or if there was an issue parsing it.\n\n"
+    "section, or if there was an issue parsing it.\n\n"
     "Arguments:\n"
     "    self        the tape\n"
     "    copy_mod    copy mod numbers if available (default is False)\n"
+    "    threads     the number of threads used to update the materials\n"
+    "                (default is 1, 0 uses all available hardware threads)"
+  )
+  .def(
+
+    "diff",
+    [] ( const Tape& self, const Tape& candidate )
+       { return njoy::ENDFtk::tree::diff( self, candidate ); },
+    python::arg( "candidate" ),
+    "Compare the sections in this tape with those in a candidate tape\n\n"
+    "Sections are matched using their MAT, MF and MT numbers and compared\n"
+    "using a hash of their content that ignores sequence numbers. No section\n"
+    "is parsed.\n\n"
+    "Arguments:\n"
+    "    self        the reference tape\n"
+    "    candidate   the candidate tape"
   )
   .def(
 
@@ -279,5 +390,22 @@ void wrapTreeTape( python::module& module, python::module& viewmodule ) {
     &Tape::clean,
     "Clean up the tape\n\n"
     "This function removes the sequence numbers from the tape."
+  )
+  .def(
+
+    "normalise",
+    &Tape::normalise,
+    python::arg( "renumber" ) = false, python::arg( "threads" ) = 1,
+    "Normalise the tape\n\n"
+    "This function rewrites every line in the tape: the first 66 columns are\n"
+    "kept (short lines are padded), the MAT, MF and MT columns are corrected,\n"
+    "the sequence numbers are removed or renumbered and line endings are\n"
+    "normalised. The materials are normalised concurrently when more than one\n"
+    "thread is requested.\n\n"
+    "Arguments:\n"
+    "    self       the tape\n"
+    "    renumber   renumber the lines (default is False)\n"
+    "    threads    the number of threads to be used (default is 1, 0 uses\n"
+    "               all available hardware threads)"
   );
 }
@@ -274,6 +274,18 @@ class Test_ENDFtk_Tree_Tape( unittest.TestCase ) :
         # verify the tape's content
         verify_chunk( self, tape )
 
+        # the data is read from a memory mapped file
+        tape = Tape.from_mapped_file( filename )
+
+        # verify the tape's content
+        verify_chunk( self, tape )
+
+        # the data is read from a memory mapped file without an index file
+        tape = Tape.from_indexed_file( filename, update = False )
+
+        # verify the tape's content
+        verify_chunk( self, tape )
+
         # the data is copied
         copy = Tape( tape )
 
@@ -373,6 +385,115 @@ class Test_ENDFtk_Tree_Tape( unittest.TestCase ) :
         self.assertEqual( 1, len( section.boundaries ) )
         self.assertEqual( 1, len( section.interpolants ) )
 
+    def test_parallel_parse( self ) :
+
+        tape = Tape.from_file( 'test/resources/n-001_H_001.endf' )
+        material = tape.materials.front()
+
+        serial = material.parse()
+        parallel = material.parse( threads = 2 )
+
+        self.assertEqual( serial.MAT, parallel.MAT )
+        self.assertEqual( len( serial.MFs ), len( parallel.MFs ) )
+
+        serial = serial.file( 3 ).section( 102 )
+        parallel = parallel.file( 3 ).section( 102 )
+        self.assertEqual( serial.energies[:], parallel.energies[:] )
+        self.assertEqual( serial.cross_sections[:], parallel.cross_sections[:] )
+
+    def test_selective_parse( self ) :
+
+        tape = Tape.from_file( 'test/resources/n-001_H_001.endf' )
+        material = tape.materials.front()
+
+        parsed = material.parse( { 1 : [ 451 ], 3 : [ 1, 102 ], 6 : [] } )
+
+        self.assertEqual( 125, parsed.MAT )
+        self.assertEqual( 3, len( parsed.MFs ) )
+        self.assertEqual( True, parsed.has_MF_MT( 1, 451 ) )
+        self.assertEqual( True, parsed.has_MF_MT( 3, 1 ) )
+        self.assertEqual( True, parsed.has_MF_MT( 3, 102 ) )
+        self.assertEqual( False, parsed.has_MF_MT( 3, 2 ) )
+        self.assertEqual( True, parsed.has_MF_MT( 6, 102 ) )
+        self.assertEqual( False, parsed.has_file( 2 ) )
+        self.assertEqual( False, parsed.has_file( 33 ) )
+
+    def test_section_header( self ) :
+
+        tape = Tape.from_file( 'test/resources/n-001_H_001.endf' )
+        material = tape.materials.front()
+
+        header = material.section( 1, 451 ).header
+        self.assertEqual( 125, header.MAT )
+        self.assertEqual( 1, header.MF )
+        self.assertEqual( 451, header.MT )
+        self.assertEqual( 1001, header.ZA )
+        self.assertAlmostEqual( 0.9991673, header.AWR )
+        self.assertEqual( 0, header.LRP )
+        self.assertEqual( 0, header.LFI )
+
+        header = material.section( 3, 102 ).header
+        self.assertEqual( True, header.has_second_record )
+        self.assertAlmostEqual( 2.224631e+6, header.QM )
+        self.assertAlmostEqual( 2.224631e+6, header.QI )
+        self.assertEqual( 96, header.second_record.N2 )
+
+        header = material.section( 4, 2 ).header
+        self.assertEqual( 1, header.LTT )
+        self.assertEqual( 2, header.LCT )
+
+        header = material.section( 6, 102 ).header
+        self.assertEqual( 2, header.LCT )
+        self.assertEqual( 2, header.NK )
+
+        with self.assertRaises( Exception ) : header.QM
+
+    def test_normalise( self ) :
+
+        tape = Tape.from_file( 'test/resources/n-001_H_001.endf' )
+
+        tape.normalise( renumber = True, threads = 2 )
+        section = tape.materials.front().section( 3, 102 )
+        self.assertEqual( '    1\n', section.content[75:81] )
+        self.assertEqual( '99999\n', section.content[-6:] )
+
+        tape.normalise()
+        section = tape.materials.front().section( 3, 102 )
+        self.assertEqual( '     \n', section.content[75:81] )
+        self.assertEqual( '     \n', section.content[-6:] )
+
+    def test_copy( self ) :
+
+        tape = Tape.from_file( 'test/resources/n-001_H_001.endf' )
+        copy = Tape( tape )
+
+        # modifying the copy does not modify the original
+        original = tape.materials.front().section( 3, 102 ).content
+        copy.materials.front().section( 3, 102 ).normalise( renumber = True )
+        self.assertEqual( '99999\n', copy.materials.front().section( 3, 102 ).content[-6:] )
+        self.assertEqual( original, tape.materials.front().section( 3, 102 ).content )
+
+    def test_diff( self ) :
+
+        reference = Tape.from_file( 'test/resources/n-001_H_001.endf' )
+        candidate = Tape.from_file( 'test/resources/n-001_H_001.endf' )
+
+        self.assertEqual( 0, len( reference.diff( candidate ) ) )
+
+        section = reference.materials.front().section( 3, 102 )
+        self.assertEqual( section.hash,
+                          candidate.materials.front().section( 3, 102 ).hash )
+
+        candidate.materials.front().remove( 3, 102 )
+        differences = reference.diff( candidate )
+        self.assertEqual( 1, len( differences ) )
+        self.assertEqual( 125, differences[0].MAT )
+        self.assertEqual( 3, differences[0].MF )
+        self.assertEqual( 102, differences[0].MT )
+        self.assertEqual( True, differences[0].is_removed )
+        self.assertEqual( False, differences[0].is_added )
+        self.assertEqual( False, differences[0].is_changed )
+
     def test_failures( self ) :
 
         print( '\n' )
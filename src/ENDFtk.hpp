@@ -66,6 +66,14 @@
 #include "ENDFtk/Material.hpp"
 #include "ENDFtk/Tape.hpp"
 
+// include memory usage accounting
+#include "ENDFtk/MemoryUsage.hpp"
+#include "ENDFtk/ParseOptions.hpp"
+#include "ENDFtk/ParseError.hpp"
+#include "ENDFtk/ParseResult.hpp"
+#include "ENDFtk/memoryUsage.hpp"
+#include "ENDFtk/toString.hpp"
+
 // include the ENDF tree and its components
 #include "ENDFtk/tree/Section.hpp"
 #include "ENDFtk/tree/File.hpp"
@@ -76,3 +84,7 @@
 #include "ENDFtk/tree/toFile.hpp"
 #include "ENDFtk/tree/toMaterial.hpp"
 #include "ENDFtk/tree/updateDirectory.hpp"
+#include "ENDFtk/tree/diff.hpp"
+
+// include the binary cache
+#include "ENDFtk/binary.hpp"
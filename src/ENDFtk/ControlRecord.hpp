@@ -4,6 +4,8 @@
 // system includes
 
 // other includes
+#include "ENDFtk/MemoryUsage.hpp"
+#include "ENDFtk/ParseError.hpp"
 #include "ENDFtk/record.hpp"
 
 namespace njoy {
@@ -75,9 +77,11 @@ namespace ENDFtk {
       try: base( it, end ){
         tail( MAT, MF, MT, it, end, lineNumber );
       } catch ( std::exception& e ) {
+        ParseError::Context::report( "CONT" );
         /* TODO error information here */
         throw e;
       } catch ( int fieldNo ){
+        ParseError::Context::report( "CONT", fieldNo );
         --lineNumber;
         /* TODO error information here */
         throw std::exception();
@@ -123,6 +127,12 @@ namespace ENDFtk {
      */
     static constexpr long NC() { return 1; }
 
+    /**
+     *  @brief Return the memory owned by the record (the values are stored
+     *         in the record itself)
+     */
+    MemoryUsage memoryUsage() const { return MemoryUsage(); }
+
     #include "ENDFtk/ControlRecord/src/print.hpp"
   };
 
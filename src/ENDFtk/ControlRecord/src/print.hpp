@@ -10,7 +10,7 @@
  */
 template< typename OutputIterator >
 void print( OutputIterator& it, int MAT, int MF, int MT ) const {
-  using Format = disco::Record< disco::ENDF, disco::ENDF,
+  using Format = disco::Record< record::RealFormatter, record::RealFormatter,
                                 disco::Integer< 11 >, disco::Integer< 11 >,
                                 disco::Integer< 11 >, disco::Integer< 11 >,
                                 disco::Integer< 4 >, disco::Integer< 2>,
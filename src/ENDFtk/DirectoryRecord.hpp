@@ -4,6 +4,8 @@
 // system includes
 
 // other includes
+#include "ENDFtk/MemoryUsage.hpp"
+#include "ENDFtk/ParseError.hpp"
 #include "ENDFtk/record.hpp"
 
 namespace njoy {
@@ -74,10 +76,12 @@ namespace ENDFtk {
       }
       catch ( std::exception& e ) {
 
+        ParseError::Context::report( "DIR" );
         throw e;
       }
       catch ( int fieldNo ) {
 
+        ParseError::Context::report( "DIR", fieldNo );
         --lineNumber;
         throw std::exception();
       }
@@ -113,6 +117,12 @@ namespace ENDFtk {
       return not( *this == rhs );
     }
 
+    /**
+     *  @brief Return the memory owned by the record (the values are stored
+     *         in the record itself)
+     */
+    MemoryUsage memoryUsage() const { return MemoryUsage(); }
+
     #include "ENDFtk/DirectoryRecord/src/print.hpp"
   };
 
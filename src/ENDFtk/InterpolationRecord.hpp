@@ -4,7 +4,8 @@
 // system includes
 
 // other includes
-#include "tools/Log.hpp"
+#include "ENDFtk/Log.hpp"
+#include "ENDFtk/ParseError.hpp"
 #include "ENDFtk/record.hpp"
 
 namespace njoy {
@@ -63,6 +64,7 @@ namespace ENDFtk {
     }
 
     using record::InterpolationBase::NC;
+    using record::InterpolationBase::memoryUsage;
     using record::InterpolationBase::print;
   };
 
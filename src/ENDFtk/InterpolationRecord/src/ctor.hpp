@@ -62,6 +62,7 @@ InterpolationRecord
   try :
     InterpolationBase( it, end, lineNumber, MAT, MF, MT ) {}
   catch ( IllegalN2& e ) {
+    ParseError::Context::report( "TAB2", 5 );
     Log::error( "Illegal NZ value encountered" );
     Log::info( "NZ (or number of zones) must be greater than or equal to 1" );
     Log::info( "NZ value: {}", e.n2 );
@@ -69,17 +70,20 @@ InterpolationRecord
     throw std::exception();
   }
   catch ( InconsistentN2& e ) {
+    ParseError::Context::report( "TAB2", 5 );
     Log::error( "Inconsistent value for NZ" );
     Log::info( "Expected {} as the largest index but found {}", e.n2, e.index );
     Log::info( "Error encountered while parsing TAB2 record" );
     throw std::exception();
   }
   catch ( int nPosition ){
+    ParseError::Context::report( "TAB2", nPosition );
     Log::info( "Error in position {}", nPosition );
     Log::info( "Error encountered while parsing TAB2 record" );
     throw std::exception();
   }
   catch ( std::exception& e ) {
+    ParseError::Context::report( "TAB2" );
     Log::info( "Error encountered while parsing TAB2 record" );
     throw e;
   }
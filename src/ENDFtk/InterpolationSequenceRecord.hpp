@@ -7,8 +7,9 @@
 
 // other includes
 #include "range/v3/view/all.hpp"
-#include "tools/Log.hpp"
+#include "ENDFtk/Log.hpp"
 #include "ENDFtk/InterpolationRecord.hpp"
+#include "ENDFtk/MemoryUsage.hpp"
 #include "ENDFtk/readSequence.hpp"
 
 namespace njoy {
@@ -133,6 +134,15 @@ namespace ENDFtk {
     }
 
     #include "ENDFtk/InterpolationSequenceRecord/src/NC.hpp"
+
+    /**
+     *  @brief Return the memory owned by the TAB2 record and the sequence
+     */
+    MemoryUsage memoryUsage() const {
+
+      return MemoryUsage::of( this->interpolation_, this->sequence_ );
+    }
+
     #include "ENDFtk/InterpolationSequenceRecord/src/print.hpp"
   };
 
@@ -2,11 +2,21 @@
 #define NJOY_ENDFTK_LISTRECORD
 
 // system includes
+#include <array>
+#include <memory_resource>
+#include <vector>
 
 // other includes
-#include "tools/Log.hpp"
+#include "ENDFtk/Log.hpp"
+#include "range/v3/algorithm/equal.hpp"
 #include "range/v3/view/all.hpp"
+#include "ENDFtk/MemoryUsage.hpp"
+#include "ENDFtk/ParseError.hpp"
+#include "ENDFtk/ParseOptions.hpp"
 #include "ENDFtk/record.hpp"
+#include "ENDFtk/record/LazyValues.hpp"
+#include "ENDFtk/record/RealValues.hpp"
+#include "ENDFtk/record/StoredValues.hpp"
 
 namespace njoy {
 namespace ENDFtk {
@@ -28,9 +38,13 @@ namespace ENDFtk {
                                record::Integer< 11 >, record::Integer< 11 > >;
 
     using tail = record::TailVerifying< record::MAT, record::MF, record::MT >;
+    using Lazy = record::LazyValues< record::Real >;
 
     Base metadata;
-    std::vector< double > data;
+    record::StoredValues< double > data;
+    std::pmr::vector< float > floats;
+    Lazy lazy;
+    bool lossyOutput = false;
 
     /* auxiliary functions */
     template< typename Iterator >
@@ -41,6 +55,21 @@ namespace ENDFtk {
     }
     #include "ENDFtk/ListRecord/src/readMetadata.hpp"
 
+    /**
+     *  @brief Return the values stored in double precision, decoding them if
+     *         required
+     */
+    record::RealValues values() const {
+
+      return this->lazy
+             ? record::RealValues( std::get< 0 >( this->lazy.values() ) )
+             : record::RealValues( this->data );
+    }
+
+  protected:
+
+    #include "ENDFtk/ListRecord/src/columns.hpp"
+
   public:
 
     /* constructors */
@@ -48,6 +77,8 @@ namespace ENDFtk {
     /**
      *  @brief Constructor
      *
+     *  The vector holding the values is moved into the record.
+     *
      *  @param[in] C1     the double in column 1 on line 1
      *  @param[in] C2     the double in column 2 on line 1
      *  @param[in] L1     the integer in column 3 on line 1
@@ -57,7 +88,27 @@ namespace ENDFtk {
      */
     ListRecord( double C1, double C2, long L1, long L2, long N2,
                 std::vector< double >&& list ) :
-      metadata( C1, C2, L1, L2, list.size(), N2 ), data( std::move(list) ){}
+      metadata( C1, C2, L1, L2, list.size(), N2 ),
+      data( std::move( list ) ){}
+
+    /**
+     *  @brief Constructor (values in a std::pmr::vector)
+     *
+     *  The vector holding the values is moved into the record, so that the
+     *  values remain allocated by its memory resource.
+     *
+     *  @param[in] C1     the double in column 1 on line 1
+     *  @param[in] C2     the double in column 2 on line 1
+     *  @param[in] L1     the integer in column 3 on line 1
+     *  @param[in] L2     the integer in column 4 on line 1
+     *  @param[in] N2     the integer in column 6 on line 1
+     *  @param[in] list   the list of values
+     */
+    template< typename Allocator >
+    ListRecord( double C1, double C2, long L1, long L2, long N2,
+                std::vector< double, Allocator >&& list ) :
+      metadata( C1, C2, L1, L2, list.size(), N2 ),
+      data( std::move( list ) ){}
 
 //! @todo pybind11 variant needs default constructor workaround
 #ifdef PYBIND11
@@ -70,6 +121,12 @@ namespace ENDFtk {
     /**
      *  @brief Constructor (from a buffer)
      *
+     *  When lazy decoding is requested in the active parse options, the values
+     *  are only decoded when they are accessed. When single precision storage
+     *  is requested, the values are stored as floats (see list() and
+     *  singlePrecisionList()) and whether or not these may be printed is
+     *  taken from the lossyOutput flag of the active parse options.
+     *
      *  @tparam Iterator        a buffer iterator
      *
      *  @param[in] it           the current position in the buffer
@@ -83,13 +140,26 @@ namespace ENDFtk {
     ListRecord( Iterator& it, const Iterator& end, long& lineNumber,
                 int MAT, int MF, int MT )
       try: metadata( readMetadata( it, end, lineNumber, MAT, MF, MT ) ),
-           data( record::Sequence::read< record::Real >
-                  ( std::get<4>( this->metadata.fields ),
-                    it, end, lineNumber, MAT, MF, MT ) ){
+           data( Lazy::enabled< Iterator >()
+                 ? std::pmr::vector< double >()
+                 : record::Sequence::read< record::Real >
+                     ( ParseOptions::activeMemoryResource(),
+                       std::get<4>( this->metadata.fields ),
+                       it, end, lineNumber, MAT, MF, MT ) ),
+           floats( ParseOptions::active().singlePrecision
+                   ? record::narrow( this->data )
+                   : std::pmr::vector< float >() ),
+           lazy( Lazy::enabled< Iterator >()
+                 ? Lazy( std::get<4>( this->metadata.fields ),
+                         it, end, lineNumber, MAT, MF, MT )
+                 : Lazy() ),
+           lossyOutput( ParseOptions::active().lossyOutput ){
       } catch ( std::exception& e ){
+        ParseError::Context::report( "LIST" );
         Log::info( "Error encountered while parsing List record" );
         throw e;
       } catch ( int nPosition ){
+        ParseError::Context::report( "LIST", nPosition );
         Log::info( "Error in position {}" );
         throw std::exception();
       }
@@ -111,14 +181,18 @@ namespace ENDFtk {
     /**
      *  @brief Return the number of values in the list
      */
-    long NPL() const { return this->data.size(); }
+    long NPL() const { return std::get< 4 >( this->metadata.fields ); }
 
     /**
      *  @brief Return the list of values
+     *
+     *  Values stored in single precision are widened into an array owned by
+     *  the returned range, they are not retained by the record.
      */
-    auto list() const {
+    record::RealValues list() const {
 
-      return ranges::cpp20::views::all( this->data );
+      return this->isSinglePrecision() ? record::RealValues( this->floats )
+                                       : this->values();
     }
 
     /**
@@ -126,6 +200,32 @@ namespace ENDFtk {
      */
     auto B() const { return this->list(); }
 
+    /**
+     *  @brief Return whether or not the values are stored in single precision
+     */
+    bool isSinglePrecision() const { return not this->floats.empty(); }
+
+    /**
+     *  @brief Return the list of values stored in single precision
+     *
+     *  This range is empty unless the values are stored in single precision.
+     */
+    auto singlePrecisionList() const {
+
+      return ranges::cpp20::views::all( this->floats );
+    }
+
+    /**
+     *  @brief Return the memory used by the values, as they are stored
+     */
+    MemoryUsage memoryUsage() const {
+
+      MemoryUsage usage = this->lazy.memoryUsage();
+      usage.add( this->data );
+      usage.add( this->floats );
+      return usage;
+    }
+
     /**
      *  @brief Equality operator
      *
@@ -138,7 +238,7 @@ namespace ENDFtk {
         and ( this->L1() == rhs.L1() )
         and ( this->L2() == rhs.L2() )
         and ( this->N2() == rhs.N2() )
-        and ( this->data  == rhs.data );
+        and ranges::equal( this->list(), rhs.list() );
     }
 
     /**
@@ -0,0 +1,32 @@
+/**
+ *  @brief Return the list of values de-interleaved into contiguous columns
+ *
+ *  The list is interpreted as a sequence of groups of N values, the values
+ *  at the same position in each group are copied into the same column. The
+ *  list is traversed only once. Values at the end of the list that do not
+ *  form a complete group are ignored.
+ *
+ *  @tparam N   the number of values in a group (and the number of columns)
+ */
+template< std::size_t N >
+std::array< std::vector< double >, N > columns() const {
+
+  const auto entries = this->list();
+  const std::size_t size = entries.size() / N;
+
+  std::array< std::vector< double >, N > result;
+  for ( auto& column : result ) {
+
+    column.resize( size );
+  }
+
+  auto entry = entries.begin();
+  for ( std::size_t i = 0; i < size; ++i ) {
+
+    for ( std::size_t j = 0; j < N; ++j, ++entry ) {
+
+      result[j][i] = *entry;
+    }
+  }
+  return result;
+}
@@ -1,6 +1,9 @@
 /**
  *  @brief Print the record
  *
+ *  Values stored in single precision are only printed when lossy output was
+ *  allowed in the parse options that were active when the record was read.
+ *
  *  @tparam OutputIterator   an output iterator
  *
  *  @param[in] it            the current position in the output
@@ -10,8 +13,11 @@
  */
 template< typename OutputIterator >
 void print( OutputIterator& it, int MAT, int MF, int MT ) const {
+  if ( this->isSinglePrecision() ){
+    record::verifyLossyOutput( this->lossyOutput );
+  }
   {
-    using Format = disco::Record< disco::ENDF, disco::ENDF,
+    using Format = disco::Record< record::RealFormatter, record::RealFormatter,
                                   disco::Integer< 11 >, disco::Integer< 11 >,
                                   disco::Integer< 11 >, disco::Integer< 11 >,
                                   disco::Integer< 4 >, disco::Integer< 2 >,
@@ -22,18 +28,31 @@ void print( OutputIterator& it, int MAT, int MF, int MT ) const {
                    this->NPL(), this->N2(),
                    MAT, MF, MT );
   }{
-    using Format = disco::Record< disco::ENDF, disco::ENDF,
-                                  disco::ENDF, disco::ENDF,
-                                  disco::ENDF, disco::ENDF,
+    using Format = disco::Record< record::RealFormatter, record::RealFormatter,
+                                  record::RealFormatter, record::RealFormatter,
+                                  record::RealFormatter, record::RealFormatter,
                                   disco::Integer< 4 >, disco::Integer< 2 >,
                                   disco::Integer< 3 >, disco::ColumnPosition<5> >;
 
     auto nFullLines = this->NPL() / 6;
     auto partialLineEntries = this->NPL() - nFullLines * 6;
 
-    auto entry = this->list().begin();
+    const auto entries = this->list();
+    auto entry = entries.begin();
+
+    // full lines are formatted in a line buffer, the tail is only formatted once
+    char line[ 81 ];
+    if ( record::Tail( MAT, MF, MT ).format( line + 66 ) ){
+      for ( ; nFullLines > 0; --nFullLines, entry += 6 ){
+        char* position = line;
+        for ( int index = 0; index < 6; ++index ){
+          position = record::RealFormatter::write( entry[index], position );
+        }
+        it = std::copy( line, line + 81, it );
+      }
+    }
 
-    for ( ; nFullLines-- != 0; entry += 6 ){
+    for ( ; nFullLines > 0; --nFullLines, entry += 6 ){
       Format::write( it,
                      entry[0], entry[1], entry[2],
                      entry[3], entry[4], entry[5],
@@ -42,8 +61,8 @@ void print( OutputIterator& it, int MAT, int MF, int MT ) const {
 
     if ( partialLineEntries ){
       do {
-        disco::ENDF::write( *entry, it );
-      } while( ++entry != this->list().end() );
+        record::RealFormatter::write( *entry, it );
+      } while( ++entry != entries.end() );
 
       auto blankEntries = 6 - partialLineEntries;
 
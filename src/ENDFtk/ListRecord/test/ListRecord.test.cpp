@@ -7,6 +7,7 @@ using Catch::Matchers::WithinRel;
 #include "ENDFtk/ListRecord.hpp"
 
 // other includes
+#include <memory_resource>
 
 // convenience typedefs
 using namespace njoy::ENDFtk;
@@ -48,6 +49,36 @@ SCENARIO( "ListRecord" ) {
       } // THEN
     } // WHEN
 
+    WHEN( "the data is given explicitly in a std::vector or std::pmr::vector" ) {
+
+      std::pmr::monotonic_buffer_resource resource;
+      std::vector< double > list = { 1.0, 2.0, 3.0, 4.0, 5.0,
+                                     6.0, 7.0, 8.0, 9.0, 10.0 };
+      std::pmr::vector< double > pmr( list.begin(), list.end(), &resource );
+      const double* values = list.data();
+      const double* pmrValues = pmr.data();
+
+      ListRecord chunk( 1., 2., 3, 4, 5, std::move( list ) );
+      ListRecord pmrChunk( 1., 2., 3, 4, 5, std::move( pmr ) );
+
+      THEN( "the values are moved into the record without a copy" ) {
+
+        verifyChunk( chunk );
+        verifyChunk( pmrChunk );
+        CHECK( values == chunk.list().begin() );
+        CHECK( pmrValues == pmrChunk.list().begin() );
+      } // THEN
+
+      THEN( "it can be printed" ) {
+
+        std::string buffer;
+        auto output = std::back_inserter( buffer );
+        pmrChunk.print( output, 125, 3, 102 );
+
+        CHECK( buffer == string );
+      } // THEN
+    } // WHEN
+
     WHEN( "the data is read from a string/stream" ) {
 
       auto begin = string.begin();
@@ -70,6 +101,106 @@ SCENARIO( "ListRecord" ) {
         CHECK( buffer == string );
       } // THEN
     } // WHEN
+
+    WHEN( "the data is read from a string/stream using lazy decoding" ) {
+
+      auto begin = string.begin();
+      auto end = string.end();
+      long lineNumber = 1;
+
+      ParseOptions options;
+      options.lazy = true;
+      ListRecord chunk = [&] {
+
+        ParseOptions::Scope scope( options );
+        return ListRecord( begin, end, lineNumber, 125, 3, 102 );
+      }();
+
+      THEN( "the lines are consumed and members can be tested" ) {
+
+        CHECK( end == begin );
+        CHECK( 4 == lineNumber );
+        verifyChunk( chunk );
+      } // THEN
+
+      THEN( "it can be printed" ) {
+
+        std::string buffer;
+        auto output = std::back_inserter( buffer );
+        chunk.print( output, 125, 3, 102 );
+
+        CHECK( buffer == string );
+      } // THEN
+    } // WHEN
+
+    WHEN( "the data is read from a string/stream using single precision "
+          "storage" ) {
+
+      auto begin = string.begin();
+      auto end = string.end();
+      long lineNumber = 1;
+
+      PrecisionReport report;
+      ParseOptions options;
+      options.singlePrecision = true;
+      options.precisionReport = &report;
+      ListRecord chunk = [&] {
+
+        ParseOptions::Scope scope( options );
+        return ListRecord( begin, end, lineNumber, 125, 3, 102 );
+      }();
+
+      THEN( "the values are narrowed and members can be tested" ) {
+
+        CHECK( end == begin );
+        CHECK( 4 == lineNumber );
+        CHECK( true == chunk.isSinglePrecision() );
+        CHECK( 10 == report.values );
+        CHECK( 0 == report.overflows );
+        CHECK( 0 == report.inexact );
+        CHECK( 10 * 4 == report.savedMemory() );
+        CHECK( 0. == report.maxRelativeError );
+        CHECK( 10 == chunk.singlePrecisionList().size() );
+        verifyChunk( chunk );
+      } // THEN
+
+      THEN( "the double precision values are not retained after access" ) {
+
+        CHECK( 10 == chunk.list().size() );
+        CHECK( 10 == chunk.B().size() );
+        CHECK( 10 * 4 == chunk.memoryUsage().doubles );
+      } // THEN
+
+      THEN( "it can only be printed when lossy output was allowed when it "
+            "was read" ) {
+
+        std::string buffer;
+        auto output = std::back_inserter( buffer );
+        CHECK_THROWS( chunk.print( output, 125, 3, 102 ) );
+
+        ParseOptions lossy;
+        lossy.lossyOutput = true;
+        {
+          ParseOptions::Scope scope( lossy );
+          buffer.clear();
+          CHECK_THROWS( chunk.print( output, 125, 3, 102 ) );
+        }
+
+        lossy.singlePrecision = true;
+        auto position = string.begin();
+        auto last = string.end();
+        long line = 1;
+        ListRecord allowed = [&] {
+
+          ParseOptions::Scope scope( lossy );
+          return ListRecord( position, last, line, 125, 3, 102 );
+        }();
+
+        buffer.clear();
+        allowed.print( output, 125, 3, 102 );
+        CHECK( buffer == string );
+      } // THEN
+    } // WHEN
   } // GIVEN
 
   GIVEN( "different ListRecord" ) {
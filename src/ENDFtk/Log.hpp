@@ -0,0 +1,64 @@
+#ifndef NJOY_ENDFTK_LOG
+#define NJOY_ENDFTK_LOG
+
+// system includes
+#include <utility>
+
+// other includes
+#include "tools/Log.hpp"
+
+namespace njoy {
+namespace ENDFtk {
+
+  /**
+   *  @class
+   *  @brief The log used by ENDFtk
+   *
+   *  Messages are forwarded to the njoy logger unless they are silenced for
+   *  the current thread (see LogSilencer). Silencing messages never changes
+   *  the state of the njoy logger, so messages logged by other threads are
+   *  not affected.
+   */
+  struct Log {
+
+    /**
+     *  @brief Return the number of active silencers in the current thread
+     */
+    static unsigned int& silenced() {
+
+      thread_local unsigned int depth = 0;
+      return depth;
+    }
+
+    template< typename... Arguments >
+    static void info( Arguments&&... arguments ) {
+
+      if ( not silenced() ) {
+
+        njoy::Log::info( std::forward< Arguments >( arguments )... );
+      }
+    }
+
+    template< typename... Arguments >
+    static void warning( Arguments&&... arguments ) {
+
+      if ( not silenced() ) {
+
+        njoy::Log::warning( std::forward< Arguments >( arguments )... );
+      }
+    }
+
+    template< typename... Arguments >
+    static void error( Arguments&&... arguments ) {
+
+      if ( not silenced() ) {
+
+        njoy::Log::error( std::forward< Arguments >( arguments )... );
+      }
+    }
+  };
+
+} // ENDFtk namespace
+} // njoy namespace
+
+#endif
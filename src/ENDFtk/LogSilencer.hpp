@@ -0,0 +1,41 @@
+#ifndef NJOY_ENDFTK_LOGSILENCER
+#define NJOY_ENDFTK_LOGSILENCER
+
+// system includes
+
+// other includes
+#include "ENDFtk/Log.hpp"
+
+namespace njoy {
+namespace ENDFtk {
+
+  /**
+   *  @class
+   *  @brief Switch off the ENDFtk log messages of the current thread for the
+   *         lifetime of the object
+   *
+   *  This is used when errors are expected and handled by the caller (e.g.
+   *  when materials or sections are parsed concurrently and only the first
+   *  error is to be reported). Only the messages logged through ENDFtk::Log
+   *  by the current thread are switched off: the njoy logger itself is left
+   *  untouched and other threads keep logging. Silencers can be nested, the
+   *  messages are switched back on when the last one is destroyed. Threads
+   *  started while a silencer is active are not silenced, they need their
+   *  own silencer.
+   */
+  class LogSilencer {
+
+  public:
+
+    LogSilencer() { ++Log::silenced(); }
+
+    LogSilencer( const LogSilencer& ) = delete;
+    LogSilencer& operator=( const LogSilencer& ) = delete;
+
+    ~LogSilencer() { --Log::silenced(); }
+  };
+
+} // ENDFtk namespace
+} // njoy namespace
+
+#endif
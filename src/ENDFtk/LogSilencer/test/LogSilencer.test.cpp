@@ -0,0 +1,52 @@
+// include Catch2
+#include <catch2/catch_test_macros.hpp>
+
+// what we are testing
+#include "ENDFtk/LogSilencer.hpp"
+
+// other includes
+#include <thread>
+#include "spdlog/spdlog.h"
+
+// convenience typedefs
+using namespace njoy::ENDFtk;
+
+SCENARIO( "LogSilencer" ) {
+
+  GIVEN( "the log of the current thread" ) {
+
+    WHEN( "silencers are created" ) {
+
+      THEN( "log messages are switched off while a silencer exists" ) {
+
+        const auto level = spdlog::get_level();
+        CHECK( 0 == Log::silenced() );
+
+        {
+          LogSilencer outer;
+          CHECK( 1 == Log::silenced() );
+
+          {
+            LogSilencer inner;
+            CHECK( 2 == Log::silenced() );
+          }
+          CHECK( 1 == Log::silenced() );
+        }
+
+        CHECK( 0 == Log::silenced() );
+        CHECK( level == spdlog::get_level() );
+      } // THEN
+
+      THEN( "the log messages of other threads are not switched off" ) {
+
+        LogSilencer silencer;
+        CHECK( 1 == Log::silenced() );
+
+        unsigned int other = 1;
+        std::thread thread( [&other] { other = Log::silenced(); } );
+        thread.join();
+        CHECK( 0 == other );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+} // SCENARIO
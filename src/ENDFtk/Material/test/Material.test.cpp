@@ -103,6 +103,84 @@ SCENARIO( "Testing Material" ) {
         CHECK( buffer == matstring );
       } // THEN
     } // WHEN
+
+    WHEN( "a Material is constructed from a syntaxTree using multiple threads" ) {
+
+      auto begin = matstring.begin();
+      auto start = matstring.begin();
+      auto end = matstring.end();
+      long lineNumber = 0;
+
+      StructureDivision division( begin, end, lineNumber );
+      tree::Material material( asHead( division ), start, begin, end, lineNumber );
+
+      Material chunk = material.parallelParse( 2 );
+
+      THEN( "a Material can be constructed" ) {
+
+        verifyMaterial( chunk );
+      } // THEN
+
+      THEN( "it can be printed" ) {
+
+        std::string buffer;
+        auto output = std::back_inserter( buffer );
+        chunk.print( output );
+
+        CHECK( buffer == matstring );
+      } // THEN
+    } // WHEN
+
+    WHEN( "a selection of a syntaxTree is parsed" ) {
+
+      auto begin = matstring.begin();
+      auto start = matstring.begin();
+      auto end = matstring.end();
+      long lineNumber = 0;
+
+      StructureDivision division( begin, end, lineNumber );
+      tree::Material material( asHead( division ), start, begin, end, lineNumber );
+
+      THEN( "only the selected files and sections are present" ) {
+
+        Material chunk = material.parse( { { 1, { 451 } }, { 2, {} }, { 3, {} },
+                                           { 4, {} }, { 5, {} }, { 6, {} } } );
+        verifyMaterial( chunk );
+
+        chunk = material.parse( { { 1, { 451 } }, { 3, { 2, 102 } } } );
+        CHECK( 131 == chunk.MAT() );
+        CHECK( true == chunk.hasMFMT( 1, 451 ) );
+        CHECK( false == chunk.hasMF( 2 ) );
+        CHECK( true == chunk.hasMFMT( 3, 2 ) );
+        CHECK( false == chunk.hasMFMT( 3, 1 ) );
+        CHECK( false == chunk.hasMFMT( 3, 16 ) );
+        CHECK( false == chunk.hasMF( 4 ) );
+
+        chunk = material.parse( { { 1, { 452 } }, { 6, {} } } );
+        CHECK( 131 == chunk.MAT() );
+        CHECK( false == chunk.hasMF( 1 ) );
+        CHECK( false == chunk.hasMF( 6 ) );
+      } // THEN
+    } // WHEN
+
+    WHEN( "a syntaxTree with an invalid section is parsed using multiple threads" ) {
+
+      std::string invalid = matstring;
+      invalid.replace( invalid.find( " 0.000000+0 1.000000+0" ), 22,
+                       " 0.000000+0 1.0000y0+0" );
+      auto begin = invalid.begin();
+      auto start = invalid.begin();
+      auto end = invalid.end();
+      long lineNumber = 0;
+
+      StructureDivision division( begin, end, lineNumber );
+      tree::Material material( asHead( division ), start, begin, end, lineNumber );
+
+      THEN( "an exception is thrown" ) {
+
+        CHECK_THROWS( material.parallelParse( 2 ) );
+      } // THEN
+    } // WHEN
   } // GIVEN
 } // SCENARIO
 
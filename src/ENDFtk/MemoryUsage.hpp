@@ -0,0 +1,232 @@
+#ifndef NJOY_ENDFTK_MEMORYUSAGE
+#define NJOY_ENDFTK_MEMORYUSAGE
+
+// system includes
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+// other includes
+
+namespace njoy {
+namespace ENDFtk {
+
+  /**
+   *  @brief Whether or not a type provides a memoryUsage() method
+   */
+  template< typename Type, typename = void >
+  struct HasMemoryUsage : std::false_type {};
+
+  template< typename Type >
+  struct HasMemoryUsage< Type,
+                         std::void_t< decltype( std::declval< const Type& >()
+                                                    .memoryUsage() ) > >
+    : std::true_type {};
+
+  /**
+   *  @class
+   *  @brief The memory used by an ENDF tree or parsed object, by category
+   *
+   *  All values are given in bytes:
+   *    - text: ENDF text owned by the object
+   *    - mapped: ENDF text referenced in a memory mapped file or in the
+   *              content of a tree section (this memory is shared and is not
+   *              owned by the object)
+   *    - doubles: decoded real values (stored as doubles or as floats)
+   *    - integers: decoded integer values
+   *    - overhead: the objects themselves and the nodes of the containers
+   *                holding them
+   *
+   *  Records and the components of parsed sections provide a memoryUsage()
+   *  method returning the memory they own outside of the object itself
+   *  (the object is counted as overhead by whatever holds it). Components
+   *  obtain it by adding their stored members, so that values stored in
+   *  single precision and the retained text of lazily decoded records are
+   *  counted as they are stored and nothing is decoded or printed.
+   */
+  struct MemoryUsage {
+
+    std::size_t text = 0;
+    std::size_t mapped = 0;
+    std::size_t doubles = 0;
+    std::size_t integers = 0;
+    std::size_t overhead = 0;
+
+    /* methods */
+
+    /**
+     *  @brief Return the total number of bytes owned by the object
+     *
+     *  Memory mapped text is not included since it is not owned.
+     */
+    std::size_t total() const {
+
+      return this->text + this->doubles + this->integers + this->overhead;
+    }
+
+    /**
+     *  @brief Return the overhead of a node in a std::map or std::multimap
+     *
+     *  This is an estimate: the size of the key (including padding) and of
+     *  the colour and pointers kept by a red-black tree node. The size of the
+     *  value itself is accounted for by the value.
+     */
+    template< typename Key, typename Value >
+    static constexpr std::size_t node() {
+
+      return sizeof( std::pair< const Key, Value > ) - sizeof( Value )
+             + 4 * sizeof( void* );
+    }
+
+    /**
+     *  @brief Return the memory owned by the given members of an object
+     *
+     *  @param[in] members   the members of the object
+     */
+    template< typename... Members >
+    static MemoryUsage of( const Members&... members ) {
+
+      MemoryUsage usage;
+      ( usage.add( members ), ... );
+      return usage;
+    }
+
+    /**
+     *  @brief Add the memory used by text
+     *
+     *  @param[in] text   the text
+     */
+    void add( const std::string& text ) { this->text += text.capacity(); }
+
+    /**
+     *  @brief Add the memory used by a vector
+     *
+     *  Floating point values are counted as doubles, other numbers as
+     *  integers. For any other element, the elements are counted as overhead
+     *  and the memory owned by each element is added.
+     *
+     *  @param[in] values   the values
+     */
+    template< typename Type, typename Allocator >
+    void add( const std::vector< Type, Allocator >& values ) {
+
+      const std::size_t bytes = values.capacity() * sizeof( Type );
+      if constexpr ( std::is_floating_point_v< Type > ) {
+
+        this->doubles += bytes;
+      }
+      else if constexpr ( std::is_arithmetic_v< Type > ) {
+
+        this->integers += bytes;
+      }
+      else {
+
+        this->overhead += bytes;
+        for ( const auto& value : values ) {
+
+          this->add( value );
+        }
+      }
+    }
+
+    /**
+     *  @brief Add the memory owned by the elements of an array
+     *
+     *  @param[in] values   the values
+     */
+    template< typename Type, std::size_t N >
+    void add( const std::array< Type, N >& values ) {
+
+      for ( const auto& value : values ) {
+
+        this->add( value );
+      }
+    }
+
+    /**
+     *  @brief Add the memory owned by an optional value
+     *
+     *  @param[in] value   the optional value
+     */
+    template< typename Type >
+    void add( const std::optional< Type >& value ) {
+
+      if ( value ) {
+
+        this->add( *value );
+      }
+    }
+
+    /**
+     *  @brief Add the memory owned by the alternative held by a variant
+     *
+     *  @param[in] value   the variant
+     */
+    template< typename... Types >
+    void add( const std::variant< Types... >& value ) {
+
+      std::visit( [this] ( const auto& alternative ) {
+
+                    this->add( alternative );
+                  },
+                  value );
+    }
+
+    /**
+     *  @brief Add the memory owned by any other object
+     *
+     *  The object must either provide a memoryUsage() method or be a number
+     *  or an enumeration (which own no memory).
+     *
+     *  @param[in] value   the object
+     */
+    template< typename Type >
+    void add( const Type& value ) {
+
+      if constexpr ( HasMemoryUsage< Type >::value ) {
+
+        *this += value.memoryUsage();
+      }
+      else {
+
+        static_assert( std::is_arithmetic_v< Type > || std::is_enum_v< Type >,
+                       "the type does not provide a memoryUsage() method" );
+      }
+    }
+
+    /**
+     *  @brief Add the memory used by another object
+     *
+     *  @param[in] rhs   the memory used by the other object
+     */
+    MemoryUsage& operator+=( const MemoryUsage& rhs ) {
+
+      this->text += rhs.text;
+      this->mapped += rhs.mapped;
+      this->doubles += rhs.doubles;
+      this->integers += rhs.integers;
+      this->overhead += rhs.overhead;
+      return *this;
+    }
+
+    /**
+     *  @brief Return the sum of the memory used by two objects
+     *
+     *  @param[in] rhs   the memory used by the other object
+     */
+    MemoryUsage operator+( const MemoryUsage& rhs ) const {
+
+      MemoryUsage result = *this;
+      return result += rhs;
+    }
+  };
+
+} // ENDFtk namespace
+} // njoy namespace
+
+#endif
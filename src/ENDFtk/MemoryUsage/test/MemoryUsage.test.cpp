@@ -0,0 +1,222 @@
+// include Catch2
+#include <catch2/catch_test_macros.hpp>
+
+// what we are testing
+#include "ENDFtk/MemoryUsage.hpp"
+
+// other includes
+#include <optional>
+#include <variant>
+#include <vector>
+#include "ENDFtk/memoryUsage.hpp"
+#include "ENDFtk/tree/Tape.hpp"
+
+// convenience typedefs
+using namespace njoy::ENDFtk;
+
+std::string chunkMF1();
+std::string chunkMF3();
+
+SCENARIO( "MemoryUsage" ) {
+
+  GIVEN( "memory usage for two objects" ) {
+
+    MemoryUsage first;
+    first.text = 1;
+    first.mapped = 2;
+    first.doubles = 3;
+    first.integers = 4;
+    first.overhead = 5;
+
+    MemoryUsage second = first;
+    second.mapped = 10;
+
+    WHEN( "they are added" ) {
+
+      auto sum = first + second;
+
+      THEN( "the categories are added and the total excludes mapped text" ) {
+
+        CHECK( 2 == sum.text );
+        CHECK( 12 == sum.mapped );
+        CHECK( 6 == sum.doubles );
+        CHECK( 8 == sum.integers );
+        CHECK( 10 == sum.overhead );
+        CHECK( 26 == sum.total() );
+
+        first += second;
+        CHECK( 26 == first.total() );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+
+  GIVEN( "the members of an object" ) {
+
+    std::vector< float > floats( 4 );
+    std::vector< std::vector< int > > integers( 2, std::vector< int >( 3 ) );
+    std::optional< std::vector< double > > none;
+    std::optional< std::vector< double > > some( std::vector< double >( 5 ) );
+    std::variant< int, std::vector< double > > variant(
+        std::vector< double >( 1 ) );
+    ControlRecord control( 1., 2., 3, 4, 5, 6 );
+
+    WHEN( "the memory they own is requested" ) {
+
+      auto usage = MemoryUsage::of( floats, integers, none, some, variant,
+                                    control, 1.0 );
+
+      THEN( "the vectors are counted and their elements are visited" ) {
+
+        CHECK( 0 == usage.text );
+        CHECK( 0 == usage.mapped );
+        CHECK( 4 * sizeof( float ) + 6 * sizeof( double ) == usage.doubles );
+        CHECK( 6 * sizeof( int ) == usage.integers );
+        CHECK( integers.capacity() * sizeof( std::vector< int > ) ==
+               usage.overhead );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+
+  GIVEN( "a section parsed with different storage options" ) {
+
+    auto parse = [] ( const ParseOptions& options ) {
+
+      ParseOptions::Scope scope( options );
+      std::string string = chunkMF3();
+      auto begin = string.begin();
+      auto end = string.end();
+      long lineNumber = 1;
+      HeadRecord head( begin, end, lineNumber );
+      return section::Type< 3 >( head, begin, end, lineNumber, 125 );
+    };
+
+    ParseOptions single;
+    single.singlePrecision = true;
+    ParseOptions lazy;
+    lazy.lazy = true;
+
+    WHEN( "the memory used by the values is requested" ) {
+
+      auto doubles = memoryUsage( parse( ParseOptions() ) );
+      auto floats = memoryUsage( parse( single ) );
+      auto encoded = memoryUsage( parse( lazy ) );
+
+      tree::Section tree( 125, 3, 102, chunkMF3() );
+      auto shared = memoryUsage( tree.parse< 3 >( lazy ) );
+
+      THEN( "the values are counted as they are stored" ) {
+
+        // 3 pairs and 1 interpolation region
+        CHECK( 0 == doubles.text );
+        CHECK( 6 * sizeof( double ) == doubles.doubles );
+        CHECK( 2 * sizeof( long ) == doubles.integers );
+
+        CHECK( 0 == floats.text );
+        CHECK( 6 * sizeof( float ) == floats.doubles );
+        CHECK( 2 * sizeof( long ) == floats.integers );
+
+        // the line with the pairs is retained and is not decoded
+        CHECK( 81 == encoded.text );
+        CHECK( 0 == encoded.mapped );
+        CHECK( 0 == encoded.doubles );
+        CHECK( 2 * sizeof( long ) == encoded.integers );
+
+        // the line is not copied when parsing from a tree section
+        CHECK( 0 == shared.text );
+        CHECK( 81 == shared.mapped );
+        CHECK( 0 == shared.doubles );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+
+  GIVEN( "a tree and a parsed material" ) {
+
+    std::string string = chunkMF1() +
+      "                                                                   125 0  0     \n" +
+      chunkMF3() +
+      "                                                                   125 0  0     \n"
+      "                                                                     0 0  0     \n";
+    auto begin = string.begin();
+    auto position = string.begin();
+    auto end = string.end();
+    long lineNumber = 0;
+    HeadRecord head( position, end, lineNumber );
+    tree::Material tree( head, begin, position, end, lineNumber );
+    auto material = tree.parse();
+
+    WHEN( "the memory usage is requested" ) {
+
+      auto sectionUsage = tree.section( 3, 102 ).memoryUsage();
+      auto fileUsage = tree.file( 3 ).memoryUsage();
+      auto materialUsage = tree.memoryUsage();
+
+      auto parsed = memoryUsage( material );
+      auto mf3 = memoryUsage(
+          std::get< file::Type< 3 > >( material.file( 3 ) ).section( 102 ) );
+
+      THEN( "the tree reports its text and overhead" ) {
+
+        CHECK( tree.section( 3, 102 ).content().size() <= sectionUsage.text );
+        CHECK( sizeof( tree::Section ) == sectionUsage.overhead );
+        CHECK( 0 == sectionUsage.mapped );
+        CHECK( 0 == sectionUsage.doubles );
+        CHECK( 0 == sectionUsage.integers );
+
+        CHECK( sectionUsage.text == fileUsage.text );
+        CHECK( sectionUsage.overhead < fileUsage.overhead );
+        CHECK( fileUsage.text < materialUsage.text );
+        CHECK( fileUsage.overhead < materialUsage.overhead );
+      } // THEN
+
+      THEN( "the parsed material reports its decoded values and overhead" ) {
+
+        CHECK( 0 == mf3.text );
+        CHECK( 6 * sizeof( double ) == mf3.doubles );
+        CHECK( 2 * sizeof( long ) == mf3.integers );
+        CHECK( sizeof( section::Type< 3 > ) == mf3.overhead );
+
+        // 9 text records
+        CHECK( 9 * 66 <= parsed.text );
+        // the values of the MF1 MT451 records are stored in the section
+        CHECK( mf3.doubles == parsed.doubles );
+        CHECK( mf3.integers == parsed.integers );
+        // the text and directory records of MF1 MT451 are held in vectors
+        CHECK( mf3.overhead + 9 * sizeof( TextRecord ) +
+               3 * sizeof( DirectoryRecord ) < parsed.overhead );
+        CHECK( 0 == parsed.mapped );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+} // SCENARIO
+
+std::string chunkMF1() {
+
+  return
+    " 1.001000+3 9.991673-1          1          2          3          4 125 1451     \n"
+    " 5.000000+0 6.000000+0          7          8          0         12 125 1451     \n"
+    " 1.300000+1 1.400000+1         15          0         17         18 125 1451     \n"
+    " 1.900000+1 0.000000+0         21          0          9          3 125 1451     \n"
+    "  1-H -  1 LANL       EVAL-JUL16 G.M.Hale                          125 1451     \n"
+    "                      DIST-JAN17                       20170124    125 1451     \n"
+    "----ENDF/B-VIII.0     MATERIAL  125                                125 1451     \n"
+    "-----INCIDENT NEUTRON DATA                                         125 1451     \n"
+    "------ENDF-6 FORMAT                                                125 1451     \n"
+    "                                                                   125 1451     \n"
+    " ****************************************************************  125 1451     \n"
+    "                                                                   125 1451     \n"
+    " ****************************************************************  125 1451     \n"
+    "                                1        451         16          5 125 1451     \n"
+    "                                3          1          5          4 125 1451     \n"
+    "                                3        102          5          5 125 1451     \n"
+    "                                                                   125 1  0     \n";
+}
+
+std::string chunkMF3() {
+
+  return
+    " 1.001000+3 9.991673-1          0          0          0          0 125 3102     \n"
+    " 2.224631+6 2.224631+6          0          0          1          3 125 3102     \n"
+    "          3          5                                             125 3102     \n"
+    " 1.000000-5 1.672869+1 1.000000+0 1.672869-2 2.000000+7 2.722858-5 125 3102     \n"
+    "                                                                   125 3  0     \n";
+}
@@ -0,0 +1,122 @@
+#ifndef NJOY_ENDFTK_PARSEERROR
+#define NJOY_ENDFTK_PARSEERROR
+
+// system includes
+#include <string>
+
+// other includes
+
+namespace njoy {
+namespace ENDFtk {
+
+  /**
+   *  @class
+   *  @brief A structured description of an error encountered while parsing
+   *
+   *  The error contains:
+   *    - mat, mf, mt: the MAT, MF and MT number of the section in which the
+   *                   error was detected (mt is 0 for a FEND record, mf and
+   *                   mt are 0 for a MEND record)
+   *    - line: the line number in that section (the first line of a section
+   *            is line 1)
+   *    - record: the type of the record in which the error was detected
+   *              (e.g. CONT, LIST or TAB1) or an empty string when the record
+   *              is not known
+   *    - field: the field that caused the error (MAT, MF, MT or the position
+   *             of the field on the line, e.g. "field 3") or an empty string
+   *             when the field is not known
+   *    - reason: a description of the error
+   */
+  struct ParseError {
+
+    int mat = 0;
+    int mf = 0;
+    int mt = 0;
+    long line = 0;
+    std::string record;
+    std::string field;
+    std::string reason;
+
+    /**
+     *  @brief Return the name of a field given its position on a line
+     *
+     *  Positions 0 to 5 are the six data fields, 6 to 8 are the MAT, MF and
+     *  MT numbers.
+     *
+     *  @param[in] position   the position of the field on the line
+     */
+    static std::string fieldName( int position ) {
+
+      static const char* tail[] = { "MAT", "MF", "MT" };
+      return ( position >= 0 ) && ( position < 6 )
+             ? "field " + std::to_string( position + 1 )
+             : ( position >= 6 ) && ( position < 9 ) ? tail[ position - 6 ]
+                                                     : "";
+    }
+
+    class Context;
+  };
+
+  /**
+   *  @class
+   *  @brief Collect the record type and field of a parse error in the current
+   *         thread for the lifetime of the context
+   *
+   *  Records that fail to parse report their type (and the position of the
+   *  field that could not be read, when it is known) before the exception
+   *  leaves them. Only the first report is retained, which is the one made by
+   *  the innermost record. Reports made while no context is active are
+   *  ignored.
+   */
+  class ParseError::Context {
+
+    std::string record_;
+    std::string field_;
+    Context* previous_;
+
+    static Context*& active() {
+
+      static thread_local Context* context = nullptr;
+      return context;
+    }
+
+  public:
+
+    Context() : previous_( active() ) { active() = this; }
+
+    Context( const Context& ) = delete;
+    Context& operator=( const Context& ) = delete;
+
+    ~Context() { active() = this->previous_; }
+
+    /**
+     *  @brief Return the type of the record that reported an error
+     */
+    const std::string& record() const { return this->record_; }
+
+    /**
+     *  @brief Return the field that was reported (if any)
+     */
+    const std::string& field() const { return this->field_; }
+
+    /**
+     *  @brief Report an error in a record to the active context
+     *
+     *  @param[in] record     the record type
+     *  @param[in] position   the position of the field on the line (if known)
+     */
+    static void report( const char* record, int position = -1 ) {
+
+      auto context = active();
+      if ( context && context->record_.empty() ) {
+
+        context->record_ = record;
+        context->field_ = fieldName( position );
+      }
+    }
+  };
+
+} // ENDFtk namespace
+} // njoy namespace
+
+#endif
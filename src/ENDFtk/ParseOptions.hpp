@@ -0,0 +1,140 @@
+#ifndef NJOY_ENDFTK_PARSEOPTIONS
+#define NJOY_ENDFTK_PARSEOPTIONS
+
+// system includes
+#include <memory_resource>
+
+// other includes
+#include "ENDFtk/PrecisionReport.hpp"
+
+namespace njoy {
+namespace ENDFtk {
+
+  /**
+   *  @class
+   *  @brief Options controlling the verification done while parsing and the
+   *         memory used for the parsed values
+   *
+   *  By default, all verifications are performed. For input that is known to
+   *  be valid (e.g. a reference library that was already verified), the
+   *  following verifications can be switched off:
+   *    - verifyTails: the verification of the MAT, MF and MT numbers of
+   *                   every line in a record
+   *    - verifySorted: the verification that the x values of a tabulation
+   *                    (and the energies of an MF6 or MF26 continuum
+   *                    distribution) are sorted
+   *
+   *  The values read from LIST, TAB1 and TAB2 records are stored using the
+   *  memory resource given by memoryResource (the default memory resource is
+   *  used when it is not set). Using a std::pmr::monotonic_buffer_resource
+   *  for instance allows parsing an entire material into a single arena
+   *  that is released in one go, avoiding thousands of small allocations for
+   *  large sections (e.g. MF6 or MF33). The memory resource must outlive the
+   *  parsed components, and copies of the parsed components (and records
+   *  constructed from values instead of a buffer) use the default memory
+   *  resource. The memory resource does not need to be thread safe: the
+   *  threads of the parallel parse functions allocate from it one at a
+   *  time.
+   *
+   *  When lazy is set, the values of LIST and TAB1 records read from a
+   *  contiguous buffer are not decoded while parsing. The lines of these
+   *  records are verified and retained, and the values are decoded on first
+   *  access (see record::LazyValues). This is useful when only a few records
+   *  of a large section are used.
+   *
+   *  When singlePrecision is set, the values of LIST and TAB1 records are
+   *  stored as floats instead of doubles. This halves the memory used by
+   *  bulky sections like MF6, MF7 MT4 or MF33 at the cost of about 7
+   *  significant digits of precision. The floats are available through the
+   *  single precision accessors of the records, the usual accessors widen
+   *  the values into a temporary array owned by the returned range, so that
+   *  the record never retains the values in double precision. A value outside
+   *  of the single precision range overflows to infinity. When
+   *  precisionReport is set, the number of values stored in single
+   *  precision, the number of overflows and inexact values and the largest
+   *  relative round trip error are added to the report (the parallel parse
+   *  functions add to it once all sections were parsed). Single precision
+   *  storage takes precedence over lazy decoding.
+   *
+   *  Since printing single precision values would silently produce different
+   *  ENDF data, records stored in single precision refuse to be printed
+   *  unless lossyOutput was set in the options used to read them (the
+   *  records store this flag when they are read, the options active when
+   *  printing are not used).
+   *
+   *  The options are applied using a ParseOptions::Scope or by passing them
+   *  to the parse functions of the tree components (tree::Section, tree::File,
+   *  tree::Material and tree::Tape). They apply to the parsing done in the
+   *  current thread for the lifetime of the scope, and to the threads used by
+   *  the parallel parse functions of the tree components started from it.
+   *
+   *  Verifications that decide how the data is interpreted (flags like LB,
+   *  LAW or LANG and the size checks that go with them) are always
+   *  performed.
+   */
+  struct ParseOptions {
+
+    bool verifyTails = true;
+    bool verifySorted = true;
+    std::pmr::memory_resource* memoryResource = nullptr;
+    bool lazy = false;
+    bool singlePrecision = false;
+    bool lossyOutput = false;
+    PrecisionReport* precisionReport = nullptr;
+
+    /**
+     *  @brief Return the options for input that is known to be valid
+     */
+    static constexpr ParseOptions trusted() {
+
+      return { false, false, nullptr, false, false, false, nullptr };
+    }
+
+    /**
+     *  @brief Return the options that are active in the current thread
+     */
+    static ParseOptions& active() {
+
+      static thread_local ParseOptions options;
+      return options;
+    }
+
+    /**
+     *  @brief Return the memory resource to be used for the parsed values in
+     *         the current thread
+     */
+    static std::pmr::memory_resource* activeMemoryResource() {
+
+      auto resource = active().memoryResource;
+      return resource ? resource : std::pmr::get_default_resource();
+    }
+
+    class Scope;
+  };
+
+  /**
+   *  @class
+   *  @brief Activate parse options in the current thread for the lifetime of
+   *         the scope
+   */
+  class ParseOptions::Scope {
+
+    ParseOptions previous_;
+
+  public:
+
+    Scope( const ParseOptions& options ) : previous_( active() ) {
+
+      active() = options;
+    }
+
+    Scope( const Scope& ) = delete;
+    Scope& operator=( const Scope& ) = delete;
+
+    ~Scope() { active() = this->previous_; }
+  };
+
+} // ENDFtk namespace
+} // njoy namespace
+
+#endif
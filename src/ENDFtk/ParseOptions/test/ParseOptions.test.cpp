@@ -0,0 +1,565 @@
+// include Catch2
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+// what we are testing
+#include "ENDFtk/ParseOptions.hpp"
+
+// other includes
+#include <cmath>
+#include <memory_resource>
+#include <optional>
+#include <thread>
+#include <vector>
+#include "ENDFtk/TabulationRecord.hpp"
+#include "ENDFtk/section/3.hpp"
+#include "ENDFtk/section/6.hpp"
+#include "ENDFtk/section/33.hpp"
+#include "ENDFtk/section/7/4.hpp"
+#include "ENDFtk/tree/Section.hpp"
+
+// convenience typedefs
+using namespace njoy::ENDFtk;
+
+std::string chunkUnsorted();
+std::string chunkWrongMT();
+std::string chunkMF3();
+std::string chunkLargeMF3();
+std::string chunkMF6();
+std::string chunkMF7();
+std::string chunkMF33();
+
+// a memory resource that counts the allocations made through it
+class CountingResource : public std::pmr::memory_resource {
+
+  std::pmr::memory_resource* upstream_;
+
+  void* do_allocate( std::size_t bytes, std::size_t alignment ) override {
+
+    ++this->allocations;
+    return this->upstream_->allocate( bytes, alignment );
+  }
+
+  void do_deallocate( void* pointer, std::size_t bytes,
+                      std::size_t alignment ) override {
+
+    this->upstream_->deallocate( pointer, bytes, alignment );
+  }
+
+  bool do_is_equal( const std::pmr::memory_resource& other )
+  const noexcept override {
+
+    return this == &other;
+  }
+
+public:
+
+  std::size_t allocations = 0;
+
+  CountingResource( std::pmr::memory_resource* upstream =
+                        std::pmr::new_delete_resource() ) :
+    upstream_( upstream ) {}
+};
+
+template< typename Section >
+std::string print( const Section& section, int MAT, int MF ) {
+
+  std::string buffer;
+  auto output = std::back_inserter( buffer );
+  section.print( output, MAT, MF );
+  return buffer;
+}
+
+TabulationRecord read( const std::string& string ) {
+
+  auto begin = string.begin();
+  auto end = string.end();
+  long lineNumber = 1;
+  return TabulationRecord( begin, end, lineNumber, 125, 3, 102 );
+}
+
+SCENARIO( "ParseOptions" ) {
+
+  GIVEN( "the default and trusted parse options" ) {
+
+    WHEN( "the options are inspected" ) {
+
+      THEN( "all verifications are performed by default" ) {
+
+        CHECK( true == ParseOptions().verifyTails );
+        CHECK( true == ParseOptions().verifySorted );
+        CHECK( true == ParseOptions::active().verifyTails );
+        CHECK( true == ParseOptions::active().verifySorted );
+        CHECK( false == ParseOptions().singlePrecision );
+        CHECK( false == ParseOptions().lossyOutput );
+
+        CHECK( false == ParseOptions::trusted().verifyTails );
+        CHECK( false == ParseOptions::trusted().verifySorted );
+      } // THEN
+    } // WHEN
+
+    WHEN( "options are activated using a scope" ) {
+
+      THEN( "they are active for the lifetime of the scope in this thread" ) {
+
+        {
+          ParseOptions::Scope scope( ParseOptions::trusted() );
+          CHECK( false == ParseOptions::active().verifyTails );
+          CHECK( false == ParseOptions::active().verifySorted );
+
+          {
+            ParseOptions::Scope nested( ParseOptions{ true, false } );
+            CHECK( true == ParseOptions::active().verifyTails );
+            CHECK( false == ParseOptions::active().verifySorted );
+          }
+          CHECK( false == ParseOptions::active().verifyTails );
+
+          bool other = false;
+          std::thread thread( [&other] {
+
+            other = ParseOptions::active().verifyTails;
+          } );
+          thread.join();
+          CHECK( true == other );
+        }
+
+        CHECK( true == ParseOptions::active().verifyTails );
+        CHECK( true == ParseOptions::active().verifySorted );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+
+  GIVEN( "records that do not pass verification" ) {
+
+    WHEN( "they are read using the default options" ) {
+
+      THEN( "an exception is thrown" ) {
+
+        CHECK_THROWS( read( chunkUnsorted() ) );
+        CHECK_THROWS( read( chunkWrongMT() ) );
+      } // THEN
+    } // WHEN
+
+    WHEN( "they are read without the corresponding verification" ) {
+
+      THEN( "the records are read" ) {
+
+        {
+          ParseOptions::Scope scope( ParseOptions{ true, false } );
+          CHECK_NOTHROW( read( chunkUnsorted() ) );
+          CHECK_THROWS( read( chunkWrongMT() ) );
+        }
+        {
+          ParseOptions::Scope scope( ParseOptions{ false, true } );
+          CHECK_THROWS( read( chunkUnsorted() ) );
+
+          auto record = read( chunkWrongMT() );
+          CHECK( 3 == record.NP() );
+          CHECK( 3 == record.x().size() );
+        }
+      } // THEN
+    } // WHEN
+  } // GIVEN
+
+  GIVEN( "a tree::Section" ) {
+
+    tree::Section tree( 125, 3, 102, chunkMF3() );
+
+    WHEN( "it is parsed using the trusted options" ) {
+
+      auto section = tree.parse< 3 >( ParseOptions::trusted() );
+
+      THEN( "the section is identical to the one parsed using the default "
+            "options and the options are no longer active" ) {
+
+        auto reference = tree.parse< 3 >();
+        CHECK( reference.NP() == section.NP() );
+        for ( unsigned int i = 0; i < 3; ++i ) {
+
+          CHECK( reference.energies()[i] == section.energies()[i] );
+          CHECK( reference.crossSections()[i] == section.crossSections()[i] );
+        }
+
+        CHECK( true == ParseOptions::active().verifyTails );
+        CHECK( true == ParseOptions::active().verifySorted );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+
+  GIVEN( "MF6 and MF7 sections and a memory resource" ) {
+
+    tree::Section mf6( 9228, 6, 5, chunkMF6() );
+    tree::Section mf7( 27, 7, 4, chunkMF7() );
+
+    WHEN( "the sections are parsed using a memory resource" ) {
+
+      CountingResource heap;
+      auto section6 = mf6.parse< 6 >( heap );
+      auto section7 = mf7.parse< 7, 4 >( heap );
+
+      THEN( "the values of the records are allocated using the memory "
+            "resource and the memory resource is no longer active" ) {
+
+        CHECK( 0 < heap.allocations );
+        CHECK( nullptr == ParseOptions::active().memoryResource );
+
+        CHECK( chunkMF6() == print( section6, 9228, 6 ) );
+        CHECK( chunkMF7() == print( section7, 27, 7 ) );
+      } // THEN
+    } // WHEN
+
+    WHEN( "records are constructed from values while a memory resource is "
+          "active" ) {
+
+      CountingResource heap;
+      ParseOptions options;
+      options.memoryResource = &heap;
+      std::optional< TabulationRecord > table;
+      {
+        ParseOptions::Scope scope( options );
+        table.emplace( 1., 2., 3, 4, std::vector< long >{ 2 },
+                       std::vector< long >{ 2 },
+                       std::vector< double >{ 1., 2. },
+                       std::vector< double >{ 3., 4. } );
+      }
+
+      THEN( "the memory resource is not used" ) {
+
+        CHECK( 0 == heap.allocations );
+        CHECK( 2 == table->NP() );
+      } // THEN
+    } // WHEN
+
+    WHEN( "the sections are parsed using a monotonic arena" ) {
+
+      CountingResource heap;
+      auto reference6 = mf6.parse< 6 >( heap );
+      auto reference7 = mf7.parse< 7, 4 >( heap );
+
+      CountingResource upstream;
+      std::pmr::monotonic_buffer_resource arena( &upstream );
+      auto section6 = mf6.parse< 6 >( arena );
+      auto section7 = mf7.parse< 7, 4 >( arena );
+
+      THEN( "the number of allocations is reduced and the sections are "
+            "identical" ) {
+
+        CHECK( upstream.allocations < heap.allocations );
+
+        CHECK( chunkMF6() == print( section6, 9228, 6 ) );
+        CHECK( chunkMF7() == print( section7, 27, 7 ) );
+      } // THEN
+    } // WHEN
+
+    WHEN( "the sections are parsed using lazy decoding" ) {
+
+      ParseOptions options;
+      options.lazy = true;
+      auto section6 = mf6.parse< 6 >( options );
+      auto section7 = mf7.parse< 7, 4 >( options );
+
+      THEN( "the sections are identical and lazy decoding is no longer "
+            "active" ) {
+
+        CHECK( false == ParseOptions::active().lazy );
+
+        CHECK( chunkMF6() == print( section6, 9228, 6 ) );
+        CHECK( chunkMF7() == print( section7, 27, 7 ) );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+
+  GIVEN( "MF6, MF7 and MF33 sections" ) {
+
+    tree::Section mf6( 9228, 6, 5, chunkMF6() );
+    tree::Section mf7( 27, 7, 4, chunkMF7() );
+    tree::Section mf33( 9437, 33, 2, chunkMF33() );
+
+    WHEN( "the sections are parsed using single precision storage" ) {
+
+      PrecisionReport report;
+      ParseOptions options;
+      options.singlePrecision = true;
+      options.precisionReport = &report;
+      auto section6 = mf6.parse< 6 >( options );
+      auto section7 = mf7.parse< 7, 4 >( options );
+      auto section33 = mf33.parse< 33 >( options );
+
+      THEN( "the round trip error is reported and single precision storage "
+            "is no longer active" ) {
+
+        CHECK( false == ParseOptions::active().singlePrecision );
+        CHECK( nullptr == ParseOptions::active().precisionReport );
+
+        CHECK( 0 < report.values );
+        CHECK( 0 == report.overflows );
+        CHECK( 4 * report.values == report.savedMemory() );
+        CHECK( report.maxRelativeError < 6e-8 );
+      } // THEN
+
+      THEN( "the sections can only be printed when lossy output is "
+            "allowed" ) {
+
+        CHECK_THROWS( print( section6, 9228, 6 ) );
+        CHECK_THROWS( print( section7, 27, 7 ) );
+        CHECK_THROWS( print( section33, 9437, 33 ) );
+
+        ParseOptions lossy;
+        lossy.lossyOutput = true;
+        ParseOptions::Scope scope( lossy );
+
+        CHECK( chunkMF6().size() == print( section6, 9228, 6 ).size() );
+        CHECK( chunkMF7().size() == print( section7, 27, 7 ).size() );
+
+        // all values in this section are exact in single precision
+        CHECK( chunkMF33() == print( section33, 9437, 33 ) );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+} // SCENARIO
+
+TEST_CASE( "Parsing with trusted options", "[.][benchmark]" ) {
+
+  tree::Section mf3( 125, 3, 102, chunkLargeMF3() );
+
+  // compare the mean times to get the speedup for MF3
+  BENCHMARK( "MF3 (default options)" ) {
+
+    return mf3.parse< 3 >();
+  };
+
+  BENCHMARK( "MF3 (trusted options)" ) {
+
+    return mf3.parse< 3 >( ParseOptions::trusted() );
+  };
+
+  ParseOptions lazy;
+  lazy.lazy = true;
+
+  // the parse time when only the number of points is used
+  BENCHMARK( "MF3 (lazy decoding)" ) {
+
+    return mf3.parse< 3 >( lazy );
+  };
+
+  BENCHMARK( "MF3 (lazy decoding and access)" ) {
+
+    auto section = mf3.parse< 3 >( lazy );
+    return section.energies().back();
+  };
+}
+
+TEST_CASE( "Parsing into a monotonic arena", "[.][benchmark]" ) {
+
+  tree::Section mf6( 9228, 6, 5, chunkMF6() );
+  tree::Section mf7( 27, 7, 4, chunkMF7() );
+
+  // the allocation counts before and after
+  CountingResource heap;
+  mf6.parse< 6 >( heap );
+  mf7.parse< 7, 4 >( heap );
+
+  CountingResource upstream;
+  {
+    std::pmr::monotonic_buffer_resource arena( &upstream );
+    mf6.parse< 6 >( arena );
+    mf7.parse< 7, 4 >( arena );
+  }
+
+  INFO( "allocations using the default memory resource: "
+        << heap.allocations );
+  INFO( "allocations using a monotonic arena: " << upstream.allocations );
+  CHECK( upstream.allocations < heap.allocations );
+
+  // compare the mean times to get the speedup for MF6 and MF7
+  BENCHMARK( "MF6 (default memory resource)" ) {
+
+    return mf6.parse< 6 >();
+  };
+
+  BENCHMARK( "MF6 (monotonic arena)" ) {
+
+    std::pmr::monotonic_buffer_resource arena;
+    return mf6.parse< 6 >( arena ).NK();
+  };
+
+  BENCHMARK( "MF7 (default memory resource)" ) {
+
+    return mf7.parse< 7, 4 >();
+  };
+
+  BENCHMARK( "MF7 (monotonic arena)" ) {
+
+    std::pmr::monotonic_buffer_resource arena;
+    return mf7.parse< 7, 4 >( arena ).LAT();
+  };
+}
+
+TEST_CASE( "Parsing in single precision", "[.][benchmark]" ) {
+
+  tree::Section mf6( 9228, 6, 5, chunkMF6() );
+  tree::Section mf7( 27, 7, 4, chunkMF7() );
+
+  ParseOptions options;
+  options.singlePrecision = true;
+
+  // the memory saved and the round trip error
+  PrecisionReport report6;
+  options.precisionReport = &report6;
+  mf6.parse< 6 >( options );
+
+  PrecisionReport report7;
+  options.precisionReport = &report7;
+  mf7.parse< 7, 4 >( options );
+
+  options.precisionReport = nullptr;
+
+  INFO( "MF6: " << report6.values << " values, " << report6.savedMemory()
+        << " bytes saved, maximum relative error "
+        << report6.maxRelativeError );
+  INFO( "MF7: " << report7.values << " values, " << report7.savedMemory()
+        << " bytes saved, maximum relative error "
+        << report7.maxRelativeError );
+  CHECK( report6.maxRelativeError < 6e-8 );
+  CHECK( report7.maxRelativeError < 6e-8 );
+
+  // compare the mean times to get the cost of narrowing the values
+  BENCHMARK( "MF6 (double precision)" ) {
+
+    return mf6.parse< 6 >();
+  };
+
+  BENCHMARK( "MF6 (single precision)" ) {
+
+    return mf6.parse< 6 >( options );
+  };
+
+  BENCHMARK( "MF7 (double precision)" ) {
+
+    return mf7.parse< 7, 4 >();
+  };
+
+  BENCHMARK( "MF7 (single precision)" ) {
+
+    return mf7.parse< 7, 4 >( options );
+  };
+}
+
+std::string chunkUnsorted() {
+
+  return
+    " 0.000000+0 0.000000+0          0          0          1          3 125 3102     \n"
+    "          3          2                                             125 3102     \n"
+    " 1.000000+0 4.000000+0 3.000000+0 5.000000+0 2.000000+0 6.000000+0 125 3102     \n";
+}
+
+std::string chunkWrongMT() {
+
+  return
+    " 0.000000+0 0.000000+0          0          0          1          3 125 3102     \n"
+    "          3          2                                             125 3102     \n"
+    " 1.000000+0 4.000000+0 2.000000+0 5.000000+0 3.000000+0 6.000000+0 125 3  1     \n";
+}
+
+std::string chunkMF3() {
+
+  return
+    " 1.001000+3 9.991673-1          0          0          0          0 125 3102     \n"
+    " 2.224631+6 2.224631+6          0          0          1          3 125 3102     \n"
+    "          3          5                                             125 3102     \n"
+    " 1.000000-5 1.672869+1 1.000000+0 1.672869-2 2.000000+7 2.722858-5 125 3102     \n"
+    "                                                                   125 3  0     \n";
+}
+
+std::string chunkLargeMF3() {
+
+  const long points = 100000;
+  std::vector< double > energies( points );
+  std::vector< double > values( points );
+  for ( long i = 0; i < points; ++i ) {
+
+    energies[i] = 1e-5 * std::pow( 2e+12, double( i ) / double( points - 1 ) );
+    values[i] = 1. / std::sqrt( energies[i] );
+  }
+
+  section::Type< 3 > section( 102, 1001, 0.9991673, 2.224631e+6, 2.224631e+6,
+                              std::move( energies ), std::move( values ) );
+  std::string buffer;
+  auto output = std::back_inserter( buffer );
+  section.print( output, 125, 3 );
+  return buffer;
+}
+
+std::string chunkMF6() {
+
+  return
+    " 9.223500+4 2.330248+2          0          2          3          09228 6  5     \n"
+    " 1.001000+3 9.986234-1          0          1          1          49228 6  5     \n"
+    "          4          2                                            9228 6  5     \n"
+    " 1.000000-5 0.000000+0 1.100000+7 8.45368-11 1.147000+7 6.622950-89228 6  5     \n"
+    " 2.000000+7 2.149790-1                                            9228 6  5     \n"
+    " 0.000000+0 0.000000+0          1          2          1          29228 6  5     \n"
+    "          2          1                                            9228 6  5     \n"
+    " 0.000000+0 1.000000-5          0          1         12          49228 6  5     \n"
+    " 1.000000+0 2.000000+0 3.000000+0 4.000000+0 5.000000+0 6.000000+09228 6  5     \n"
+    " 7.000000+0 8.000000+0 9.000000+0 1.000000+1 1.100000+1 1.200000+19228 6  5     \n"
+    " 0.000000+0 2.000000+7          0          1          6          29228 6  5     \n"
+    " 1.000000+0 2.000000+0 3.000000+0 4.000000+0 5.000000+0 6.000000+09228 6  5     \n"
+    " 1.000000+0 1.000000+0          0          1          1          29228 6  5     \n"
+    "          2          2                                            9228 6  5     \n"
+    " 1.858639+7 4.000000+0 2.000000+7 4.000000+0                      9228 6  5     \n"
+    " 0.000000+0 0.000000+0          1          2          1          29228 6  5     \n"
+    "          2         22                                            9228 6  5     \n"
+    " 0.000000+0 1.858639+7          0          0          6          39228 6  5     \n"
+    " 0.000000+0 0.000000+0 5.000000-1 2.000000+0 1.000000+0 0.000000+09228 6  5     \n"
+    " 0.000000+0 2.000000+7          0          0          6          39228 6  5     \n"
+    " 0.000000+0 0.000000+0 5.000000-1 2.000000+0 1.000000+0 0.000000+09228 6  5     \n"
+    " 0.000000+0 0.000000+0          0          1          1          39228 6  5     \n"
+    "          3          2                                            9228 6  5     \n"
+    " 1.858639+7 1.000000+0 1.900000+7 2.000000+0 2.000000+7 3.000000+09228 6  5     \n"
+    " 0.000000+0 0.000000+0          1          2          1          29228 6  5     \n"
+    "          2          5                                            9228 6  5     \n"
+    " 0.000000+0 1.858639+7          0          0          6          39228 6  5     \n"
+    " 0.000000+0 0.000000+0 1.000000+0 1.000000+0 2.000000+0 0.000000+09228 6  5     \n"
+    " 0.000000+0 2.000000+7          0          0          6          39228 6  5     \n"
+    " 0.000000+0 0.000000+0 1.000000+0 1.000000+0 2.000000+0 0.000000+09228 6  5     \n"
+    "                                                                  9228 6  0     \n";
+}
+
+std::string chunkMF7() {
+
+  return
+    " 1.270000+2 8.934780+0          0          1          0          0  27 7  4     \n"
+    " 0.000000+0 0.000000+0          0          0          6          0  27 7  4     \n"
+    " 6.153875+0 1.976285+2 8.934780+0 5.000001+0 0.000000+0 1.000000+0  27 7  4     \n"
+    " 0.000000+0 0.000000+0          0          0          1          2  27 7  4     \n"
+    "          2          4                                              27 7  4     \n"
+    " 2.936000+2 0.000000+0          0          0          1          5  27 7  4     \n"
+    "          5          4                                              27 7  4     \n"
+    " 4.423802-3 2.386876-4 4.649528-3 2.508466-4 4.886772-3 2.636238-4  27 7  4     \n"
+    " 8.418068+1 1.306574-9 8.847604+1 5.29573-10                        27 7  4     \n"
+    " 2.936000+2 3.952570-2          0          0          1          5  27 7  4     \n"
+    "          5          2                                              27 7  4     \n"
+    " 4.423802-3 2.386694-4 4.649528-3 2.508273-4 4.886772-3 2.636238-4  27 7  4     \n"
+    " 8.418068+1 2.770291-4 8.847604+1 2.911373-4                        27 7  4     \n"
+    " 0.000000+0 0.000000+0          0          0          1          3  27 7  4     \n"
+    "          3          2                                              27 7  4     \n"
+    " 2.936000+2 5.332083+2 6.000000+2 7.354726+2 1.200000+3 1.270678+3  27 7  4     \n"
+    "                                                                    27 7  0     \n";
+}
+
+std::string chunkMF33() {
+
+  return
+    " 9.423900+4 2.369986+2          0          0          0          1943733  2     \n"
+    " 1.000000+0 2.000000+0          3          4          1          1943733  2     \n"
+    " 0.000000+0 0.000000+0          0          0          0          0943733  2     \n"
+    " 2.500000+3 2.000000+7          0          0         14          7943733  2     \n"
+    " 1.000000+0 1.000000+0-1.000000+0 4.000000+0-1.000000+0 1.600000+1943733  2     \n"
+    "-1.000000+0 1.700000+1-1.000000+0 1.800000+1-1.000000+0 3.700000+1943733  2     \n"
+    "-1.000000+0 1.020000+2                                            943733  2     \n"
+    " 0.000000+0 0.000000+0          0          5          7          3943733  2     \n"
+    " 0.000000+0 1.000000+2 2.000000+2 1.000000+0 2.000000+0 3.000000+0943733  2     \n"
+    " 4.000000+0                                                       943733  2     \n"
+    "                                                                  943733  0     \n";
+}
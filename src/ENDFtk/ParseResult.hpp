@@ -0,0 +1,70 @@
+#ifndef NJOY_ENDFTK_PARSERESULT
+#define NJOY_ENDFTK_PARSERESULT
+
+// system includes
+#include <utility>
+#include <variant>
+
+// other includes
+#include "ENDFtk/ParseError.hpp"
+
+namespace njoy {
+namespace ENDFtk {
+
+  /**
+   *  @class
+   *  @brief The result of a parse operation: either the parsed value or the
+   *         error that prevented it from being parsed
+   *
+   *  This is returned by the tryParse() functions of the tree components,
+   *  which do not throw exceptions when the data cannot be parsed.
+   */
+  template< typename Value >
+  class ParseResult {
+
+    /* fields */
+    std::variant< Value, ParseError > result_;
+
+  public:
+
+    /* constructor */
+    ParseResult( Value&& value ) : result_( std::move( value ) ) {}
+    ParseResult( ParseError&& error ) : result_( std::move( error ) ) {}
+
+    /* methods */
+
+    /**
+     *  @brief Return whether or not the result contains a value
+     */
+    bool hasValue() const { return this->result_.index() == 0; }
+
+    /**
+     *  @brief Return whether or not the result contains a value
+     */
+    explicit operator bool() const { return this->hasValue(); }
+
+    /**
+     *  @brief Return the value (the result must contain a value)
+     */
+    const Value& value() const & { return std::get< 0 >( this->result_ ); }
+
+    /**
+     *  @brief Return the value (the result must contain a value)
+     */
+    Value& value() & { return std::get< 0 >( this->result_ ); }
+
+    /**
+     *  @brief Return the value (the result must contain a value)
+     */
+    Value&& value() && { return std::get< 0 >( std::move( this->result_ ) ); }
+
+    /**
+     *  @brief Return the error (the result must contain an error)
+     */
+    const ParseError& error() const { return std::get< 1 >( this->result_ ); }
+  };
+
+} // ENDFtk namespace
+} // njoy namespace
+
+#endif
@@ -0,0 +1,59 @@
+#ifndef NJOY_ENDFTK_PRECISIONREPORT
+#define NJOY_ENDFTK_PRECISIONREPORT
+
+// system includes
+#include <algorithm>
+#include <cstddef>
+
+// other includes
+
+namespace njoy {
+namespace ENDFtk {
+
+  /**
+   *  @class
+   *  @brief Summary of the values stored in single precision while parsing
+   *
+   *  When single precision storage is requested in the parse options, the
+   *  values of LIST and TAB1 records are stored as floats. A precision report
+   *  set in the parse options accumulates the number of values that were
+   *  narrowed, the number of finite values that overflowed to infinity, the
+   *  number of values that lost precision (i.e. that are not exactly
+   *  representable in single precision) and the largest relative difference
+   *  between a finite value and its single precision representation.
+   */
+  struct PrecisionReport {
+
+    std::size_t values = 0;
+    std::size_t overflows = 0;
+    std::size_t inexact = 0;
+    double maxRelativeError = 0.;
+
+    /**
+     *  @brief Add the values of another report to this report
+     *
+     *  @param[in] report   the report to be added
+     */
+    void add( const PrecisionReport& report ) {
+
+      this->values += report.values;
+      this->overflows += report.overflows;
+      this->inexact += report.inexact;
+      this->maxRelativeError = std::max( this->maxRelativeError,
+                                         report.maxRelativeError );
+    }
+
+    /**
+     *  @brief Return the number of bytes saved by storing the values in
+     *         single precision
+     */
+    std::size_t savedMemory() const {
+
+      return this->values * ( sizeof( double ) - sizeof( float ) );
+    }
+  };
+
+} // ENDFtk namespace
+} // njoy namespace
+
+#endif
@@ -4,7 +4,7 @@
 // system includes
 
 // other includes
-#include "tools/Log.hpp"
+#include "ENDFtk/Log.hpp"
 #include "ENDFtk/record.hpp"
 
 namespace njoy {
@@ -146,7 +146,7 @@ namespace ENDFtk {
 
       if ( this->isHead() ) {
 
-        using Format = disco::Record< disco::ENDF, disco::ENDF,
+        using Format = disco::Record< record::RealFormatter, record::RealFormatter,
                                       disco::Integer< 11 >, disco::Integer< 11 >,
                                       disco::Integer< 11 >, disco::Integer< 11 >,
                                       disco::Integer< 4 >, disco::Integer< 2>,
@@ -2,16 +2,24 @@
 #define NJOY_ENDFTK_TABULATIONRECORD
 
 // system includes
+#include <memory_resource>
 #include <vector>
 
 // other includes
-#include "tools/Log.hpp"
+#include "ENDFtk/Log.hpp"
+#include "range/v3/algorithm/equal.hpp"
 #include "range/v3/view/all.hpp"
 #include "range/v3/view/iota.hpp"
 #include "range/v3/view/subrange.hpp"
 #include "range/v3/view/transform.hpp"
 #include "range/v3/view/zip.hpp"
+#include "ENDFtk/MemoryUsage.hpp"
+#include "ENDFtk/ParseError.hpp"
+#include "ENDFtk/ParseOptions.hpp"
 #include "ENDFtk/record.hpp"
+#include "ENDFtk/record/LazyValues.hpp"
+#include "ENDFtk/record/RealValues.hpp"
+#include "ENDFtk/record/StoredValues.hpp"
 
 namespace njoy {
 namespace ENDFtk {
@@ -28,28 +36,30 @@ namespace ENDFtk {
    */
   class TabulationRecord : protected record::InterpolationBase {
 
+    using Lazy = record::LazyValues< record::Real, record::Real >;
+
     /* fields */
-    std::vector< double > xValues;
-    std::vector< double > yValues;
+    record::StoredValues< double > xValues;
+    record::StoredValues< double > yValues;
+    std::pmr::vector< float > xFloats;
+    std::pmr::vector< float > yFloats;
+    Lazy lazy;
+    bool lossyOutput = false;
 
     /* helper methods */
     #include "ENDFtk/TabulationRecord/src/verifyVectorSizes.hpp"
     #include "ENDFtk/TabulationRecord/src/verifyXValuesAreSorted.hpp"
     #include "ENDFtk/TabulationRecord/src/verifyNP.hpp"
     #include "ENDFtk/TabulationRecord/src/readPairs.hpp"
+    #include "ENDFtk/TabulationRecord/src/decoded.hpp"
 
   protected:
 
     auto regions( size_t index ) const {
       const auto left = index ? this->boundaries()[ index - 1 ] - 1 : 0;
       const auto right = this->boundaries()[ index ];
-      return
-        std::make_pair( ranges::make_subrange
-                        ( this->xValues.begin() + left,
-                          this->xValues.begin() + right ),
-                        ranges::make_subrange
-                        ( this->yValues.begin() + left,
-                          this->yValues.begin() + right ) );
+      return std::make_pair( this->x().slice( left, right ),
+                             this->y().slice( left, right ) );
     }
 
   public:
@@ -66,24 +76,36 @@ namespace ENDFtk {
     /**
      *  @brief Return the number of points in the table
      */
-    long NP() const { return this->xValues.size(); }
+    long NP() const {
+
+      return this->lazy ? this->lazy.size()
+                        : this->xValues.size() + this->xFloats.size();
+    }
 
     using InterpolationBase::NR;
 
     /**
      *  @brief Return the x values in the table
+     *
+     *  Values stored in single precision are widened into an array owned by
+     *  the returned range, they are not retained by the record.
      */
-    auto x() const {
+    record::RealValues x() const {
 
-      return ranges::cpp20::views::all( this->xValues );
+      return this->isSinglePrecision() ? record::RealValues( this->xFloats )
+                                       : this->decodedX();
     }
 
     /**
      *  @brief Return the y values in the table
+     *
+     *  Values stored in single precision are widened into an array owned by
+     *  the returned range, they are not retained by the record.
      */
-    auto y() const {
+    record::RealValues y() const {
 
-      return ranges::cpp20::views::all( this->yValues );
+      return this->isSinglePrecision() ? record::RealValues( this->yFloats )
+                                       : this->decodedY();
     }
 
     /**
@@ -91,7 +113,47 @@ namespace ENDFtk {
      */
     auto pairs() const {
 
-      return ranges::views::zip( this->xValues, this->yValues );
+      return ranges::views::zip( this->x(), this->y() );
+    }
+
+    /**
+     *  @brief Return whether or not the values are stored in single precision
+     */
+    bool isSinglePrecision() const { return not this->xFloats.empty(); }
+
+    /**
+     *  @brief Return the x values stored in single precision
+     *
+     *  This range is empty unless the values are stored in single precision.
+     */
+    auto singlePrecisionX() const {
+
+      return ranges::cpp20::views::all( this->xFloats );
+    }
+
+    /**
+     *  @brief Return the y values stored in single precision
+     *
+     *  This range is empty unless the values are stored in single precision.
+     */
+    auto singlePrecisionY() const {
+
+      return ranges::cpp20::views::all( this->yFloats );
+    }
+
+    /**
+     *  @brief Return the memory used by the interpolation data and the
+     *         values, as they are stored
+     */
+    MemoryUsage memoryUsage() const {
+
+      MemoryUsage usage = record::InterpolationBase::memoryUsage();
+      usage += this->lazy.memoryUsage();
+      usage.add( this->xValues );
+      usage.add( this->yValues );
+      usage.add( this->xFloats );
+      usage.add( this->yFloats );
+      return usage;
     }
 
     using InterpolationBase::interpolants;
@@ -116,8 +178,8 @@ namespace ENDFtk {
     bool operator==( const TabulationRecord& rhs ) const {
 
         return ( InterpolationBase::operator==( static_cast<const InterpolationBase&>( rhs ) ) )
-        and ( this->xValues == rhs.xValues )
-        and ( this->yValues == rhs.yValues );
+        and ranges::equal( this->x(), rhs.x() )
+        and ranges::equal( this->y(), rhs.y() );
     }
 
     /**
@@ -9,6 +9,8 @@
 /**
  *  @brief Constructor
  *
+ *  The vectors holding the values are moved into the record.
+ *
  *  @param[in] C1             the double in column 1 on line 1
  *  @param[in] C2             the double in column 2 on line 1
  *  @param[in] L1             the integer in column 3 on line 1
@@ -37,6 +39,41 @@ TabulationRecord ( double C1, double C2, long L1, long L2,
     throw e;
   }
 
+/**
+ *  @brief Constructor (values in a std::pmr::vector)
+ *
+ *  The vectors holding the values are moved into the record, so that the
+ *  values remain allocated by their memory resource.
+ *
+ *  @param[in] C1             the double in column 1 on line 1
+ *  @param[in] C2             the double in column 2 on line 1
+ *  @param[in] L1             the integer in column 3 on line 1
+ *  @param[in] L2             the integer in column 4 on line 1
+ *  @param[in] boundaries     the interpolation range boundaries
+ *  @param[in] interpolants   the interpolation types for each range
+ *  @param[in] x              the x values
+ *  @param[in] y              the y values
+ */
+template< typename LongAllocator, typename DoubleAllocator >
+TabulationRecord ( double C1, double C2, long L1, long L2,
+                    std::vector< long, LongAllocator >&& boundaries,
+                    std::vector< long, LongAllocator >&& interpolants,
+                    std::vector< double, DoubleAllocator >&& x,
+                    std::vector< double, DoubleAllocator >&& y )
+  try : InterpolationBase( C1, C2, L1, L2, std::move( boundaries ),
+                           std::move( interpolants ) ),
+                           xValues( std::move( x ) ),
+                           yValues( std::move( y ) ) {
+
+    verifyXValuesAreSorted( this->xValues );
+    verifyVectorSizes( this->xValues, this->yValues );
+    verifyNP( this->boundaries().back(), this->xValues.size() );
+  }
+  catch ( std::exception& e ) {
+    Log::info( "Error encountered while constructing TAB1 record" );
+    throw e;
+  }
+
 /**
  *  @brief Constructor
  *
@@ -65,10 +102,20 @@ private:
  */
 TabulationRecord
 ( InterpolationBase&& interpolation,
-  std::tuple< std::vector< double >, std::vector< double > >&& points ) :
+  std::tuple< std::pmr::vector< double >,
+              std::pmr::vector< double > >&& points,
+  Lazy&& lazy ) :
   InterpolationBase( std::move( interpolation ) ),
   xValues( std::move( std::get<0>( points ) ) ),
-  yValues( std::move( std::get<1>( points ) ) ) {}
+  yValues( std::move( std::get<1>( points ) ) ),
+  xFloats( ParseOptions::active().singlePrecision
+           ? record::narrow( this->xValues )
+           : std::pmr::vector< float >() ),
+  yFloats( ParseOptions::active().singlePrecision
+           ? record::narrow( this->yValues )
+           : std::pmr::vector< float >() ),
+  lazy( std::move( lazy ) ),
+  lossyOutput( ParseOptions::active().lossyOutput ) {}
 
 /**
  *  @brief Private constructor
@@ -79,14 +126,25 @@ TabulationRecord
   Iterator& it, const Iterator& end, long& lineNumber,
   int MAT, int MF, int MT  ) :
   TabulationRecord( std::move( interpolation ),
-                    readPairs( interpolation.N2(), it, end,
-                               lineNumber, MAT, MF, MT ) ) {}
+                    Lazy::enabled< Iterator >()
+                    ? Lazy::Values()
+                    : readPairs( interpolation.N2(), it, end,
+                                 lineNumber, MAT, MF, MT ),
+                    Lazy::enabled< Iterator >()
+                    ? Lazy( interpolation.N2(), it, end,
+                            lineNumber, MAT, MF, MT )
+                    : Lazy() ) {}
 
 public:
 
 /**
  *  @brief Constructor (from a buffer)
  *
+ *  When lazy decoding is requested in the active parse options, the x and y
+ *  values are only decoded (and verified to be sorted) when they are
+ *  accessed. When single precision storage is requested, the x and y values
+ *  are stored as floats (see x() and singlePrecisionX()).
+ *
  *  @tparam Iterator        a buffer iterator
  *
  *  @param[in] it           the current position in the buffer
@@ -102,6 +160,7 @@ TabulationRecord( Iterator& it, const Iterator& end, long& lineNumber,
   try: TabulationRecord( InterpolationBase( it, end, lineNumber, MAT, MF, MT ),
                          it, end, lineNumber, MAT, MF, MT ) {}
   catch ( IllegalN2& e ) {
+    ParseError::Context::report( "TAB1", 5 );
     Log::error( "Illegal NP value encountered" );
     Log::info( "NP (or number of pairs) must be greater than or equal to 1" );
     Log::info( "NP value: {}", e.n2 );
@@ -109,17 +168,20 @@ TabulationRecord( Iterator& it, const Iterator& end, long& lineNumber,
     throw std::exception();
   }
   catch ( InconsistentN2& e ) {
+    ParseError::Context::report( "TAB1", 5 );
     Log::error( "Inconsistent value for NP" );
     Log::info( "Expected {} as the largest index but found {}", e.n2, e.index );
     Log::info( "Error encountered while parsing TAB1 record" );
     throw std::exception();
   }
   catch ( int nPosition ){
+    ParseError::Context::report( "TAB1", nPosition );
     Log::info( "Error in position {}", nPosition );
     Log::info( "Error encountered while parsing TAB1 record" );
     throw std::exception();
   }
   catch ( std::exception& e ) {
+    ParseError::Context::report( "TAB1" );
     Log::info( "Error encountered while parsing TAB1 record" );
     throw e;
   }
@@ -0,0 +1,30 @@
+/**
+ *  @brief Return the decoded values, decoding them if required
+ */
+const Lazy::Values& decoded() const {
+
+  return this->lazy.values( [] ( const Lazy::Values& values ) {
+
+    verifyXValuesAreSorted( std::get< 0 >( values ) );
+  } );
+}
+
+/**
+ *  @brief Return the x values stored in double precision, decoding them if
+ *         required
+ */
+record::RealValues decodedX() const {
+
+  return this->lazy ? record::RealValues( std::get< 0 >( this->decoded() ) )
+                    : record::RealValues( this->xValues );
+}
+
+/**
+ *  @brief Return the y values stored in double precision, decoding them if
+ *         required
+ */
+record::RealValues decodedY() const {
+
+  return this->lazy ? record::RealValues( std::get< 1 >( this->decoded() ) )
+                    : record::RealValues( this->yValues );
+}
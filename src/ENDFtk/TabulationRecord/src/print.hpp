@@ -1,6 +1,9 @@
 /**
  *  @brief Print the record
  *
+ *  Values stored in single precision are only printed when lossy output was
+ *  allowed in the parse options that were active when the record was read.
+ *
  *  @tparam OutputIterator   an output iterator
  *
  *  @param[in] it            the current position in the output
@@ -10,21 +13,40 @@
  */
 template< typename OutputIterator >
 void print( OutputIterator& it, int MAT, int MF, int MT ) const {
+  if ( this->isSinglePrecision() ){
+    record::verifyLossyOutput( this->lossyOutput );
+  }
   record::InterpolationBase::print( it, MAT, MF, MT );
 
-  using Format = disco::Record< disco::ENDF, disco::ENDF,
-                                disco::ENDF, disco::ENDF,
-                                disco::ENDF, disco::ENDF,
+  using Format = disco::Record< record::RealFormatter, record::RealFormatter,
+                                record::RealFormatter, record::RealFormatter,
+                                record::RealFormatter, record::RealFormatter,
                                 disco::Integer< 4 >, disco::Integer< 2 >,
                                 disco::Integer< 3 >, disco::ColumnPosition< 5 > >;
 
   auto nFullLines = this->NP() / 3;
   auto partialLineEntries = this->NP() - nFullLines * 3;
 
-  auto x = this->x().begin();
-  auto y = this->y().begin();
+  const auto xs = this->x();
+  const auto ys = this->y();
+  auto x = xs.begin();
+  auto y = ys.begin();
+
+  // full lines are formatted in a line buffer, the tail is only formatted once
+  char line[ 81 ];
+  if ( record::Tail( MAT, MF, MT ).format( line + 66 ) ){
+    for ( ; nFullLines > 0; --nFullLines ){
+      char* position = line;
+      for ( int index = 0; index < 3; ++index ){
+        position = record::RealFormatter::write( x[index], position );
+        position = record::RealFormatter::write( y[index], position );
+      }
+      it = std::copy( line, line + 81, it );
+      x += 3; y += 3;
+    }
+  }
 
-  while ( nFullLines-- ){
+  for ( ; nFullLines > 0; --nFullLines ){
     Format::write( it, x[0], y[0], x[1], y[1], x[2], y[2], MAT, MF, MT );
     x += 3; y += 3;
   }
@@ -32,8 +54,8 @@ void print( OutputIterator& it, int MAT, int MF, int MT ) const {
   if ( partialLineEntries ){
     auto blankEntries = 2 * ( 3 - partialLineEntries );
     while ( partialLineEntries-- ){
-      disco::ENDF::write( *x, it );
-      disco::ENDF::write( *y, it );
+      record::RealFormatter::write( *x, it );
+      record::RealFormatter::write( *y, it );
       ++x; ++y;
     }
 
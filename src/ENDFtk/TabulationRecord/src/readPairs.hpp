@@ -1,14 +1,14 @@
 template< typename Iterator >
-static std::tuple< std::vector< double >, std::vector< double > >
+static std::tuple< std::pmr::vector< double >, std::pmr::vector< double > >
 readPairs
 ( long nPairs, Iterator& it, const Iterator& end, long& lineNumber,
   int MAT, int MF, int MT ){
-  std::tuple< std::vector< double >, std::vector< double > > result;
   try{
     
-    result = record::Zipper::unzip
-             < record::Real, record::Real >
-             ( nPairs, it, end, lineNumber, MAT, MF, MT );
+    auto result = record::Zipper::unzip
+                  < record::Real, record::Real >
+                  ( ParseOptions::activeMemoryResource(),
+                    nPairs, it, end, lineNumber, MAT, MF, MT );
     auto& xValues = std::get< 0 >( result );
     verifyXValuesAreSorted( xValues );
     return result;
@@ -1,6 +1,6 @@
+template< typename Values >
 static void
-verifyVectorSizes( const std::vector< double >& xValues,
-                   const std::vector< double >& yValues ) {
+verifyVectorSizes( const Values& xValues, const Values& yValues ) {
   const bool mismatchedEvaluationVectorLengths =
     ( xValues.size() != yValues.size() );
     
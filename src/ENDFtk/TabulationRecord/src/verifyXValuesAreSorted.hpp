@@ -1,5 +1,8 @@
+template< typename Values >
 static void
-verifyXValuesAreSorted( const std::vector< double >& xValues ){
+verifyXValuesAreSorted( const Values& xValues ){
+  if ( not ParseOptions::active().verifySorted ){ return; }
+
   auto xValuesIterator = std::is_sorted_until( xValues.begin(), xValues.end() );
   const bool xValuesAreSorted = ( xValuesIterator == xValues.end() );
     
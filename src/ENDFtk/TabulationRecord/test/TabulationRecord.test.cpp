@@ -7,6 +7,7 @@ using Catch::Matchers::WithinRel;
 #include "ENDFtk/TabulationRecord.hpp"
 
 // other includes
+#include <memory_resource>
 
 // convenience typedefs
 using namespace njoy::ENDFtk;
@@ -61,6 +62,39 @@ SCENARIO( "TabulationRecord" ) {
       } // THEN
     } // WHEN
 
+    WHEN( "the data is given explicitly in std::vector or std::pmr::vector" ) {
+
+      std::pmr::monotonic_buffer_resource resource;
+      std::vector< double > x = { 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0 };
+      std::vector< double > y = { 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, 10.0 };
+      std::pmr::vector< long > pmrBoundaries( { 4, 5, 6, 8 }, &resource );
+      std::pmr::vector< long > pmrInterpolants( { 1, 2, 3, 5 }, &resource );
+      std::pmr::vector< double > pmrX( x.begin(), x.end(), &resource );
+      std::pmr::vector< double > pmrY( y.begin(), y.end(), &resource );
+      const double* xValues = x.data();
+      const double* yValues = y.data();
+      const double* pmrXValues = pmrX.data();
+      const double* pmrYValues = pmrY.data();
+
+      TabulationRecord chunk( 1., 2., 3, 4, { 4, 5, 6, 8 }, { 1, 2, 3, 5 },
+                              std::move( x ), std::move( y ) );
+      TabulationRecord pmrChunk( 1., 2., 3, 4,
+                                 std::move( pmrBoundaries ),
+                                 std::move( pmrInterpolants ),
+                                 std::move( pmrX ),
+                                 std::move( pmrY ) );
+
+      THEN( "the values are moved into the record without a copy" ) {
+
+        verifyChunk( chunk );
+        verifyChunk( pmrChunk );
+        CHECK( xValues == chunk.x().begin() );
+        CHECK( yValues == chunk.y().begin() );
+        CHECK( pmrXValues == pmrChunk.x().begin() );
+        CHECK( pmrYValues == pmrChunk.y().begin() );
+      } // THEN
+    } // WHEN
+
     WHEN( "the data is read from a string/stream" ) {
 
       auto begin = string.begin();
@@ -83,6 +117,108 @@ SCENARIO( "TabulationRecord" ) {
         CHECK( buffer == string );
       } // THEN
     } // WHEN
+
+    WHEN( "the data is read from a string/stream using lazy decoding" ) {
+
+      auto begin = string.begin();
+      auto end = string.end();
+      long lineNumber = 1;
+
+      ParseOptions options;
+      options.lazy = true;
+      TabulationRecord chunk = [&] {
+
+        ParseOptions::Scope scope( options );
+        return TabulationRecord( begin, end, lineNumber, 125, 3, 102 );
+      }();
+
+      THEN( "the lines are consumed and members can be tested" ) {
+
+        CHECK( end == begin );
+        CHECK( 7 == lineNumber );
+        verifyChunk( chunk );
+      } // THEN
+
+      THEN( "it can be printed" ) {
+
+        std::string buffer;
+        auto output = std::back_inserter( buffer );
+        chunk.print( output, 125, 3, 102 );
+
+        CHECK( buffer == string );
+      } // THEN
+    } // WHEN
+
+    WHEN( "the data is read from a string/stream using single precision "
+          "storage" ) {
+
+      auto begin = string.begin();
+      auto end = string.end();
+      long lineNumber = 1;
+
+      PrecisionReport report;
+      ParseOptions options;
+      options.singlePrecision = true;
+      options.precisionReport = &report;
+      TabulationRecord chunk = [&] {
+
+        ParseOptions::Scope scope( options );
+        return TabulationRecord( begin, end, lineNumber, 125, 3, 102 );
+      }();
+
+      THEN( "the values are narrowed and members can be tested" ) {
+
+        CHECK( end == begin );
+        CHECK( 7 == lineNumber );
+        CHECK( true == chunk.isSinglePrecision() );
+        CHECK( 16 == report.values );
+        CHECK( 0 == report.overflows );
+        CHECK( 0 == report.inexact );
+        CHECK( 16 * 4 == report.savedMemory() );
+        CHECK( 0. == report.maxRelativeError );
+        CHECK( 8 == chunk.singlePrecisionX().size() );
+        CHECK( 8 == chunk.singlePrecisionY().size() );
+        verifyChunk( chunk );
+      } // THEN
+
+      THEN( "the double precision values are not retained after access" ) {
+
+        CHECK( 8 == chunk.x().size() );
+        CHECK( 8 == chunk.y().size() );
+        CHECK( 8 == chunk.pairs().size() );
+        CHECK( 16 * 4 == chunk.memoryUsage().doubles );
+      } // THEN
+
+      THEN( "it can only be printed when lossy output was allowed when it "
+            "was read" ) {
+
+        std::string buffer;
+        auto output = std::back_inserter( buffer );
+        CHECK_THROWS( chunk.print( output, 125, 3, 102 ) );
+
+        ParseOptions lossy;
+        lossy.lossyOutput = true;
+        {
+          ParseOptions::Scope scope( lossy );
+          buffer.clear();
+          CHECK_THROWS( chunk.print( output, 125, 3, 102 ) );
+        }
+
+        lossy.singlePrecision = true;
+        auto position = string.begin();
+        auto last = string.end();
+        long line = 1;
+        TabulationRecord allowed = [&] {
+
+          ParseOptions::Scope scope( lossy );
+          return TabulationRecord( position, last, line, 125, 3, 102 );
+        }();
+
+        buffer.clear();
+        allowed.print( output, 125, 3, 102 );
+        CHECK( buffer == string );
+      } // THEN
+    } // WHEN
   } // GIVEN
 
   GIVEN( "different TabulationRecord" ) {
@@ -216,6 +352,30 @@ SCENARIO( "TabulationRecord" ) {
       } // THEN
     } // WHEN
 
+    WHEN( "a string representation has out of order x values and lazy "
+          "decoding is used" ) {
+
+      std::string string = chunkWithOutOfOrderXValues();
+      auto begin = string.begin();
+      auto end = string.end();
+      long lineNumber = 1;
+
+      ParseOptions options;
+      options.lazy = true;
+      TabulationRecord chunk = [&] {
+
+        ParseOptions::Scope scope( options );
+        return TabulationRecord( begin, end, lineNumber, 125, 3, 102 );
+      }();
+
+      THEN( "an exception is thrown when the values are accessed" ) {
+
+        CHECK( 8 == chunk.NP() );
+        CHECK_THROWS( chunk.x() );
+        CHECK_THROWS( chunk.y() );
+      } // THEN
+    } // WHEN
+
     WHEN( "a string representation has inconsistent NP values" ) {
 
       std::string string = chunkWithInconsistentNP();
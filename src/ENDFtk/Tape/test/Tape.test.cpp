@@ -1,5 +1,6 @@
 // include Catch2
 #include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
 
 // what we are testing
 #include "ENDFtk/Tape.hpp"
@@ -65,6 +66,30 @@ SCENARIO( "Testing Tape" ) {
   } // GIVEN
 } // SCENARIO
 
+TEST_CASE( "Tape round trip", "[.][benchmark]" ) {
+
+  std::string tapestring = chunk();
+  tree::Tape tree( tapestring );
+  Tape tape = tree.parse();
+
+  BENCHMARK( "parse and print" ) {
+
+    Tape parsed = tree::Tape( tapestring ).parse();
+    std::string buffer;
+    auto output = std::back_inserter( buffer );
+    parsed.print( output );
+    return buffer;
+  };
+
+  BENCHMARK( "print" ) {
+
+    std::string buffer;
+    auto output = std::back_inserter( buffer );
+    tape.print( output );
+    return buffer;
+  };
+}
+
 std::string chunk() {
 
   return
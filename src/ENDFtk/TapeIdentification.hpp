@@ -4,7 +4,8 @@
 // system includes
 
 // other includes
-#include "tools/Log.hpp"
+#include "ENDFtk/Log.hpp"
+#include "ENDFtk/ParseError.hpp"
 #include "ENDFtk/record.hpp"
 
 namespace njoy {
@@ -68,11 +69,13 @@ namespace ENDFtk {
       try: base( it, end ), tail( 0, 0, it, end, lineNumber ) {}
       catch ( std::exception& e ) {
 
+        ParseError::Context::report( "TPID" );
         Log::info( "Encountered trouble when reading TapeIdentification" );
         throw e;
       }
       catch ( int fieldNo ) {
 
+        ParseError::Context::report( "TPID", fieldNo );
         --lineNumber;
         /* TODO error information here */
         throw std::exception();
@@ -4,6 +4,8 @@
 // system includes
 
 // other includes
+#include "ENDFtk/MemoryUsage.hpp"
+#include "ENDFtk/ParseError.hpp"
 #include "ENDFtk/record.hpp"
 
 namespace njoy {
@@ -29,11 +31,13 @@ namespace ENDFtk {
       }
       catch ( std::exception& e ) {
 
+        ParseError::Context::report( "TEXT" );
         /* TODO error information here */
         throw e;
       }
       catch ( int fieldNo ) {
 
+        ParseError::Context::report( "TEXT", fieldNo );
         --lineNumber;
         /* TODO error information here */
         throw std::exception();
@@ -74,6 +78,16 @@ namespace ENDFtk {
      */
     static constexpr long NC() { return 1; }
 
+    /**
+     *  @brief Return the memory used by the text
+     */
+    MemoryUsage memoryUsage() const {
+
+      MemoryUsage usage;
+      usage.add( this->text() );
+      return usage;
+    }
+
     #include "ENDFtk/TextRecord/src/print.hpp"
   };
 
@@ -0,0 +1,7 @@
+#include "ENDFtk/binary/Format.hpp"
+#include "ENDFtk/binary/Codec.hpp"
+#include "ENDFtk/binary/Writer.hpp"
+#include "ENDFtk/binary/Reader.hpp"
+#include "ENDFtk/binary/Codec/3.hpp"
+#include "ENDFtk/binary/Codec/6.hpp"
+#include "ENDFtk/binary/Codec/7/4.hpp"
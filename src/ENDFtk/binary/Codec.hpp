@@ -0,0 +1,42 @@
+#ifndef NJOY_ENDFTK_BINARY_CODEC
+#define NJOY_ENDFTK_BINARY_CODEC
+
+// system includes
+
+// other includes
+
+namespace njoy {
+namespace ENDFtk {
+namespace binary {
+
+  /**
+   *  @class
+   *  @brief The native binary encoding of a parsed section
+   *
+   *  Sections for which this class is not specialised have no native
+   *  encoding and are stored as ENDF text. Only the MF3 sections, the MF6
+   *  sections and the MF7 MT4 section have a native encoding (see
+   *  ENDFtk/binary.hpp), every other section (e.g. MF2, MF4, MF5, MF12 to
+   *  MF15 or the covariance files) is stored as text and is parsed again
+   *  when it is read, so that reading it is not faster than parsing the
+   *  original ENDF file. A specialisation with a native
+   *  encoding defines:
+   *    - static constexpr bool native = true
+   *    - static bool accepts( int MT ), whether or not the codec can read
+   *      a section with the given MT number
+   *    - static void write( Writer&, const Section& ), writing the content of
+   *      the section (the MT number is written by the Writer)
+   *    - static Section read( Reader&, int MT ), reading the content written
+   *      by the write() function
+   */
+  template< typename Section >
+  struct Codec {
+
+    static constexpr bool native = false;
+  };
+
+} // binary namespace
+} // ENDFtk namespace
+} // njoy namespace
+
+#endif
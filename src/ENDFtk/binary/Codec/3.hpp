@@ -0,0 +1,83 @@
+#ifndef NJOY_ENDFTK_BINARY_CODEC_3
+#define NJOY_ENDFTK_BINARY_CODEC_3
+
+// system includes
+
+// other includes
+#include "ENDFtk/section/3.hpp"
+#include "ENDFtk/binary/Codec.hpp"
+#include "ENDFtk/binary/Writer.hpp"
+#include "ENDFtk/binary/Reader.hpp"
+
+namespace njoy {
+namespace ENDFtk {
+namespace binary {
+
+  /**
+   *  @class
+   *  @brief The native binary encoding of an MF3 section
+   *
+   *  The ZA, AWR, QM, QI and LR values are followed by the interpolation
+   *  boundaries and interpolants, the energies and the cross sections.
+   */
+  template<>
+  struct Codec< section::Type< 3 > > {
+
+    static constexpr bool native = true;
+
+    /**
+     *  @brief Return whether or not a section can be read by this codec
+     *
+     *  @param[in] MT   the MT number of the section
+     */
+    static bool accepts( int ) { return true; }
+
+    /**
+     *  @brief Write the content of the section
+     *
+     *  @param[in,out] writer    the binary writer
+     *  @param[in]     section   the section to be written
+     */
+    static void write( Writer& writer, const section::Type< 3 >& section ) {
+
+      writer.integer( section.ZA() );
+      writer.real( section.AWR() );
+      writer.real( section.QM() );
+      writer.real( section.QI() );
+      writer.integer( section.LR() );
+      writer.integers( section.boundaries() );
+      writer.integers( section.interpolants() );
+      writer.reals( section.energies() );
+      writer.reals( section.crossSections() );
+    }
+
+    /**
+     *  @brief Read the content of the section
+     *
+     *  @param[in,out] reader   the binary reader
+     *  @param[in]     MT       the MT number of the section
+     */
+    static section::Type< 3 > read( Reader& reader, int MT ) {
+
+      const int za = reader.integer();
+      const double awr = reader.real();
+      const double qm = reader.real();
+      const double qi = reader.real();
+      const long lr = reader.integer();
+      auto boundaries = reader.integers();
+      auto interpolants = reader.integers();
+      auto energies = reader.reals();
+      auto xs = reader.reals();
+
+      return section::Type< 3 >( MT, za, awr, qm, qi, lr,
+                                 std::move( boundaries ),
+                                 std::move( interpolants ),
+                                 std::move( energies ), std::move( xs ) );
+    }
+  };
+
+} // binary namespace
+} // ENDFtk namespace
+} // njoy namespace
+
+#endif
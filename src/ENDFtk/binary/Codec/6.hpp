@@ -0,0 +1,627 @@
+#ifndef NJOY_ENDFTK_BINARY_CODEC_6
+#define NJOY_ENDFTK_BINARY_CODEC_6
+
+// system includes
+#include <algorithm>
+#include <array>
+#include <vector>
+
+// other includes
+#include "range/v3/iterator/operations.hpp"
+#include "ENDFtk/section/6.hpp"
+#include "ENDFtk/binary/Codec.hpp"
+#include "ENDFtk/binary/Writer.hpp"
+#include "ENDFtk/binary/Reader.hpp"
+
+namespace njoy {
+namespace ENDFtk {
+namespace binary {
+
+  /**
+   *  @class
+   *  @brief The native binary encoding of an MF6 section
+   *
+   *  The ZA, AWR, JP and LCT values are followed by the reaction products.
+   *  Each reaction product consists of its multiplicity (which includes the
+   *  LAW number) and the distribution data for that LAW. Components that
+   *  consist of a sequence of alternatives (e.g. the subsections for each
+   *  incident energy of LAW=1) are preceded by the index of the alternative.
+   */
+  template<>
+  struct Codec< section::Type< 6 > > {
+
+    using Section = section::Type< 6 >;
+    using ReactionProduct = Section::ReactionProduct;
+    using Multiplicity = Section::Multiplicity;
+    using Distribution = Section::Distribution;
+    using ContinuumEnergyAngle = Section::ContinuumEnergyAngle;
+    using DiscreteTwoBodyScattering = Section::DiscreteTwoBodyScattering;
+    using ChargedParticleElasticScattering =
+              Section::ChargedParticleElasticScattering;
+    using LaboratoryAngleEnergy = Section::LaboratoryAngleEnergy;
+
+    static constexpr bool native = true;
+
+    /**
+     *  @brief Return whether or not a section can be read by this codec
+     *
+     *  @param[in] MT   the MT number of the section
+     */
+    static bool accepts( int ) { return true; }
+
+    /**
+     *  @brief Write the content of the section
+     *
+     *  @param[in,out] writer    the binary writer
+     *  @param[in]     section   the section to be written
+     */
+    static void write( Writer& writer, const Section& section ) {
+
+      writer.integer( section.ZA() );
+      writer.real( section.AWR() );
+      writer.integer( section.JP() );
+      writer.integer( section.LCT() );
+      writer.integer( section.NK() );
+      for ( const auto& product : section.reactionProducts() ) {
+
+        writeMultiplicity( writer, product.multiplicity() );
+        writeDistribution( writer, product.distribution() );
+      }
+    }
+
+    /**
+     *  @brief Read the content of the section
+     *
+     *  @param[in,out] reader   the binary reader
+     *  @param[in]     MT       the MT number of the section
+     */
+    static Section read( Reader& reader, int MT ) {
+
+      const int za = reader.integer();
+      const double awr = reader.real();
+      const long jp = reader.integer();
+      const long lct = reader.integer();
+      const long nk = reader.integer();
+
+      std::vector< ReactionProduct > products;
+      for ( long i = 0; i < nk; ++i ) {
+
+        auto multiplicity = readMultiplicity( reader );
+        auto distribution = readDistribution( reader, multiplicity.LAW() );
+        products.emplace_back( std::move( multiplicity ),
+                               std::move( distribution ) );
+      }
+
+      return Section( MT, za, awr, jp, lct, std::move( products ) );
+    }
+
+  private:
+
+    /* auxiliary functions */
+
+    template< typename Range >
+    static void writeRows( Writer& writer, Range&& rows ) {
+
+      writer.integer( ranges::distance( rows ) );
+      for ( auto&& row : rows ) {
+
+        writer.reals( row );
+      }
+    }
+
+    static std::vector< std::vector< double > > readRows( Reader& reader ) {
+
+      const long size = reader.integer();
+      std::vector< std::vector< double > > rows;
+      for ( long i = 0; i < size; ++i ) {
+
+        rows.emplace_back( reader.reals() );
+      }
+      return rows;
+    }
+
+    template< std::size_t N >
+    static std::vector< std::array< double, N > >
+    combine( const std::vector< double >& energies,
+             const std::vector< std::vector< double > >& parameters ) {
+
+      std::vector< std::array< double, N > > data;
+      for ( std::size_t i = 0; i < energies.size(); ++i ) {
+
+        if ( ( parameters.size() != energies.size() ) ||
+             ( parameters[i].size() != N - 1 ) ) {
+
+          Log::error( "Found inconsistent Kalbach-Mann data in the binary "
+                      "stream" );
+          throw std::exception();
+        }
+
+        std::array< double, N > entry;
+        entry[0] = energies[i];
+        std::copy( parameters[i].begin(), parameters[i].end(),
+                   entry.begin() + 1 );
+        data.push_back( entry );
+      }
+      return data;
+    }
+
+    static void writeMultiplicity( Writer& writer,
+                                   const Multiplicity& multiplicity ) {
+
+      writer.integer( multiplicity.ZAP() );
+      writer.real( multiplicity.AWP() );
+      writer.integer( multiplicity.LIP() );
+      writer.integer( multiplicity.LAW() );
+      writer.integers( multiplicity.boundaries() );
+      writer.integers( multiplicity.interpolants() );
+      writer.reals( multiplicity.energies() );
+      writer.reals( multiplicity.multiplicities() );
+    }
+
+    static Multiplicity readMultiplicity( Reader& reader ) {
+
+      const int zap = reader.integer();
+      const double awp = reader.real();
+      const long lip = reader.integer();
+      const long law = reader.integer();
+      auto boundaries = reader.integers();
+      auto interpolants = reader.integers();
+      auto energies = reader.reals();
+      auto multiplicities = reader.reals();
+
+      return Multiplicity( zap, awp, lip, law,
+                           std::move( boundaries ), std::move( interpolants ),
+                           std::move( energies ), std::move( multiplicities ) );
+    }
+
+    static void writeDistribution( Writer& writer,
+                                   const Distribution& distribution ) {
+
+      std::visit( [&] ( const auto& law ) { write( writer, law ); },
+                  distribution );
+    }
+
+    static Distribution readDistribution( Reader& reader, int LAW ) {
+
+      switch ( LAW ) {
+
+        case 0 : return Section::Unknown();
+        case 1 : return readContinuumEnergyAngle( reader );
+        case 2 : return readDiscreteTwoBodyScattering( reader );
+        case 3 : return Section::IsotropicDiscreteEmission();
+        case 4 : return Section::DiscreteTwoBodyRecoils();
+        case 5 : return readChargedParticleElasticScattering( reader );
+        case 6 : {
+
+          const double apsx = reader.real();
+          const long npsx = reader.integer();
+          return Section::NBodyPhaseSpace( apsx, npsx );
+        }
+        case 7 : return readLaboratoryAngleEnergy( reader );
+        default : return Section::DefinedElsewhere( LAW );
+      }
+    }
+
+    /* LAW<0, LAW=0, LAW=3 and LAW=4 have no data */
+    static void write( Writer&, const Section::DefinedElsewhere& ) {}
+    static void write( Writer&, const Section::Unknown& ) {}
+    static void write( Writer&, const Section::IsotropicDiscreteEmission& ) {}
+    static void write( Writer&, const Section::DiscreteTwoBodyRecoils& ) {}
+
+    /* LAW=1 */
+    static void write( Writer& writer, const ContinuumEnergyAngle& law ) {
+
+      writer.integer( law.LEP() );
+      writer.integers( law.boundaries() );
+      writer.integers( law.interpolants() );
+      writer.integer( law.NE() );
+      for ( const auto& entry : law.distributions() ) {
+
+        writer.integer( entry.index() );
+        std::visit( [&] ( const auto& value ) { write( writer, value ); },
+                    entry );
+      }
+    }
+
+    static void write( Writer& writer,
+                       const ContinuumEnergyAngle::LegendreCoefficients&
+                           entry ) {
+
+      writer.real( entry.E() );
+      writer.integer( entry.ND() );
+      writer.integer( entry.NA() );
+      writer.reals( entry.EP() );
+      writeRows( writer, entry.coefficients() );
+    }
+
+    static void write( Writer& writer,
+                       const ContinuumEnergyAngle::KalbachMann& entry ) {
+
+      writer.real( entry.E() );
+      writer.integer( entry.ND() );
+      writer.integer( entry.NA() );
+      writer.reals( entry.EP() );
+      writeRows( writer, entry.parameters() );
+    }
+
+    static void write( Writer& writer,
+                       const ContinuumEnergyAngle::ThermalScatteringData&
+                           entry ) {
+
+      writer.real( entry.E() );
+      writer.integer( entry.N2() );
+      writer.reals( entry.data() );
+    }
+
+    static void write( Writer& writer,
+                       const ContinuumEnergyAngle::TabulatedDistribution&
+                           entry ) {
+
+      writer.integer( entry.LANG() );
+      writer.real( entry.E() );
+      writer.integer( entry.ND() );
+      writer.integer( entry.NA() );
+      writer.reals( entry.EP() );
+      writer.reals( entry.F0() );
+      writeRows( writer, entry.MU() );
+      writeRows( writer, entry.F() );
+    }
+
+    static ContinuumEnergyAngle readContinuumEnergyAngle( Reader& reader ) {
+
+      using Variant = ContinuumEnergyAngle::Variant;
+
+      const long lep = reader.integer();
+      auto boundaries = reader.integers();
+      auto interpolants = reader.integers();
+      const long ne = reader.integer();
+
+      std::vector< Variant > distributions;
+      for ( long i = 0; i < ne; ++i ) {
+
+        const long index = reader.integer();
+        switch ( index ) {
+
+          case 0 : {
+
+            const double energy = reader.real();
+            const long nd = reader.integer();
+            const long na = reader.integer();
+            auto energies = reader.reals();
+            auto coefficients = readRows( reader );
+            distributions.emplace_back(
+              ContinuumEnergyAngle::LegendreCoefficients(
+                energy, nd, na, std::move( energies ),
+                std::move( coefficients ) ) );
+            break;
+          }
+          case 1 : {
+
+            const double energy = reader.real();
+            const long nd = reader.integer();
+            const long na = reader.integer();
+            auto energies = reader.reals();
+            auto parameters = readRows( reader );
+            if ( na == 1 ) {
+
+              distributions.emplace_back(
+                ContinuumEnergyAngle::KalbachMann(
+                  energy, nd, combine< 3 >( energies, parameters ) ) );
+            }
+            else {
+
+              distributions.emplace_back(
+                ContinuumEnergyAngle::KalbachMann(
+                  energy, nd, combine< 4 >( energies, parameters ) ) );
+            }
+            break;
+          }
+          case 2 : {
+
+            const double energy = reader.real();
+            const int n2 = reader.integer();
+            auto data = reader.reals();
+            distributions.emplace_back(
+              ContinuumEnergyAngle::ThermalScatteringData(
+                energy, n2, std::move( data ) ) );
+            break;
+          }
+          case 3 : {
+
+            const int lang = reader.integer();
+            const double energy = reader.real();
+            const long nd = reader.integer();
+            const long na = reader.integer();
+            auto energies = reader.reals();
+            auto emissions = reader.reals();
+            auto cosines = readRows( reader );
+            auto probabilities = readRows( reader );
+            distributions.emplace_back(
+              ContinuumEnergyAngle::TabulatedDistribution(
+                lang, energy, nd, na, std::move( energies ),
+                std::move( emissions ), std::move( cosines ),
+                std::move( probabilities ) ) );
+            break;
+          }
+          default : unknownAlternative( "LAW=1", index );
+        }
+      }
+
+      return ContinuumEnergyAngle( lep, std::move( boundaries ),
+                                   std::move( interpolants ),
+                                   std::move( distributions ) );
+    }
+
+    /* LAW=2 */
+    static void write( Writer& writer, const DiscreteTwoBodyScattering& law ) {
+
+      writer.integers( law.boundaries() );
+      writer.integers( law.interpolants() );
+      writer.integer( law.NE() );
+      for ( const auto& entry : law.distributions() ) {
+
+        writer.integer( entry.index() );
+        std::visit( [&] ( const auto& value ) { write( writer, value ); },
+                    entry );
+      }
+    }
+
+    static void write( Writer& writer,
+                       const DiscreteTwoBodyScattering::LegendreCoefficients&
+                           entry ) {
+
+      writer.real( entry.E() );
+      writer.reals( entry.coefficients() );
+    }
+
+    static void write( Writer& writer,
+                       const DiscreteTwoBodyScattering::TabulatedDistribution&
+                           entry ) {
+
+      writer.real( entry.E() );
+      writer.integer( entry.LANG() );
+      writer.reals( entry.cosines() );
+      writer.reals( entry.probabilities() );
+    }
+
+    static DiscreteTwoBodyScattering
+    readDiscreteTwoBodyScattering( Reader& reader ) {
+
+      using Variant = DiscreteTwoBodyScattering::Variant;
+
+      auto boundaries = reader.integers();
+      auto interpolants = reader.integers();
+      const long ne = reader.integer();
+
+      std::vector< Variant > distributions;
+      for ( long i = 0; i < ne; ++i ) {
+
+        const long index = reader.integer();
+        switch ( index ) {
+
+          case 0 : {
+
+            const double energy = reader.real();
+            auto coefficients = reader.reals();
+            distributions.emplace_back(
+              DiscreteTwoBodyScattering::LegendreCoefficients(
+                energy, std::move( coefficients ) ) );
+            break;
+          }
+          case 1 : {
+
+            const double energy = reader.real();
+            const int lang = reader.integer();
+            auto cosines = reader.reals();
+            auto probabilities = reader.reals();
+            distributions.emplace_back(
+              DiscreteTwoBodyScattering::TabulatedDistribution(
+                energy, lang, std::move( cosines ),
+                std::move( probabilities ) ) );
+            break;
+          }
+          default : unknownAlternative( "LAW=2", index );
+        }
+      }
+
+      return DiscreteTwoBodyScattering( std::move( boundaries ),
+                                        std::move( interpolants ),
+                                        std::move( distributions ) );
+    }
+
+    /* LAW=5 */
+    static void write( Writer& writer,
+                       const ChargedParticleElasticScattering& law ) {
+
+      writer.real( law.SPI() );
+      writer.integer( law.LIDP() );
+      writer.integers( law.boundaries() );
+      writer.integers( law.interpolants() );
+      writer.integer( law.NE() );
+      for ( const auto& entry : law.distributions() ) {
+
+        writer.integer( entry.index() );
+        std::visit( [&] ( const auto& value ) { write( writer, value ); },
+                    entry );
+      }
+    }
+
+    static void
+    write( Writer& writer,
+           const ChargedParticleElasticScattering::NuclearAmplitudeExpansion&
+               entry ) {
+
+      writer.real( entry.E() );
+      writer.integer( entry.NL() );
+      writer.reals( entry.B() );
+      writer.reals( entry.AR() );
+      writer.reals( entry.AI() );
+    }
+
+    static void
+    write( Writer& writer,
+           const ChargedParticleElasticScattering::LegendreCoefficients&
+               entry ) {
+
+      writer.real( entry.E() );
+      writer.reals( entry.coefficients() );
+    }
+
+    static void
+    write( Writer& writer,
+           const ChargedParticleElasticScattering::NuclearPlusInterference&
+               entry ) {
+
+      writer.real( entry.E() );
+      writer.integer( entry.LTP() );
+      writer.reals( entry.cosines() );
+      writer.reals( entry.probabilities() );
+    }
+
+    static ChargedParticleElasticScattering
+    readChargedParticleElasticScattering( Reader& reader ) {
+
+      using Variant = ChargedParticleElasticScattering::Variant;
+
+      const double spin = reader.real();
+      const long lidp = reader.integer();
+      auto boundaries = reader.integers();
+      auto interpolants = reader.integers();
+      const long ne = reader.integer();
+
+      std::vector< Variant > distributions;
+      for ( long i = 0; i < ne; ++i ) {
+
+        const long index = reader.integer();
+        switch ( index ) {
+
+          case 0 : {
+
+            const double energy = reader.real();
+            const int nl = reader.integer();
+            auto b = reader.reals();
+            auto real = reader.reals();
+            auto imaginary = reader.reals();
+            distributions.emplace_back(
+              ChargedParticleElasticScattering::NuclearAmplitudeExpansion(
+                energy, nl, std::move( b ), std::move( real ),
+                std::move( imaginary ) ) );
+            break;
+          }
+          case 1 : {
+
+            const double energy = reader.real();
+            auto coefficients = reader.reals();
+            distributions.emplace_back(
+              ChargedParticleElasticScattering::LegendreCoefficients(
+                energy, std::move( coefficients ) ) );
+            break;
+          }
+          case 2 : {
+
+            const double energy = reader.real();
+            const long ltp = reader.integer();
+            auto cosines = reader.reals();
+            auto probabilities = reader.reals();
+            distributions.emplace_back(
+              ChargedParticleElasticScattering::NuclearPlusInterference(
+                energy, ltp, std::move( cosines ),
+                std::move( probabilities ) ) );
+            break;
+          }
+          default : unknownAlternative( "LAW=5", index );
+        }
+      }
+
+      return ChargedParticleElasticScattering( spin, lidp,
+                                               std::move( boundaries ),
+                                               std::move( interpolants ),
+                                               std::move( distributions ) );
+    }
+
+    /* LAW=6 */
+    static void write( Writer& writer, const Section::NBodyPhaseSpace& law ) {
+
+      writer.real( law.APSX() );
+      writer.integer( law.NPSX() );
+    }
+
+    /* LAW=7 */
+    static void write( Writer& writer, const LaboratoryAngleEnergy& law ) {
+
+      writer.integers( law.boundaries() );
+      writer.integers( law.interpolants() );
+      writer.integer( law.NE() );
+      for ( const auto& angular : law.angularDistributions() ) {
+
+        writer.real( angular.E() );
+        writer.integers( angular.boundaries() );
+        writer.integers( angular.interpolants() );
+        writer.integer( angular.NMU() );
+        for ( const auto& energy : angular.energyDistributions() ) {
+
+          writer.real( energy.MU() );
+          writer.integers( energy.boundaries() );
+          writer.integers( energy.interpolants() );
+          writer.reals( energy.EP() );
+          writer.reals( energy.F() );
+        }
+      }
+    }
+
+    static LaboratoryAngleEnergy readLaboratoryAngleEnergy( Reader& reader ) {
+
+      using AngularDistribution = LaboratoryAngleEnergy::AngularDistribution;
+      using EnergyDistribution = LaboratoryAngleEnergy::EnergyDistribution;
+
+      auto boundaries = reader.integers();
+      auto interpolants = reader.integers();
+      const long ne = reader.integer();
+
+      std::vector< AngularDistribution > angular;
+      for ( long i = 0; i < ne; ++i ) {
+
+        const double incident = reader.real();
+        auto angularBoundaries = reader.integers();
+        auto angularInterpolants = reader.integers();
+        const long nmu = reader.integer();
+
+        std::vector< EnergyDistribution > energy;
+        for ( long j = 0; j < nmu; ++j ) {
+
+          const double cosine = reader.real();
+          auto energyBoundaries = reader.integers();
+          auto energyInterpolants = reader.integers();
+          auto energies = reader.reals();
+          auto probabilities = reader.reals();
+          energy.emplace_back( cosine, std::move( energyBoundaries ),
+                               std::move( energyInterpolants ),
+                               std::move( energies ),
+                               std::move( probabilities ) );
+        }
+
+        angular.emplace_back( incident, std::move( angularBoundaries ),
+                              std::move( angularInterpolants ),
+                              std::move( energy ) );
+      }
+
+      return LaboratoryAngleEnergy( std::move( boundaries ),
+                                    std::move( interpolants ),
+                                    std::move( angular ) );
+    }
+
+    [[noreturn]] static void unknownAlternative( const char* law,
+                                                 long index ) {
+
+      Log::error( "Found an unknown MF6 {} component in the binary stream",
+                  law );
+      Log::info( "Component index: {}", index );
+      throw std::exception();
+    }
+  };
+
+} // binary namespace
+} // ENDFtk namespace
+} // njoy namespace
+
+#endif
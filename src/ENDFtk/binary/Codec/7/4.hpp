@@ -0,0 +1,269 @@
+#ifndef NJOY_ENDFTK_BINARY_CODEC_7_4
+#define NJOY_ENDFTK_BINARY_CODEC_7_4
+
+// system includes
+#include <optional>
+#include <vector>
+
+// other includes
+#include "range/v3/iterator/operations.hpp"
+#include "ENDFtk/section/7/4.hpp"
+#include "ENDFtk/binary/Codec.hpp"
+#include "ENDFtk/binary/Writer.hpp"
+#include "ENDFtk/binary/Reader.hpp"
+
+namespace njoy {
+namespace ENDFtk {
+namespace binary {
+
+  /**
+   *  @class
+   *  @brief The native binary encoding of an MF7 MT4 section
+   *
+   *  The ZA, AWR, LAT and LASYM values are followed by the scattering law
+   *  constants, the scattering law (the index of the alternative followed
+   *  by the S(alpha,beta,T) tables for each beta value), the principal
+   *  effective temperature and the secondary effective temperatures (each
+   *  preceded by a flag indicating whether or not it is present).
+   *
+   *  The scattering law constants are stored through their named values
+   *  (the unused B(5) value and the unused values for the non-principal
+   *  scatterers are always written as zero by ENDFtk).
+   */
+  template<>
+  struct Codec< section::Type< 7, 4 > > {
+
+    using Section = section::Type< 7, 4 >;
+    using ScatteringLawConstants = Section::ScatteringLawConstants;
+    using ScatteringLaw = Section::ScatteringLaw;
+    using TabulatedFunctions = Section::TabulatedFunctions;
+    using ScatteringFunction = TabulatedFunctions::ScatteringFunction;
+    using EffectiveTemperature = Section::EffectiveTemperature;
+
+    static constexpr bool native = true;
+
+    /**
+     *  @brief Return whether or not a section can be read by this codec
+     *
+     *  @param[in] MT   the MT number of the section
+     */
+    static bool accepts( int MT ) { return MT == 4; }
+
+    /**
+     *  @brief Write the content of the section
+     *
+     *  @param[in,out] writer    the binary writer
+     *  @param[in]     section   the section to be written
+     */
+    static void write( Writer& writer, const Section& section ) {
+
+      writer.integer( section.ZA() );
+      writer.real( section.AWR() );
+      writer.integer( section.LAT() );
+      writer.integer( section.LASYM() );
+      writeConstants( writer, section.constants() );
+      writeScatteringLaw( writer, section.scatteringLaw() );
+      writeTemperature( writer, section.principalEffectiveTemperature() );
+
+      const auto& secondaries = section.secondaryEffectiveTemperatures();
+      writer.integer( ranges::distance( secondaries ) );
+      for ( const auto& temperature : secondaries ) {
+
+        writer.integer( temperature.has_value() );
+        if ( temperature ) {
+
+          writeTemperature( writer, *temperature );
+        }
+      }
+    }
+
+    /**
+     *  @brief Read the content of the section
+     *
+     *  @param[in,out] reader   the binary reader
+     *  @param[in]     MT       the MT number of the section
+     */
+    static Section read( Reader& reader, int ) {
+
+      const int za = reader.integer();
+      const double awr = reader.real();
+      const int lat = reader.integer();
+      const int lasym = reader.integer();
+      auto constants = readConstants( reader );
+      auto law = readScatteringLaw( reader );
+      auto principal = readTemperature( reader );
+
+      const long size = reader.integer();
+      std::vector< std::optional< EffectiveTemperature > > secondaries;
+      for ( long i = 0; i < size; ++i ) {
+
+        if ( reader.integer() ) {
+
+          secondaries.emplace_back( readTemperature( reader ) );
+        }
+        else {
+
+          secondaries.emplace_back( std::nullopt );
+        }
+      }
+
+      return Section( za, awr, lat, lasym, std::move( constants ),
+                      std::move( law ), std::move( principal ),
+                      std::move( secondaries ) );
+    }
+
+  private:
+
+    /* auxiliary functions */
+
+    static void writeConstants( Writer& writer,
+                                const ScatteringLawConstants& constants ) {
+
+      writer.integer( constants.LLN() );
+      writer.integer( constants.NS() );
+      writer.real( constants.epsilon() );
+      writer.real( constants.EMAX() );
+      writer.reals( constants.totalFreeCrossSections() );
+      writer.reals( constants.atomicWeightRatios() );
+      writer.reals( constants.numberAtoms() );
+      writer.reals( constants.analyticalFunctionTypes() );
+    }
+
+    static ScatteringLawConstants readConstants( Reader& reader ) {
+
+      auto unsignedIntegers = [] ( const std::vector< double >& values ) {
+
+        return std::vector< unsigned int >( values.begin(), values.end() );
+      };
+
+      const int lln = reader.integer();
+      const int ns = reader.integer();
+      const double epsilon = reader.real();
+      const double emax = reader.real();
+      auto xs = reader.reals();
+      auto awr = reader.reals();
+      auto atoms = unsignedIntegers( reader.reals() );
+      auto types = unsignedIntegers( reader.reals() );
+
+      return ScatteringLawConstants( lln, ns, epsilon, emax,
+                                     std::move( xs ), std::move( awr ),
+                                     std::move( atoms ), std::move( types ) );
+    }
+
+    static void writeScatteringLaw( Writer& writer,
+                                    const ScatteringLaw& law ) {
+
+      writer.integer( law.index() );
+      if ( std::holds_alternative< TabulatedFunctions >( law ) ) {
+
+        const auto& table = std::get< TabulatedFunctions >( law );
+        writer.integers( table.boundaries() );
+        writer.integers( table.interpolants() );
+        writer.integer( table.NB() );
+        for ( const auto& function : table.scatteringFunctions() ) {
+
+          writer.real( function.beta() );
+          writer.integers( function.boundaries() );
+          writer.integers( function.interpolants() );
+          writer.reals( function.temperatures() );
+          writer.integers( function.temperatureInterpolants() );
+          writer.reals( function.alphas() );
+          for ( auto&& values : function.thermalScatteringValues() ) {
+
+            writer.reals( values );
+          }
+        }
+      }
+    }
+
+    static ScatteringLaw readScatteringLaw( Reader& reader ) {
+
+      const long index = reader.integer();
+      if ( index == 0 ) {
+
+        return Section::AnalyticalFunctions();
+      }
+      if ( index != 1 ) {
+
+        Log::error( "Found an unknown MF7 MT4 scattering law in the binary "
+                    "stream" );
+        Log::info( "Scattering law index: {}", index );
+        throw std::exception();
+      }
+
+      auto boundaries = reader.integers();
+      auto interpolants = reader.integers();
+      const long nb = reader.integer();
+
+      std::vector< ScatteringFunction > functions;
+      for ( long i = 0; i < nb; ++i ) {
+
+        const double beta = reader.real();
+        auto functionBoundaries = reader.integers();
+        auto functionInterpolants = reader.integers();
+        auto temperatures = reader.reals();
+        auto li = reader.integers();
+        auto alphas = reader.reals();
+        if ( temperatures.empty() ) {
+
+          Log::error( "Found an MF7 MT4 scattering function without "
+                      "temperatures in the binary stream" );
+          throw std::exception();
+        }
+
+        std::vector< std::vector< double > > sab;
+        for ( std::size_t j = 0; j < temperatures.size(); ++j ) {
+
+          sab.emplace_back( reader.reals() );
+        }
+
+        if ( temperatures.size() == 1 ) {
+
+          functions.emplace_back( temperatures.front(), beta,
+                                  std::move( functionBoundaries ),
+                                  std::move( functionInterpolants ),
+                                  std::move( alphas ),
+                                  std::move( sab.front() ) );
+        }
+        else {
+
+          functions.emplace_back( beta,
+                                  std::move( functionBoundaries ),
+                                  std::move( functionInterpolants ),
+                                  std::move( temperatures ), std::move( li ),
+                                  std::move( alphas ), std::move( sab ) );
+        }
+      }
+
+      return TabulatedFunctions( std::move( boundaries ),
+                                 std::move( interpolants ),
+                                 std::move( functions ) );
+    }
+
+    static void writeTemperature( Writer& writer,
+                                  const EffectiveTemperature& temperature ) {
+
+      writer.integers( temperature.boundaries() );
+      writer.integers( temperature.interpolants() );
+      writer.reals( temperature.TMOD() );
+      writer.reals( temperature.TEFF() );
+    }
+
+    static EffectiveTemperature readTemperature( Reader& reader ) {
+
+      auto boundaries = reader.integers();
+      auto interpolants = reader.integers();
+      auto tmod = reader.reals();
+      auto teff = reader.reals();
+
+      return EffectiveTemperature( std::move( boundaries ),
+                                   std::move( interpolants ),
+                                   std::move( tmod ), std::move( teff ) );
+    }
+  };
+
+} // binary namespace
+} // ENDFtk namespace
+} // njoy namespace
+
+#endif
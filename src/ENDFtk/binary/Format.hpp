@@ -0,0 +1,58 @@
+#ifndef NJOY_ENDFTK_BINARY_FORMAT
+#define NJOY_ENDFTK_BINARY_FORMAT
+
+// system includes
+#include <cstdint>
+
+// other includes
+
+namespace njoy {
+namespace ENDFtk {
+namespace binary {
+
+  /**
+   *  @class
+   *  @brief The constants of the binary cache format
+   *
+   *  Every object in a binary stream starts with the magic number, the
+   *  version of the format, a value to verify the byte order and the kind of
+   *  object that follows. Numbers are stored in the native representation
+   *  of the machine that wrote them: integers as 64 bit signed integers and
+   *  reals as doubles, while arrays are stored contiguously after their size.
+   */
+  struct Format {
+
+    /**
+     *  @brief The kind of object stored in a binary stream
+     */
+    enum class Kind : std::uint32_t { Section = 1, File = 2, Material = 3 };
+
+    /**
+     *  @brief The encoding of a section in a binary stream
+     *
+     *  Sections without a native encoding are stored as ENDF text and are
+     *  parsed again when they are read.
+     */
+    enum class Encoding : std::int64_t { Text = 0, Native = 1 };
+
+    /**
+     *  @brief The version of the binary cache format
+     */
+    static constexpr std::uint32_t version = 2;
+
+    /**
+     *  @brief Return the magic number that starts every binary object
+     */
+    static constexpr const char* magic() { return "ENDFtkBC"; }
+
+    /**
+     *  @brief Return a value used to verify the byte order of a binary object
+     */
+    static constexpr std::uint32_t byteOrder() { return 0x01020304u; }
+  };
+
+} // binary namespace
+} // ENDFtk namespace
+} // njoy namespace
+
+#endif
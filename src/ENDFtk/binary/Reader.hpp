@@ -0,0 +1,80 @@
+#ifndef NJOY_ENDFTK_BINARY_READER
+#define NJOY_ENDFTK_BINARY_READER
+
+// system includes
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+// other includes
+#include "ENDFtk/Log.hpp"
+#include "ENDFtk/Material.hpp"
+#include "ENDFtk/binary/Format.hpp"
+#include "ENDFtk/binary/Codec.hpp"
+
+namespace njoy {
+namespace ENDFtk {
+namespace binary {
+
+  /**
+   *  @class
+   *  @brief Read parsed sections, files and materials from a binary stream
+   *
+   *  Sections with a native encoding are constructed directly from the
+   *  arrays of integers and doubles in the stream, sections stored as ENDF
+   *  text are parsed (currently every section except the MF3 and MF6
+   *  sections and the MF7 MT4 section, see binary::Codec). The format header of every object is verified, and the
+   *  size of every array is verified against the remaining length of the
+   *  stream before it is allocated.
+   */
+  class Reader {
+
+    /* fields */
+    std::istream& in_;
+    std::optional< std::uint64_t > remaining_;
+
+    /* auxiliary functions */
+    #include "ENDFtk/binary/Reader/src/get.hpp"
+    #include "ENDFtk/binary/Reader/src/header.hpp"
+    #include "ENDFtk/binary/Reader/src/readNative.hpp"
+    #include "ENDFtk/binary/Reader/src/readSection.hpp"
+    #include "ENDFtk/binary/Reader/src/readFile.hpp"
+
+  public:
+
+    /* constructor */
+
+    /**
+     *  @brief Constructor
+     *
+     *  @param[in,out] in   the input stream (opened in binary mode)
+     */
+    Reader( std::istream& in ) : in_( in ), remaining_( length( in ) ) {}
+
+    /* methods */
+
+    /**
+     *  @brief Return whether or not the end of the stream was reached
+     */
+    bool atEnd() const {
+
+      return this->in_.peek() == std::istream::traits_type::eof();
+    }
+
+    #include "ENDFtk/binary/Reader/src/values.hpp"
+    #include "ENDFtk/binary/Reader/src/section.hpp"
+    #include "ENDFtk/binary/Reader/src/file.hpp"
+    #include "ENDFtk/binary/Reader/src/material.hpp"
+  };
+
+} // binary namespace
+} // ENDFtk namespace
+} // njoy namespace
+
+#endif
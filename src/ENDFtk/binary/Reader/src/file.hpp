@@ -0,0 +1,17 @@
+/**
+ *  @brief Read a parsed file from the stream
+ */
+template< int MF >
+file::Type< MF > file() {
+
+  this->header( Format::Kind::File );
+  this->integer();
+  const int mf = this->integer();
+  if ( mf != MF ) {
+
+    Log::error( "The binary stream does not contain file MF{}", MF );
+    Log::info( "Found file MF{}", mf );
+    throw std::exception();
+  }
+  return this->readFile< MF >();
+}
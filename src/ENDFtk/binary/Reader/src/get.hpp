@@ -0,0 +1,76 @@
+/**
+ *  @brief Read an array of values from the stream
+ *
+ *  @param[out] data   a pointer to the first value
+ *  @param[in]  size   the number of values
+ */
+template< typename Type >
+void get( Type* data, std::size_t size ) {
+
+  this->in_.read( reinterpret_cast< char* >( data ), sizeof( Type ) * size );
+  if ( not this->in_ ) {
+
+    Log::error( "Encountered the end of the stream while reading a binary "
+                "object" );
+    throw std::exception();
+  }
+  if ( this->remaining_ ) {
+
+    *this->remaining_ -= sizeof( Type ) * size;
+  }
+}
+
+/**
+ *  @brief Read an array preceded by its size
+ *
+ *  The size read from the stream is not trusted: it is verified against the
+ *  number of bytes remaining in the stream before memory is allocated for
+ *  the array. When the length of the stream is not known (e.g. for a pipe),
+ *  the array is read in chunks so that the memory allocated never exceeds
+ *  the data that was actually read by more than one chunk.
+ */
+template< typename Container >
+Container array() {
+
+  using Type = typename Container::value_type;
+  constexpr std::size_t chunk = 65536;
+
+  Container values;
+  const std::size_t total = this->count( sizeof( Type ) );
+  std::size_t done = 0;
+  while ( done < total ) {
+
+    const std::size_t count = this->remaining_
+                              ? total - done
+                              : std::min( total - done, chunk );
+    values.resize( done + count );
+    this->get( values.data() + done, count );
+    done += count;
+  }
+  return values;
+}
+
+/**
+ *  @brief Return the number of bytes remaining in a stream (if it is known)
+ *
+ *  @param[in,out] in   the input stream
+ */
+static std::optional< std::uint64_t > length( std::istream& in ) {
+
+  const auto current = in.tellg();
+  if ( current == std::istream::pos_type( -1 ) ) {
+
+    in.clear();
+    return std::nullopt;
+  }
+
+  in.seekg( 0, std::ios::end );
+  const auto end = in.tellg();
+  in.clear();
+  in.seekg( current );
+  if ( ( end == std::istream::pos_type( -1 ) ) || ( end < current ) ) {
+
+    return std::nullopt;
+  }
+  return static_cast< std::uint64_t >( end - current );
+}
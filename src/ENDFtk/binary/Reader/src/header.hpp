@@ -0,0 +1,44 @@
+/**
+ *  @brief Read and verify the format header for an object
+ *
+ *  @param[in] kind   the kind of object that is expected after the header
+ */
+void header( Format::Kind kind ) {
+
+  char magic[8];
+  std::uint32_t version = 0;
+  std::uint32_t order = 0;
+  std::uint32_t value = 0;
+
+  this->get( magic, 8 );
+  if ( std::strncmp( magic, Format::magic(), 8 ) ) {
+
+    Log::error( "The stream does not contain a binary ENDFtk object" );
+    throw std::exception();
+  }
+
+  this->get( &version, 1 );
+  if ( version != Format::version ) {
+
+    Log::error( "The binary object has an unsupported version number" );
+    Log::info( "Expected version: {}", Format::version );
+    Log::info( "Found version: {}", version );
+    throw std::exception();
+  }
+
+  this->get( &order, 1 );
+  if ( order != Format::byteOrder() ) {
+
+    Log::error( "The binary object was written with a different byte order" );
+    throw std::exception();
+  }
+
+  this->get( &value, 1 );
+  if ( value != static_cast< std::uint32_t >( kind ) ) {
+
+    Log::error( "The binary object is not of the expected kind" );
+    Log::info( "Expected kind: {}", static_cast< std::uint32_t >( kind ) );
+    Log::info( "Found kind: {}", value );
+    throw std::exception();
+  }
+}
@@ -0,0 +1,52 @@
+/**
+ *  @brief Read a parsed material from the stream
+ */
+Material material() {
+
+  this->header( Format::Kind::Material );
+  const int MAT = this->integer();
+  // every file has at least an MF number and a number of sections
+  const std::size_t size = this->count( 2 * sizeof( std::int64_t ) );
+
+  std::vector< Material::FileVariant > files;
+  files.reserve( size );
+  for ( std::size_t index = 0; index < size; ++index ) {
+
+    const int MF = this->integer();
+    switch ( MF ) {
+
+      case  1 : { files.emplace_back( this->readFile<  1 >() ); break; }
+      case  2 : { files.emplace_back( this->readFile<  2 >() ); break; }
+      case  3 : { files.emplace_back( this->readFile<  3 >() ); break; }
+      case  4 : { files.emplace_back( this->readFile<  4 >() ); break; }
+      case  5 : { files.emplace_back( this->readFile<  5 >() ); break; }
+      case  6 : { files.emplace_back( this->readFile<  6 >() ); break; }
+      case  7 : { files.emplace_back( this->readFile<  7 >() ); break; }
+      case  8 : { files.emplace_back( this->readFile<  8 >() ); break; }
+      case  9 : { files.emplace_back( this->readFile<  9 >() ); break; }
+      case 10 : { files.emplace_back( this->readFile< 10 >() ); break; }
+      case 12 : { files.emplace_back( this->readFile< 12 >() ); break; }
+      case 13 : { files.emplace_back( this->readFile< 13 >() ); break; }
+      case 14 : { files.emplace_back( this->readFile< 14 >() ); break; }
+      case 15 : { files.emplace_back( this->readFile< 15 >() ); break; }
+      case 23 : { files.emplace_back( this->readFile< 23 >() ); break; }
+      case 26 : { files.emplace_back( this->readFile< 26 >() ); break; }
+      case 27 : { files.emplace_back( this->readFile< 27 >() ); break; }
+      case 28 : { files.emplace_back( this->readFile< 28 >() ); break; }
+      case 30 : { files.emplace_back( this->readFile< 30 >() ); break; }
+      case 31 : { files.emplace_back( this->readFile< 31 >() ); break; }
+      case 32 : { files.emplace_back( this->readFile< 32 >() ); break; }
+      case 33 : { files.emplace_back( this->readFile< 33 >() ); break; }
+      case 34 : { files.emplace_back( this->readFile< 34 >() ); break; }
+      case 35 : { files.emplace_back( this->readFile< 35 >() ); break; }
+      case 40 : { files.emplace_back( this->readFile< 40 >() ); break; }
+      default : {
+
+        Log::error( "Found unsupported file MF{} in the binary stream", MF );
+        throw std::exception();
+      }
+    }
+  }
+
+  return Material( MAT, std::move( files ) );
+}
@@ -0,0 +1,33 @@
+/**
+ *  @brief Read the number of sections and the sections of a file
+ *
+ *  The MF number of the file has already been read.
+ */
+template< int MF >
+file::Type< MF > readFile() {
+
+  // every section has at least an MT number and an encoding
+  const std::size_t size = this->count( 2 * sizeof( std::int64_t ) );
+  if constexpr ( MF == 30 ) {
+
+    // MF30 is not parsed so there is nothing to be read
+    return file::Type< 30 >();
+  }
+  else {
+
+    using FileType = file::Type< MF >;
+    using Iterator = std::string::const_iterator;
+    using Section =
+        decltype( FileType::parseSection( std::declval< Iterator& >(),
+                                          std::declval< const Iterator& >(),
+                                          std::declval< long& >() ) );
+
+    std::vector< Section > sections;
+    sections.reserve( size );
+    for ( std::size_t index = 0; index < size; ++index ) {
+
+      sections.push_back( this->readSection< MF, Section >() );
+    }
+    return FileType( std::move( sections ) );
+  }
+}
@@ -0,0 +1,62 @@
+/**
+ *  @brief Read a section that has no native encoding (an error)
+ *
+ *  @param[in] MT   the MT number of the section
+ */
+template< typename Section >
+Section readNativeAlternative( int MT, Section* ) {
+
+  Log::error( "Found a native encoding for a section that does not have one" );
+  Log::info( "MT number of the section: {}", MT );
+  throw std::exception();
+}
+
+/**
+ *  @brief Read a section with a native encoding into a section variant
+ *
+ *  @param[in] MT   the MT number of the section
+ */
+template< typename... Sections >
+std::variant< Sections... >
+readNativeAlternative( int MT, std::variant< Sections... >* ) {
+
+  std::optional< std::variant< Sections... > > section;
+  auto attempt = [&] ( auto* tag ) {
+
+    using Alternative = std::remove_pointer_t< decltype( tag ) >;
+    if constexpr ( Codec< Alternative >::native ) {
+
+      if ( ( not section ) && Codec< Alternative >::accepts( MT ) ) {
+
+        section.emplace( Codec< Alternative >::read( *this, MT ) );
+      }
+    }
+  };
+  ( attempt( static_cast< Sections* >( nullptr ) ), ... );
+
+  if ( not section ) {
+
+    Log::error( "Found a native encoding for a section that does not have one" );
+    Log::info( "MT number of the section: {}", MT );
+    throw std::exception();
+  }
+  return std::move( *section );
+}
+
+/**
+ *  @brief Read the content of a section with a native encoding
+ *
+ *  @param[in] MT   the MT number of the section
+ */
+template< typename Section >
+Section readNative( int MT ) {
+
+  if constexpr ( Codec< Section >::native ) {
+
+    return Codec< Section >::read( *this, MT );
+  }
+  else {
+
+    return this->readNativeAlternative( MT, static_cast< Section* >( nullptr ) );
+  }
+}
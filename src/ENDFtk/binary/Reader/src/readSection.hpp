@@ -0,0 +1,37 @@
+/**
+ *  @brief Read the MT number, the encoding and the content of a section
+ *
+ *  The section type can be a single section type or the section variant of
+ *  a file. Sections stored as ENDF text are parsed again.
+ */
+template< int MF, typename Section >
+Section readSection() {
+
+  const int MT = this->integer();
+  const auto encoding = static_cast< Format::Encoding >( this->integer() );
+  if ( encoding == Format::Encoding::Native ) {
+
+    return this->readNative< Section >( MT );
+  }
+  if ( encoding != Format::Encoding::Text ) {
+
+    Log::error( "Found an unknown section encoding in the binary stream" );
+    Log::info( "MT number of the section: {}", MT );
+    throw std::exception();
+  }
+
+  const std::string text = this->text();
+  auto begin = text.begin();
+  auto end = text.end();
+  long lineNumber = 1;
+
+  auto parsed = file::Type< MF >::parseSection( begin, end, lineNumber );
+  if constexpr ( std::is_same_v< decltype( parsed ), Section > ) {
+
+    return parsed;
+  }
+  else {
+
+    return std::get< Section >( std::move( parsed ) );
+  }
+}
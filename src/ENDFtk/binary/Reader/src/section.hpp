@@ -0,0 +1,18 @@
+/**
+ *  @brief Read a parsed section from the stream
+ */
+template< int MF, int... OptionalMT >
+section::Type< MF, OptionalMT... > section() {
+
+  this->header( Format::Kind::Section );
+  this->integer();
+  const int mf = this->integer();
+  if ( mf != MF ) {
+
+    Log::error( "The binary stream does not contain a section of file MF{}",
+                MF );
+    Log::info( "Found a section of file MF{}", mf );
+    throw std::exception();
+  }
+  return this->readSection< MF, section::Type< MF, OptionalMT... > >();
+}
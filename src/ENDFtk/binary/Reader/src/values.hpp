@@ -0,0 +1,76 @@
+/**
+ *  @brief Read an integer value
+ */
+std::int64_t integer() {
+
+  std::int64_t value = 0;
+  this->get( &value, 1 );
+  return value;
+}
+
+/**
+ *  @brief Read the number of objects that follow in the stream
+ *
+ *  The number read from the stream is not trusted: it is verified against
+ *  the number of bytes remaining in the stream (when it is known), given
+ *  the minimum number of bytes taken by every object.
+ *
+ *  @param[in] bytes   the minimum number of bytes of every object
+ */
+std::size_t count( std::size_t bytes ) {
+
+  const std::int64_t number = this->integer();
+  if ( ( number < 0 ) ||
+       ( this->remaining_ &&
+         ( static_cast< std::uint64_t >( number ) >
+           *this->remaining_ / std::max< std::size_t >( bytes, 1 ) ) ) ) {
+
+    Log::error( "Encountered a number of objects that exceeds the remaining "
+                "length of the binary stream" );
+    Log::info( "Number of objects: {}", number );
+    throw std::exception();
+  }
+  return number;
+}
+
+/**
+ *  @brief Read a real value
+ */
+double real() {
+
+  double value = 0.;
+  this->get( &value, 1 );
+  return value;
+}
+
+/**
+ *  @brief Read an array of integer values (preceded by its size)
+ */
+std::vector< long > integers() {
+
+  if constexpr ( sizeof( long ) == sizeof( std::int64_t ) ) {
+
+    return this->array< std::vector< long > >();
+  }
+  else {
+
+    const auto values = this->array< std::vector< std::int64_t > >();
+    return std::vector< long >( values.begin(), values.end() );
+  }
+}
+
+/**
+ *  @brief Read an array of real values (preceded by its size)
+ */
+std::vector< double > reals() {
+
+  return this->array< std::vector< double > >();
+}
+
+/**
+ *  @brief Read a string (preceded by its size)
+ */
+std::string text() {
+
+  return this->array< std::string >();
+}
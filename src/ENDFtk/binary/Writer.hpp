@@ -0,0 +1,72 @@
+#ifndef NJOY_ENDFTK_BINARY_WRITER
+#define NJOY_ENDFTK_BINARY_WRITER
+
+// system includes
+#include <cstdint>
+#include <iterator>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+// other includes
+#include "ENDFtk/Log.hpp"
+#include "range/v3/range/concepts.hpp"
+#include "range/v3/range/primitives.hpp"
+#include "ENDFtk/Material.hpp"
+#include "ENDFtk/toString.hpp"
+#include "ENDFtk/binary/Format.hpp"
+#include "ENDFtk/binary/Codec.hpp"
+
+namespace njoy {
+namespace ENDFtk {
+namespace binary {
+
+  /**
+   *  @class
+   *  @brief Write parsed sections, files and materials to a binary stream
+   *
+   *  Sections with a native encoding (see binary::Codec) are written as
+   *  contiguous arrays of integers and doubles so that they can be read back
+   *  without decoding ENDF text. All other sections are written as ENDF text
+   *  and gain nothing from the binary cache: currently only the MF3 and MF6
+   *  sections and the MF7 MT4 section have a native encoding.
+   *  Any number of objects can be written to the same stream, each of them is
+   *  preceded by the format header.
+   */
+  class Writer {
+
+    /* fields */
+    std::ostream& out_;
+
+    /* auxiliary functions */
+    #include "ENDFtk/binary/Writer/src/put.hpp"
+    #include "ENDFtk/binary/Writer/src/header.hpp"
+    #include "ENDFtk/binary/Writer/src/writeSection.hpp"
+    #include "ENDFtk/binary/Writer/src/writeFile.hpp"
+
+  public:
+
+    /* constructor */
+
+    /**
+     *  @brief Constructor
+     *
+     *  @param[in,out] out   the output stream (opened in binary mode)
+     */
+    Writer( std::ostream& out ) : out_( out ) {}
+
+    /* methods */
+    #include "ENDFtk/binary/Writer/src/values.hpp"
+    #include "ENDFtk/binary/Writer/src/section.hpp"
+    #include "ENDFtk/binary/Writer/src/file.hpp"
+    #include "ENDFtk/binary/Writer/src/material.hpp"
+  };
+
+} // binary namespace
+} // ENDFtk namespace
+} // njoy namespace
+
+#endif
@@ -0,0 +1,13 @@
+/**
+ *  @brief Write a parsed file to the stream
+ *
+ *  @param[in] file   the file to be written
+ *  @param[in] MAT    the MAT number of the file
+ */
+template< int MF >
+void file( const file::Type< MF >& file, int MAT ) {
+
+  this->header( Format::Kind::File );
+  this->integer( MAT );
+  this->writeFile( file, MAT );
+}
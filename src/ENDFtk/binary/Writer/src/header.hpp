@@ -0,0 +1,16 @@
+/**
+ *  @brief Write the format header for an object to the stream
+ *
+ *  @param[in] kind   the kind of object that follows the header
+ */
+void header( Format::Kind kind ) {
+
+  const std::uint32_t version = Format::version;
+  const std::uint32_t order = Format::byteOrder();
+  const auto value = static_cast< std::uint32_t >( kind );
+
+  this->put( Format::magic(), 8 );
+  this->put( &version, 1 );
+  this->put( &order, 1 );
+  this->put( &value, 1 );
+}
@@ -0,0 +1,25 @@
+/**
+ *  @brief Write a parsed material to the stream
+ *
+ *  @param[in] material   the material to be written
+ */
+void material( const Material& material ) {
+
+  const int MAT = material.MAT();
+
+  std::int64_t size = 0;
+  for ( const auto& file : material.files() ) {
+
+    static_cast< void >( file );
+    ++size;
+  }
+
+  this->header( Format::Kind::Material );
+  this->integer( MAT );
+  this->integer( size );
+  for ( const auto& file : material.files() ) {
+
+    std::visit( [&] ( const auto& value ) { this->writeFile( value, MAT ); },
+                file );
+  }
+}
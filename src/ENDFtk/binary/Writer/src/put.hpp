@@ -0,0 +1,17 @@
+/**
+ *  @brief Write an array of values to the stream
+ *
+ *  @param[in] data   a pointer to the first value
+ *  @param[in] size   the number of values
+ */
+template< typename Type >
+void put( const Type* data, std::size_t size ) {
+
+  this->out_.write( reinterpret_cast< const char* >( data ),
+                    sizeof( Type ) * size );
+  if ( not this->out_ ) {
+
+    Log::error( "Could not write to the binary stream" );
+    throw std::exception();
+  }
+}
@@ -0,0 +1,15 @@
+/**
+ *  @brief Write a parsed section to the stream
+ *
+ *  @param[in] section   the section to be written
+ *  @param[in] MAT       the MAT number of the section
+ *  @param[in] MF        the MF number of the section
+ */
+template< typename Section >
+void section( const Section& section, int MAT, int MF ) {
+
+  this->header( Format::Kind::Section );
+  this->integer( MAT );
+  this->integer( MF );
+  this->writeSection( section, MAT, MF );
+}
@@ -0,0 +1,70 @@
+/**
+ *  @brief Write an integer value
+ *
+ *  @param[in] value   the value to be written
+ */
+void integer( std::int64_t value ) { this->put( &value, 1 ); }
+
+/**
+ *  @brief Write a real value
+ *
+ *  @param[in] value   the value to be written
+ */
+void real( double value ) { this->put( &value, 1 ); }
+
+/**
+ *  @brief Write a range of integer values (preceded by its size)
+ *
+ *  @param[in] range   the values to be written
+ */
+template< typename Range >
+void integers( Range&& range ) {
+
+  std::vector< std::int64_t > values;
+  for ( auto value : range ) {
+
+    values.push_back( value );
+  }
+  this->integer( values.size() );
+  this->put( values.data(), values.size() );
+}
+
+/**
+ *  @brief Write a range of real values (preceded by its size)
+ *
+ *  Contiguous ranges of doubles are written without making a copy.
+ *
+ *  @param[in] range   the values to be written
+ */
+template< typename Range >
+void reals( Range&& range ) {
+
+  using Type = std::remove_reference_t< Range >;
+  if constexpr ( ranges::contiguous_range< Type > &&
+                 std::is_same_v< ranges::range_value_t< Type >, double > ) {
+
+    this->integer( ranges::size( range ) );
+    this->put( ranges::data( range ), ranges::size( range ) );
+  }
+  else {
+
+    std::vector< double > values;
+    for ( auto value : range ) {
+
+      values.push_back( value );
+    }
+    this->integer( values.size() );
+    this->put( values.data(), values.size() );
+  }
+}
+
+/**
+ *  @brief Write a string (preceded by its size)
+ *
+ *  @param[in] text   the string to be written
+ */
+void text( std::string_view text ) {
+
+  this->integer( text.size() );
+  this->put( text.data(), text.size() );
+}
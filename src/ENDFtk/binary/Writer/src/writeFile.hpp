@@ -0,0 +1,31 @@
+/**
+ *  @brief Write the MF number, the number of sections and the sections of
+ *         a file
+ *
+ *  @param[in] file   the file to be written
+ *  @param[in] MAT    the MAT number of the file
+ */
+template< int MF >
+void writeFile( const file::Type< MF >& file, int MAT ) {
+
+  this->integer( MF );
+  if constexpr ( MF == 30 ) {
+
+    // MF30 is not parsed so there is nothing to be written
+    this->integer( 0 );
+  }
+  else {
+
+    std::int64_t size = 0;
+    for ( const auto& section : file.sections() ) {
+
+      static_cast< void >( section );
+      ++size;
+    }
+    this->integer( size );
+    for ( const auto& section : file.sections() ) {
+
+      this->writeSection( section, MAT, MF );
+    }
+  }
+}
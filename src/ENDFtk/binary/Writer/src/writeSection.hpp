@@ -0,0 +1,38 @@
+/**
+ *  @brief Write the MT number, the encoding and the content of a section
+ *
+ *  @param[in] section   the section to be written
+ *  @param[in] MAT       the MAT number of the section
+ *  @param[in] MF        the MF number of the section
+ */
+template< typename Section >
+void writeSection( const Section& section, int MAT, int MF ) {
+
+  this->integer( section.MT() );
+  if constexpr ( Codec< Section >::native ) {
+
+    this->integer( static_cast< std::int64_t >( Format::Encoding::Native ) );
+    Codec< Section >::write( *this, section );
+  }
+  else {
+
+    this->integer( static_cast< std::int64_t >( Format::Encoding::Text ) );
+    this->text( toString( printedLines( section ), section, MAT, MF ) );
+  }
+}
+
+/**
+ *  @brief Write the MT number, the encoding and the content of a section
+ *
+ *  @param[in] section   the section to be written
+ *  @param[in] MAT       the MAT number of the section
+ *  @param[in] MF        the MF number of the section
+ */
+template< typename... Sections >
+void writeSection( const std::variant< Sections... >& section,
+                   int MAT, int MF ) {
+
+  std::visit( [&] ( const auto& value )
+                  { this->writeSection( value, MAT, MF ); },
+              section );
+}
@@ -0,0 +1,468 @@
+// include Catch2
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+using Catch::Matchers::WithinRel;
+
+// what we are testing
+#include "ENDFtk/binary.hpp"
+
+// other includes
+#include <cstring>
+#include <sstream>
+
+// convenience typedefs
+using namespace njoy::ENDFtk;
+
+std::string chunk();
+std::string chunkMF1();
+std::string chunkMF3();
+std::string chunkMT102();
+std::string chunkMF6();
+std::string chunkMF6MT18();
+std::string chunkMF7MT4Analytical();
+std::string chunkMF7MT4Tabulated();
+
+template< typename Object >
+std::string print( const Object& object, int MAT, int MF ) {
+
+  std::string buffer;
+  auto output = std::back_inserter( buffer );
+  object.print( output, MAT, MF );
+  return buffer;
+}
+
+SCENARIO( "binary::Writer and binary::Reader" ) {
+
+  GIVEN( "a parsed material" ) {
+
+    std::string string = chunk();
+    auto begin = string.begin();
+    auto end = string.end();
+    long lineNumber = 0;
+
+    StructureDivision division( begin, end, lineNumber );
+    Material material( division, begin, end, lineNumber );
+
+    WHEN( "the material is written to and read from a binary stream" ) {
+
+      std::stringstream stream( std::ios::in | std::ios::out |
+                                std::ios::binary );
+      binary::Writer writer( stream );
+      writer.material( material );
+      writer.material( material );
+
+      binary::Reader reader( stream );
+      auto first = reader.material();
+      auto second = reader.material();
+
+      THEN( "the materials print the same as the original material" ) {
+
+        CHECK( true == reader.atEnd() );
+
+        std::string buffer;
+        auto output = std::back_inserter( buffer );
+        first.print( output );
+        CHECK( buffer == string );
+
+        buffer.clear();
+        second.print( output );
+        CHECK( buffer == string );
+      } // THEN
+
+      THEN( "the natively encoded sections are read correctly" ) {
+
+        CHECK( 125 == first.MAT() );
+        CHECK( true == first.hasMF( 1 ) );
+        CHECK( true == first.hasMF( 3 ) );
+
+        const auto& file = std::get< file::Type< 3 > >( first.file( 3 ) );
+        CHECK( true == file.hasMT( 1 ) );
+        CHECK( true == file.hasMT( 102 ) );
+
+        const auto& section = file.section( 102 );
+        CHECK( 102 == section.MT() );
+        CHECK( 1001 == section.ZA() );
+        CHECK_THAT( 0.9991673, WithinRel( section.AWR() ) );
+        CHECK_THAT( 2.224631e+6, WithinRel( section.QM() ) );
+        CHECK_THAT( 2.224631e+6, WithinRel( section.QI() ) );
+        CHECK( 0 == section.LR() );
+        CHECK( 1 == section.NR() );
+        CHECK( 3 == section.NP() );
+        CHECK( 3 == section.boundaries()[0] );
+        CHECK( 5 == section.interpolants()[0] );
+        CHECK_THAT( 1e-5, WithinRel( section.energies()[0] ) );
+        CHECK_THAT( 2e+7, WithinRel( section.energies()[2] ) );
+        CHECK_THAT( 16.72869, WithinRel( section.crossSections()[0] ) );
+        CHECK_THAT( 2.722858e-5, WithinRel( section.crossSections()[2] ) );
+      } // THEN
+    } // WHEN
+
+    WHEN( "a file is written to and read from a binary stream" ) {
+
+      const auto& original = std::get< file::Type< 3 > >( material.file( 3 ) );
+
+      std::stringstream stream( std::ios::in | std::ios::out |
+                                std::ios::binary );
+      binary::Writer( stream ).file( original, 125 );
+      auto file = binary::Reader( stream ).file< 3 >();
+
+      THEN( "the file prints the same as the original file" ) {
+
+        std::string buffer;
+        auto output = std::back_inserter( buffer );
+        file.print( output, 125 );
+        CHECK( buffer == chunkMF3() );
+      } // THEN
+    } // WHEN
+
+    WHEN( "sections are written to and read from a binary stream" ) {
+
+      const auto& mf1 = std::get< file::Type< 1 > >( material.file( 1 ) );
+      const auto& mf3 = std::get< file::Type< 3 > >( material.file( 3 ) );
+      const auto& information =
+          std::get< section::Type< 1, 451 > >( mf1.section( 451 ) );
+
+      std::stringstream stream( std::ios::in | std::ios::out |
+                                std::ios::binary );
+      binary::Writer writer( stream );
+      writer.section( mf3.section( 102 ), 125, 3 );
+      writer.section( information, 125, 1 );
+
+      binary::Reader reader( stream );
+      auto capture = reader.section< 3 >();
+      auto description = reader.section< 1, 451 >();
+
+      THEN( "the sections print the same as the original sections" ) {
+
+        CHECK( print( capture, 125, 3 ) == chunkMT102() );
+        CHECK( print( description, 125, 1 ) == print( information, 125, 1 ) );
+      } // THEN
+    } // WHEN
+
+    WHEN( "the binary stream does not contain what is expected" ) {
+
+      std::stringstream stream( std::ios::in | std::ios::out |
+                                std::ios::binary );
+      binary::Writer( stream ).material( material );
+      const std::string content = stream.str();
+
+      THEN( "an exception is thrown" ) {
+
+        // the stream contains a material, not a file
+        std::stringstream kind( content );
+        CHECK_THROWS( binary::Reader( kind ).file< 3 >() );
+
+        // the magic number was changed
+        std::string copy = content;
+        copy[0] = 'X';
+        std::stringstream magic( copy );
+        CHECK_THROWS( binary::Reader( magic ).material() );
+
+        // the version number was changed
+        copy = content;
+        copy[8] = 99;
+        std::stringstream version( copy );
+        CHECK_THROWS( binary::Reader( version ).material() );
+
+        // the stream was truncated
+        std::stringstream truncated( content.substr( 0, content.size() / 2 ) );
+        CHECK_THROWS( binary::Reader( truncated ).material() );
+      } // THEN
+    } // WHEN
+
+    WHEN( "the size of an array exceeds the length of the binary stream" ) {
+
+      const auto& mf1 = std::get< file::Type< 1 > >( material.file( 1 ) );
+      const auto& information =
+          std::get< section::Type< 1, 451 > >( mf1.section( 451 ) );
+
+      std::stringstream stream( std::ios::in | std::ios::out |
+                                std::ios::binary );
+      binary::Writer( stream ).section( information, 125, 1 );
+      std::string content = stream.str();
+
+      // the size of the text follows the header (20 bytes) and the MAT, MF,
+      // MT and encoding values
+      const std::int64_t size = std::int64_t( 1 ) << 60;
+      std::memcpy( content.data() + 52, &size, sizeof( size ) );
+
+      THEN( "an exception is thrown before the array is allocated" ) {
+
+        std::stringstream corrupted( content );
+        CHECK_THROWS( binary::Reader( corrupted ).section< 1, 451 >() );
+      } // THEN
+    } // WHEN
+
+    WHEN( "the number of files exceeds the length of the binary stream" ) {
+
+      std::stringstream stream( std::ios::in | std::ios::out |
+                                std::ios::binary );
+      binary::Writer( stream ).material( material );
+      std::string content = stream.str();
+
+      // the number of files follows the header (20 bytes) and the MAT value
+      const std::int64_t size = std::int64_t( 1 ) << 60;
+      std::memcpy( content.data() + 28, &size, sizeof( size ) );
+
+      THEN( "an exception is thrown before the files are allocated" ) {
+
+        std::stringstream corrupted( content );
+        CHECK_THROWS( binary::Reader( corrupted ).material() );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+
+  GIVEN( "parsed MF6 and MF7 MT4 sections" ) {
+
+    auto parse = [] ( const std::string& string, auto* tag, int MAT ) {
+
+      using Section = std::remove_pointer_t< decltype( tag ) >;
+      auto begin = string.begin();
+      auto end = string.end();
+      long lineNumber = 1;
+      HeadRecord head( begin, end, lineNumber );
+      return Section( head, begin, end, lineNumber, MAT );
+    };
+
+    auto distributions =
+        parse( chunkMF6(), static_cast< section::Type< 6 >* >( nullptr ),
+               9228 );
+    auto fission =
+        parse( chunkMF6MT18(), static_cast< section::Type< 6 >* >( nullptr ),
+               9228 );
+    auto analytical =
+        parse( chunkMF7MT4Analytical(),
+               static_cast< section::Type< 7, 4 >* >( nullptr ), 27 );
+    auto tabulated =
+        parse( chunkMF7MT4Tabulated(),
+               static_cast< section::Type< 7, 4 >* >( nullptr ), 27 );
+
+    WHEN( "the sections are written to and read from a binary stream" ) {
+
+      std::stringstream stream( std::ios::in | std::ios::out |
+                                std::ios::binary );
+      binary::Writer writer( stream );
+      writer.section( distributions, 9228, 6 );
+      writer.section( fission, 9228, 6 );
+      writer.section( analytical, 27, 7 );
+      writer.section( tabulated, 27, 7 );
+
+      binary::Reader reader( stream );
+      auto first = reader.section< 6 >();
+      auto second = reader.section< 6 >();
+      auto third = reader.section< 7, 4 >();
+      auto fourth = reader.section< 7, 4 >();
+
+      THEN( "the sections are natively encoded and print the same as the "
+            "original sections" ) {
+
+        CHECK( true == binary::Codec< section::Type< 6 > >::native );
+        CHECK( true == binary::Codec< section::Type< 7, 4 > >::native );
+        CHECK( true == reader.atEnd() );
+
+        CHECK( 11 == first.NK() );
+        CHECK( 1 == second.NK() );
+        CHECK( -4 == second.reactionProducts()[0].LAW() );
+        CHECK( print( first, 9228, 6 ) == print( distributions, 9228, 6 ) );
+        CHECK( print( second, 9228, 6 ) == print( fission, 9228, 6 ) );
+        CHECK( print( third, 27, 7 ) == print( analytical, 27, 7 ) );
+        CHECK( print( fourth, 27, 7 ) == print( tabulated, 27, 7 ) );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+} // SCENARIO
+
+std::string chunk() {
+
+  return chunkMF1() + chunkMF3() +
+    "                                                                     0 0  0     \n";
+}
+
+std::string chunkMF1() {
+
+  return
+    " 1.001000+3 9.991673-1          1          2          3          4 125 1451     \n"
+    " 5.000000+0 6.000000+0          7          8          0         12 125 1451     \n"
+    " 1.300000+1 1.400000+1         15          0         17         18 125 1451     \n"
+    " 1.900000+1 0.000000+0         21          0          9          3 125 1451     \n"
+    "  1-H -  1 LANL       EVAL-JUL16 G.M.Hale                          125 1451     \n"
+    "                      DIST-JAN17                       20170124    125 1451     \n"
+    "----ENDF/B-VIII.0     MATERIAL  125                                125 1451     \n"
+    "-----INCIDENT NEUTRON DATA                                         125 1451     \n"
+    "------ENDF-6 FORMAT                                                125 1451     \n"
+    "                                                                   125 1451     \n"
+    " ****************************************************************  125 1451     \n"
+    "                                                                   125 1451     \n"
+    " ****************************************************************  125 1451     \n"
+    "                                1        451         16          5 125 1451     \n"
+    "                                3          1          5          4 125 1451     \n"
+    "                                3        102          5          5 125 1451     \n"
+    "                                                                   125 1  0     \n"
+    "                                                                   125 0  0     \n";
+}
+
+std::string chunkMF3() {
+
+  return
+    " 1.001000+3 9.991673-1          0          0          0          0 125 3  1     \n"
+    " 0.000000+0 0.000000+0          0          0          1          2 125 3  1     \n"
+    "          2          2                                             125 3  1     \n"
+    " 1.000000-5 3.713628+1 2.000000+7 4.827500-1                       125 3  1     \n"
+    "                                                                   125 3  0     \n"
+    + chunkMT102() +
+    "                                                                   125 0  0     \n";
+}
+
+std::string chunkMT102() {
+
+  return
+    " 1.001000+3 9.991673-1          0          0          0          0 125 3102     \n"
+    " 2.224631+6 2.224631+6          0          0          1          3 125 3102     \n"
+    "          3          5                                             125 3102     \n"
+    " 1.000000-5 1.672869+1 1.000000+0 1.672869-2 2.000000+7 2.722858-5 125 3102     \n"
+    "                                                                   125 3  0     \n";
+}
+
+std::string chunkMF6() {
+  return
+    " 9.223500+4 2.330248+2          0          2         11          09228 6  5     \n"
+    " 1.001000+3 9.986234-1          0          1          1          29228 6  5     \n"
+    "          2          2                                            9228 6  5     \n"
+    " 1.000000-5 1.000000+0 2.000000+7 1.000000+0                      9228 6  5     \n"
+    " 0.000000+0 0.000000+0          1          2          1          29228 6  5     \n"
+    "          2          1                                            9228 6  5     \n"
+    " 0.000000+0 1.000000-5          0          1         12          49228 6  5     \n"
+    " 1.000000+0 2.000000+0 3.000000+0 4.000000+0 5.000000+0 6.000000+09228 6  5     \n"
+    " 7.000000+0 8.000000+0 9.000000+0 1.000000+1 1.100000+1 1.200000+19228 6  5     \n"
+    " 0.000000+0 2.000000+7          0          1          6          29228 6  5     \n"
+    " 1.000000+0 2.000000+0 3.000000+0 4.000000+0 5.000000+0 6.000000+09228 6  5     \n"
+    " 1.000000+0 1.000000+0          0          1          1          29228 6  5     \n"
+    "          2          2                                            9228 6  5     \n"
+    " 1.000000-5 1.000000+0 2.000000+7 1.000000+0                      9228 6  5     \n"
+    " 0.000000+0 0.000000+0          2          2          1          29228 6  5     \n"
+    "          2          1                                            9228 6  5     \n"
+    " 0.000000+0 1.000000-5          0          1          6          29228 6  5     \n"
+    " 1.000000+0 2.000000+0 3.000000+0 4.000000+0 5.000000+0 6.000000+09228 6  5     \n"
+    " 0.000000+0 2.000000+7          0          2          8          29228 6  5     \n"
+    " 7.000000+0 8.000000+0 9.000000+0 1.000000+1 1.100000+1 1.200000+19228 6  5     \n"
+    " 1.300000+1 1.400000+1                                            9228 6  5     \n"
+    " 1.000000+0 1.000000+0          0          1          1          29228 6  5     \n"
+    "          2          2                                            9228 6  5     \n"
+    " 1.000000-5 1.000000+0 2.000000+7 1.000000+0                      9228 6  5     \n"
+    " 0.000000+0 0.000000+0         14          2          1          29228 6  5     \n"
+    "          2          1                                            9228 6  5     \n"
+    " 0.000000+0 1.000000-5          0          4         12          29228 6  5     \n"
+    " 1.000000+0 2.000000+0 3.000000+0 4.000000+0 5.000000+0 6.000000+09228 6  5     \n"
+    " 7.000000+0 8.000000+0 9.000000+0 1.000000+1 1.100000+1 1.200000+19228 6  5     \n"
+    " 0.000000+0 2.000000+7          0          4         12          29228 6  5     \n"
+    " 1.300000+1 1.400000+1 1.500000+1 1.600000+1 1.700000+1 1.800000+19228 6  5     \n"
+    " 1.900000+1 2.000000+1 2.100000+1 2.200000+1 2.300000+1 2.400000+19228 6  5     \n"
+    " 1.000000+0 1.000000+0          0          1          1          29228 6  5     \n"
+    "          2          2                                            9228 6  5     \n"
+    " 1.000000-5 1.000000+0 2.000000+7 1.000000+0                      9228 6  5     \n"
+    " 0.000000+0 0.000000+0          3          1          1          19228 6  5     \n"
+    "          1          2                                            9228 6  5     \n"
+    " 0.000000+0 1.000000-5          0          0          6          39228 6  5     \n"
+    " 1.000000+0 2.000000+0 3.000000+0 4.000000+0 5.000000+0 6.000000+09228 6  5     \n"
+    " 1.000000+0 1.000000+0          0          2          1          29228 6  5     \n"
+    "          2          2                                            9228 6  5     \n"
+    " 1.000000-5 1.000000+0 2.000000+7 1.000000+0                      9228 6  5     \n"
+    " 0.000000+0 0.000000+0          0          0          1          29228 6  5     \n"
+    "          2          1                                            9228 6  5     \n"
+    " 0.000000+0 1.000000-5          0          0          4          49228 6  5     \n"
+    " 1.000000+0 2.000000+0 3.000000+0 4.000000+0                      9228 6  5     \n"
+    " 0.000000+0 2.000000+7         12          0          6          39228 6  5     \n"
+    " 1.000000+0 2.000000+0 3.000000+0 4.000000+0 5.000000+0 6.000000+09228 6  5     \n"
+    " 1.000000+0 1.000000+0          0          3          1          29228 6  5     \n"
+    "          2          2                                            9228 6  5     \n"
+    " 1.000000-5 1.000000+0 2.000000+7 1.000000+0                      9228 6  5     \n"
+    " 1.000000+0 1.000000+0          0          4          1          29228 6  5     \n"
+    "          2          2                                            9228 6  5     \n"
+    " 1.000000-5 1.000000+0 2.000000+7 1.000000+0                      9228 6  5     \n"
+    " 1.001000+3 9.986234-1          0          5          1          29228 6  5     \n"
+    "          2          2                                            9228 6  5     \n"
+    " 1.000000-5 1.000000+0 2.000000+7 1.000000+0                      9228 6  5     \n"
+    " 5.000000-1 0.000000+0          1          0          1          29228 6  5     \n"
+    "          2          1                                            9228 6  5     \n"
+    " 0.000000+0 1.000000-5          1          0         12          39228 6  5     \n"
+    " 1.000000+0 2.000000+0 3.000000+0 4.000000+0 5.000000+0 6.000000+09228 6  5     \n"
+    " 7.000000+0 8.000000+0 9.000000+0 1.000000+1 1.100000+1 1.200000+19228 6  5     \n"
+    " 0.000000+0 2.000000+7         15          0          6          39228 6  5     \n"
+    " 1.000000+0 2.000000+0 3.000000+0 4.000000+0 5.000000+0 6.000000+09228 6  5     \n"
+    " 1.000000+0 1.000000+0          0          6          1          29228 6  5     \n"
+    "          2          2                                            9228 6  5     \n"
+    " 1.000000-5 1.000000+0 2.000000+7 1.000000+0                      9228 6  5     \n"
+    " 5.000000+0 0.000000+0          0          0          0          49228 6  5     \n"
+    " 1.000000+0 1.000000+0          0          7          1          29228 6  5     \n"
+    "          2          2                                            9228 6  5     \n"
+    " 1.000000-5 1.000000+0 2.000000+7 1.000000+0                      9228 6  5     \n"
+    " 0.000000+0 0.000000+0          0          0          1          29228 6  5     \n"
+    "          2          1                                            9228 6  5     \n"
+    " 0.000000+0 1.000000-5          0          0          1          29228 6  5     \n"
+    "          2          4                                            9228 6  5     \n"
+    " 0.000000+0 1.000000+0          0          0          1          49228 6  5     \n"
+    "          4          2                                            9228 6  5     \n"
+    " 1.000000-5 0.000000+0 1.100000+7 2.000000+0 1.147000+7 4.000000+09228 6  5     \n"
+    " 3.000000+7 6.000000+0                                            9228 6  5     \n"
+    " 0.000000+0-1.000000+0          0          0          1          39228 6  5     \n"
+    "          3          2                                            9228 6  5     \n"
+    " 1.000000-5 6.000000+0 1.000000+6 4.000000+0 3.000000+7 2.000000+09228 6  5     \n"
+    " 0.000000+0 2.000000+7          0          0          1          29228 6  5     \n"
+    "          2          4                                            9228 6  5     \n"
+    " 0.000000+0 9.000000-1          0          0          1          49228 6  5     \n"
+    "          4          2                                            9228 6  5     \n"
+    " 1.000000-5 1.000000+0 1.100000+7 3.000000+0 1.147000+7 5.000000+09228 6  5     \n"
+    " 3.000000+7 7.000000+0                                            9228 6  5     \n"
+    " 0.000000+0-9.000000-1          0          0          1          39228 6  5     \n"
+    "          3          2                                            9228 6  5     \n"
+    " 1.000000-5 5.000000+0 1.000000+6 3.000000+0 3.000000+7 1.000000+09228 6  5     \n"
+    " 0.000000+0 0.000000+0          0          0          1          29228 6  5     \n"
+    "          2          2                                            9228 6  5     \n"
+    " 1.000000-5 1.000000+0 2.000000+7 1.000000+0                      9228 6  5     \n";
+}
+
+std::string chunkMF6MT18() {
+  return
+    " 9.223500+4 2.330248+2          0          0          1          09228 6 18     \n"
+    " 1.000000+0 1.000000+0          0         -4          1          29228 6 18     \n"
+    "          2          2                                            9228 6 18     \n"
+    " 1.000000-5 1.000000+0 2.000000+7 1.000000+0                      9228 6 18     \n";
+}
+
+std::string chunkMF7MT4Analytical() {
+  return
+    " 1.270000+2 8.934780+0          0          1          0          0  27 7  4     \n"
+    " 0.000000+0 0.000000+0          0          0          6          0  27 7  4     \n"
+    " 0.000000+0 1.976285+2 8.934780+0 5.000001+0 0.000000+0 1.000000+0  27 7  4     \n"
+    " 0.000000+0 0.000000+0          0          0          1          3  27 7  4     \n"
+    "          3          2                                              27 7  4     \n"
+    " 2.936000+2 5.332083+2 6.000000+2 7.354726+2 1.200000+3 1.270678+3  27 7  4     \n";
+}
+
+std::string chunkMF7MT4Tabulated() {
+  return
+    " 1.270000+2 8.934780+0          0          1          0          0  27 7  4     \n"
+    " 0.000000+0 0.000000+0          0          0         12          1  27 7  4     \n"
+    " 6.153875+0 1.976285+2 8.934780+0 5.000001+0 0.000000+0 1.000000+0  27 7  4     \n"
+    " 0.000000+0 3.748750+0 1.586200+1 0.000000+0 0.000000+0 2.000000+0  27 7  4     \n"
+    " 0.000000+0 0.000000+0          0          0          1          2  27 7  4     \n"
+    "          2          4                                              27 7  4     \n"
+    " 2.936000+2 0.000000+0          1          0          1          5  27 7  4     \n"
+    "          5          4                                              27 7  4     \n"
+    " 4.423802-3 2.386876-4 4.649528-3 2.508466-4 4.886772-3 2.636238-4  27 7  4     \n"
+    " 8.418068+1 1.306574-9 8.847604+1 5.29573-10                        27 7  4     \n"
+    " 4.000000+2 0.000000+0          4          0          5          0  27 7  4     \n"
+    " 4.430020-4 4.655671-4 4.892796-4 4.510209-8 2.183942-8             27 7  4     \n"
+    " 2.936000+2 3.952570-2          1          0          1          5  27 7  4     \n"
+    "          5          2                                              27 7  4     \n"
+    " 4.423802-3 2.386694-4 4.649528-3 2.508273-4 4.886772-3 2.636238-4  27 7  4     \n"
+    " 8.418068+1 2.770291-4 8.847604+1 2.911373-4                        27 7  4     \n"
+    " 4.000000+2 3.952570-2          4          0          5          0  27 7  4     \n"
+    " 6.921141-4 7.273641-4 7.644060-4 8.033305-4 8.442328-4             27 7  4     \n"
+    " 0.000000+0 0.000000+0          0          0          1          3  27 7  4     \n"
+    "          3          2                                              27 7  4     \n"
+    " 2.936000+2 5.332083+2 6.000000+2 7.354726+2 1.200000+3 1.270678+3  27 7  4     \n"
+    " 0.000000+0 0.000000+0          0          0          1          2  27 7  4     \n"
+    "          2          2                                              27 7  4     \n"
+    " 2.936000+2 3.000000+2 1.200000+3 1.250000+3                        27 7  4     \n";
+}
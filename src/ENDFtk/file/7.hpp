@@ -53,6 +53,7 @@ namespace file {
     using Base::section;
     using Base::MT;
     using Base::print;
+    using Base::parseSection;
   };
 
 } // file namespace
@@ -142,6 +142,26 @@ namespace file {
       return this->section( mt );
     }
 
+    /**
+     *  @brief Read a single section of the file (from a buffer)
+     *
+     *  This allows the sections of a file to be read independently of each
+     *  other, after which the file can be constructed from the sections.
+     *
+     *  @tparam Iterator        a buffer iterator
+     *
+     *  @param[in] begin        the current position in the buffer
+     *  @param[in] end          the end of the buffer
+     *  @param[in] lineNumber   the current line number
+     */
+    template< typename Iterator >
+    static Section parseSection( Iterator& begin, const Iterator& end,
+                                 long& lineNumber ) {
+
+      StructureDivision division( begin, end, lineNumber );
+      return Derived::readSection( division, begin, end, lineNumber );
+    }
+
     #include "ENDFtk/file/Base/src/print.hpp"
   };
 
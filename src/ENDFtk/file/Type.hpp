@@ -48,6 +48,7 @@ namespace file {
     using Parent::section;
     using Parent::MT;
     using Parent::print;
+    using Parent::parseSection;
   };
 
 } // file namespace
@@ -0,0 +1,113 @@
+#ifndef NJOY_ENDFTK_MEMORYUSAGE_FUNCTIONS
+#define NJOY_ENDFTK_MEMORYUSAGE_FUNCTIONS
+
+// system includes
+#include <map>
+#include <variant>
+
+// other includes
+#include "ENDFtk/MemoryUsage.hpp"
+#include "ENDFtk/Material.hpp"
+#include "ENDFtk/Tape.hpp"
+
+namespace njoy {
+namespace ENDFtk {
+
+  /**
+   *  @brief Return the memory used by a parsed section
+   *
+   *  The memory used by the values is the memory owned by the records and
+   *  components of the section (see the memoryUsage() method of the section),
+   *  the overhead includes the size of the section object. Lazily decoded
+   *  values are not decoded.
+   *
+   *  @param[in] section   the parsed section
+   */
+  template< int MF, int... MT >
+  MemoryUsage memoryUsage( const section::Type< MF, MT... >& section ) {
+
+    MemoryUsage usage = section.memoryUsage();
+    usage.overhead += sizeof( section );
+    return usage;
+  }
+
+  /**
+   *  @brief Return the memory used by a parsed file
+   *
+   *  @param[in] file   the parsed file
+   */
+  template< int MF >
+  MemoryUsage memoryUsage( const file::Type< MF >& file ) {
+
+    MemoryUsage usage;
+    usage.overhead += sizeof( file );
+    if constexpr ( MF != 30 ) {
+
+      for ( const auto& entry : file.sections() ) {
+
+        using Section = std::decay_t< decltype( entry ) >;
+        usage.overhead += MemoryUsage::node< int, Section >();
+        if constexpr ( std::is_same_v< Section, section::Type< MF > > ) {
+
+          usage += memoryUsage( entry );
+        }
+        else {
+
+          usage.overhead += sizeof( Section );
+          std::visit( [&usage] ( const auto& value ) {
+
+                        usage += memoryUsage( value );
+                        usage.overhead -= sizeof( value );
+                      },
+                      entry );
+        }
+      }
+    }
+    return usage;
+  }
+
+  /**
+   *  @brief Return the memory used by a parsed material
+   *
+   *  @param[in] material   the parsed material
+   */
+  inline MemoryUsage memoryUsage( const Material& material ) {
+
+    using FileVariant = Material::FileVariant;
+
+    MemoryUsage usage;
+    usage.overhead += sizeof( material );
+    for ( const auto& file : material.files() ) {
+
+      usage.overhead += MemoryUsage::node< int, FileVariant >()
+                        + sizeof( FileVariant );
+      std::visit( [&usage] ( const auto& value ) {
+
+                    usage += memoryUsage( value );
+                    usage.overhead -= sizeof( value );
+                  },
+                  file );
+    }
+    return usage;
+  }
+
+  /**
+   *  @brief Return the memory used by a parsed tape
+   *
+   *  @param[in] tape   the parsed tape
+   */
+  inline MemoryUsage memoryUsage( const Tape& tape ) {
+
+    MemoryUsage usage;
+    usage.overhead += sizeof( tape );
+    for ( const auto& material : tape.materials() ) {
+
+      usage += memoryUsage( material );
+    }
+    return usage;
+  }
+
+} // ENDFtk namespace
+} // njoy namespace
+
+#endif
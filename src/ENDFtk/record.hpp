@@ -4,9 +4,15 @@
 #include "ENDFtk/record/Character.hpp"
 #include "ENDFtk/record/Integer.hpp"
 #include "ENDFtk/record/Real.hpp"
+#include "ENDFtk/record/RealFormatter.hpp"
 #include "ENDFtk/record/Base.hpp"
 #include "ENDFtk/record/Zipper.hpp"
 #include "ENDFtk/record/Sequence.hpp"
+#include "ENDFtk/record/LazyValues.hpp"
+#include "ENDFtk/record/RealValues.hpp"
+#include "ENDFtk/record/narrow.hpp"
 #include "ENDFtk/record/skip.hpp"
+#include "ENDFtk/record/ScannedDivision.hpp"
+#include "ENDFtk/record/scan.hpp"
 #include "ENDFtk/record/InterpolationBase.hpp"
 #include "ENDFtk/record/IntegerBase.hpp"
@@ -6,6 +6,7 @@
 
 // other includes
 #include "range/v3/view/all.hpp"
+#include "ENDFtk/ParseError.hpp"
 #include "ENDFtk/record/Integer.hpp"
 #include "ENDFtk/record/Zipper.hpp"
 
@@ -58,12 +58,14 @@ IntegerBase( Iterator& it, const Iterator& end, long& lineNumber,
                     it, end, lineNumber, MAT, MF, MT ) {}
   catch ( int nPosition ) {
 
+    ParseError::Context::report( "INTG", nPosition );
     Log::info( "Error in position {}", nPosition );
     Log::info( "Error encountered while parsing INTG record" );
     throw std::exception();
   }
   catch ( std::exception& e ) {
 
+    ParseError::Context::report( "INTG" );
     Log::info( "Error encountered while parsing INTG record" );
     throw e;
   }
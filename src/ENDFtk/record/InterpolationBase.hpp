@@ -2,13 +2,17 @@
 #define NJOY_ENDFTK_RECORD_INTERPOLATIONBASE
 
 // system includes
+#include <memory_resource>
 #include <vector>
 
 // other includes
 #include "range/v3/view/all.hpp"
+#include "ENDFtk/MemoryUsage.hpp"
+#include "ENDFtk/ParseOptions.hpp"
 #include "ENDFtk/record/Base.hpp"
 #include "ENDFtk/record/Integer.hpp"
 #include "ENDFtk/record/Real.hpp"
+#include "ENDFtk/record/StoredValues.hpp"
 #include "ENDFtk/record/TailVerifying.hpp"
 #include "ENDFtk/record/Zipper.hpp"
 
@@ -28,8 +32,8 @@ namespace record {
     /* fields */
     Base metadata;
 
-    std::vector< long > boundaryIndices;
-    std::vector< long > interpolationSchemeIndices;
+    record::StoredValues< long > boundaryIndices;
+    record::StoredValues< long > interpolationSchemeIndices;
 
     /* auxiliary methods */
     #include "ENDFtk/record/InterpolationBase/src/verifyN2.hpp"
@@ -95,6 +99,14 @@ namespace record {
 
     long NC() const { return 1 + ( this->NR() + 2 ) / 3; }
 
+    MemoryUsage memoryUsage() const {
+
+      MemoryUsage usage;
+      usage.add( this->boundaryIndices );
+      usage.add( this->interpolationSchemeIndices );
+      return usage;
+    }
+
     #include "ENDFtk/record/InterpolationBase/src/print.hpp"
   };
 
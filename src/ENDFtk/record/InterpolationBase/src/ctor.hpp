@@ -11,8 +11,20 @@ InterpolationBase
   std::vector< long >&& boundaryIndices,
   std::vector< long >&& interpolationSchemeIndices ) :
   metadata( C1, C2, L1, L2, boundaryIndices.size(), boundaryIndices.back() ),
-  boundaryIndices( std::move(boundaryIndices) ),
-  interpolationSchemeIndices( std::move(interpolationSchemeIndices) ) {
+  boundaryIndices( std::move( boundaryIndices ) ),
+  interpolationSchemeIndices( std::move( interpolationSchemeIndices ) ) {
+  verifyVectorSizes( this->boundaryIndices, this->interpolationSchemeIndices );
+  verifyBoundaryIndicesAreSorted( this->boundaryIndices );
+}
+
+template< typename Allocator >
+InterpolationBase
+( double C1, double C2, long L1, long L2,
+  std::vector< long, Allocator >&& boundaryIndices,
+  std::vector< long, Allocator >&& interpolationSchemeIndices ) :
+  metadata( C1, C2, L1, L2, boundaryIndices.size(), boundaryIndices.back() ),
+  boundaryIndices( std::move( boundaryIndices ) ),
+  interpolationSchemeIndices( std::move( interpolationSchemeIndices ) ) {
   verifyVectorSizes( this->boundaryIndices, this->interpolationSchemeIndices );
   verifyBoundaryIndicesAreSorted( this->boundaryIndices );
 }
@@ -28,13 +40,14 @@ protected:
 
 InterpolationBase
 ( Base&& metadata,
-  std::tuple< std::vector< long >, std::vector< long > >&& regions ) :
-  InterpolationBase( std::get<0>( metadata.fields ),
-                     std::get<1>( metadata.fields ),
-                     std::get<2>( metadata.fields ),
-                     std::get<3>( metadata.fields ),
-                     std::move( std::get<0>( regions ) ),
-                     std::move( std::get<1>( regions ) ) ) {
+  std::tuple< std::pmr::vector< long >, std::pmr::vector< long > >&& regions ) :
+  metadata( std::get<0>( metadata.fields ), std::get<1>( metadata.fields ),
+            std::get<2>( metadata.fields ), std::get<3>( metadata.fields ),
+            std::get<0>( regions ).size(), std::get<0>( regions ).back() ),
+  boundaryIndices( std::move( std::get<0>( regions ) ) ),
+  interpolationSchemeIndices( std::move( std::get<1>( regions ) ) ) {
+  verifyVectorSizes( this->boundaryIndices, this->interpolationSchemeIndices );
+  verifyBoundaryIndicesAreSorted( this->boundaryIndices );
   verifyN2( std::get<5>( metadata.fields ), this->boundaryIndices.back() );
 }
 
@@ -1,12 +1,13 @@
 template< typename Iterator >
-static std::tuple< std::vector< long >, std::vector< long > >
+static std::tuple< std::pmr::vector< long >, std::pmr::vector< long > >
 readRangeDescriptions
 ( long nRanges, Iterator& it, const Iterator& end, long& lineNumber,
   int MAT, int MF, int MT ){
   try{
-    std::tuple< std::vector< long >, std::vector< long > > result;
-    result = record::Zipper::unzip< record::Integer<11>, record::Integer<11> >
-             ( nRanges, it, end, lineNumber, MAT, MF, MT );
+    auto result =
+      record::Zipper::unzip< record::Integer<11>, record::Integer<11> >
+      ( ParseOptions::activeMemoryResource(),
+        nRanges, it, end, lineNumber, MAT, MF, MT );
     auto& boundaryIndices = std::get< 0 >( result );
     verifyBoundaryIndicesAreSorted( boundaryIndices );
     return result;
@@ -1,5 +1,6 @@
+template< typename Values >
 static void
-verifyBoundaryIndicesAreSorted( const std::vector< long >& boundaryIndices ){
+verifyBoundaryIndicesAreSorted( const Values& boundaryIndices ){
   auto boundaryIndexIterator = 
     std::is_sorted_until( boundaryIndices.begin(), boundaryIndices.end() );
 
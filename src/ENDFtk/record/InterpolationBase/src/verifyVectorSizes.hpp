@@ -1,6 +1,7 @@
+template< typename Values >
 static void
-verifyVectorSizes( const std::vector< long >& boundaryIndices,
-                   const std::vector< long >& interpolationSchemeIndices ) {
+verifyVectorSizes( const Values& boundaryIndices,
+                   const Values& interpolationSchemeIndices ) {
   const bool mismatchedRegionVectorLengths =
     ( boundaryIndices.size() != interpolationSchemeIndices.size() );
 
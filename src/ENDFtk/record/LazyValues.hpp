@@ -0,0 +1,160 @@
+#ifndef NJOY_ENDFTK_RECORD_LAZYVALUES
+#define NJOY_ENDFTK_RECORD_LAZYVALUES
+
+// system includes
+#include <algorithm>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+
+// other includes
+#include "ENDFtk/Log.hpp"
+#include "ENDFtk/MemoryUsage.hpp"
+#include "ENDFtk/ParseOptions.hpp"
+#include "ENDFtk/record/RealParser.hpp"
+#include "ENDFtk/record/SharedBuffer.hpp"
+#include "ENDFtk/record/TailVerifying.hpp"
+#include "ENDFtk/record/Zipper.hpp"
+#include "ENDFtk/record/scan.hpp"
+
+namespace njoy {
+namespace ENDFtk {
+namespace record {
+
+  /**
+   *  @class
+   *  @brief The encoded values of a multi-line record, decoded on first
+   *         access
+   *
+   *  At construction, the lines of the record are verified (every line must
+   *  contain the 66 data columns, valid value fields and a MAT, MF and MT
+   *  number consistent with the expected values) and the lines are retained
+   *  without decoding the values. The value fields are only scanned, so
+   *  that a syntax error is reported at construction. Errors found by the
+   *  verification function given to values() (e.g. x values that are not
+   *  sorted) are only reported when the values are requested.
+   *
+   *  When the lines lie within the active shared buffer (see SharedBuffer),
+   *  the record shares ownership of that buffer instead of copying the
+   *  lines. This keeps the entire buffer (the content of the section or the
+   *  memory mapped file it refers to) alive for as long as a copy of the
+   *  record whose values have not been decoded exists, even if that record
+   *  is only a few lines long. Requesting the values releases the buffer.
+   *  Records that are kept after their section or file is no longer needed
+   *  should be read without lazy decoding (or their values requested).
+   *
+   *  The values are decoded (as Zipper::unzip would) the first time they are
+   *  requested, using the parse options that were active at construction.
+   *  The result is cached and shared between copies, and decoding is done
+   *  only once when the values are requested concurrently.
+   */
+  template< typename... ENDFTypes >
+  class LazyValues {
+
+  public:
+
+    using Values = std::tuple< std::pmr::vector< typename ENDFTypes::Type >... >;
+
+  private:
+
+    using tail = TailVerifying< MAT, MF, MT >;
+    using Zip = Zipper::Zipped< ENDFTypes... >;
+
+    struct State {
+
+      std::shared_ptr< const void > buffer;
+      std::string_view lines;
+      bool shared = false;
+      uint64_t nEntries;
+      long lineNumber;
+      int mat, mf, mt;
+      ParseOptions options;
+
+      std::once_flag decoded;
+      std::optional< Values > values;
+      std::exception_ptr error;
+    };
+
+    /* fields */
+    std::shared_ptr< State > state_;
+
+    /* auxiliary functions */
+    #include "ENDFtk/record/LazyValues/src/verifyLine.hpp"
+
+  public:
+
+    /* constructor */
+    #include "ENDFtk/record/LazyValues/src/ctor.hpp"
+
+    /**
+     *  @brief Return whether or not values should be decoded lazily when
+     *         reading from the given iterator type
+     *
+     *  Lazy decoding is used when it is requested in the active parse options
+     *  and the buffer is contiguous, unless single precision storage is
+     *  requested as well (the values are then narrowed while parsing).
+     */
+    template< typename Iterator >
+    static bool enabled() {
+
+      const auto& options = ParseOptions::active();
+      return isContiguous< Iterator > and options.lazy and
+             not options.singlePrecision;
+    }
+
+    /**
+     *  @brief Return whether or not there are encoded values
+     */
+    explicit operator bool() const { return bool( this->state_ ); }
+
+    /**
+     *  @brief Return the number of encoded entries
+     */
+    uint64_t size() const { return this->state_->nEntries; }
+
+    /**
+     *  @brief Return whether or not the values have been decoded
+     */
+    bool isDecoded() const { return this->state_->values.has_value(); }
+
+    /**
+     *  @brief Return the memory used by the retained lines and the decoded
+     *         values (if any)
+     *
+     *  The memory is shared between copies. Lines that lie within a shared
+     *  buffer are reported as mapped text since they are not owned.
+     */
+    MemoryUsage memoryUsage() const {
+
+      MemoryUsage usage;
+      if ( this->state_ ) {
+
+        ( this->state_->shared ? usage.mapped : usage.text ) +=
+            this->state_->lines.size();
+        if ( this->isDecoded() ) {
+
+          std::apply( [&usage] ( const auto&... values ) {
+
+                        ( usage.add( values ), ... );
+                      },
+                      *this->state_->values );
+        }
+      }
+      return usage;
+    }
+
+    #include "ENDFtk/record/LazyValues/src/values.hpp"
+  };
+
+} // record namespace
+} // ENDFtk namespace
+} // njoy namespace
+
+#endif
@@ -0,0 +1,70 @@
+/**
+ *  @brief Default constructor (no encoded values)
+ */
+LazyValues() = default;
+
+/**
+ *  @brief Constructor (from a buffer)
+ *
+ *  The syntax of the value fields is verified while the lines are read,
+ *  without decoding the values, so that an invalid field is reported by
+ *  the constructor of the record and not by a later access to the values.
+ *
+ *  @tparam Iterator        a buffer iterator
+ *
+ *  @param[in] nEntries     the number of entries in the record
+ *  @param[in] it           the current position in the buffer
+ *  @param[in] end          the end of the buffer
+ *  @param[in] lineNumber   the current line number
+ *  @param[in] MAT          the expected MAT number
+ *  @param[in] MF           the expected MF number
+ *  @param[in] MT           the expected MT number
+ */
+template< typename Iterator >
+LazyValues( uint64_t nEntries,
+            Iterator& it, const Iterator& end, long& lineNumber,
+            int MAT, int MF, int MT ) :
+  state_( std::make_shared< State >() ) {
+
+  const auto begin = it;
+  this->state_->lineNumber = lineNumber;
+
+  uint64_t remaining = nEntries;
+  uint64_t nLines = ( nEntries + Zip::tuplesPerRecord - 1 ) /
+                    Zip::tuplesPerRecord;
+  while ( nLines-- ) {
+
+    const uint64_t nTuples = std::min< uint64_t >( remaining,
+                                                   Zip::tuplesPerRecord );
+    verifyLine( nTuples, it, end, lineNumber, MAT, MF, MT );
+    remaining -= nTuples;
+  }
+
+  const auto& shared = SharedBuffer::active();
+  if constexpr ( isContiguous< Iterator > ) {
+
+    const auto size = std::distance( begin, it );
+    const std::string_view lines( size ? &*begin : "", size );
+    if ( shared.contains( lines ) ) {
+
+      this->state_->buffer = shared.owner;
+      this->state_->lines = lines;
+      this->state_->shared = true;
+    }
+  }
+  if ( not this->state_->shared ) {
+
+    auto copy = std::make_shared< const std::string >( begin, it );
+    this->state_->lines = *copy;
+    this->state_->buffer = std::move( copy );
+  }
+  this->state_->nEntries = nEntries;
+  this->state_->mat = MAT;
+  this->state_->mf = MF;
+  this->state_->mt = MT;
+
+  // the tails were verified, they do not need to be verified again
+  this->state_->options = ParseOptions::active();
+  this->state_->options.verifyTails = false;
+  this->state_->options.lazy = false;
+}
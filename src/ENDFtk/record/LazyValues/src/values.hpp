@@ -0,0 +1,55 @@
+/**
+ *  @brief Return the decoded values, decoding them if required
+ *
+ *  The verification function is applied to the values right after they are
+ *  decoded. It should throw an exception if the values are not valid.
+ *
+ *  @param[in] verify   the verification function
+ */
+template< typename Verify >
+const Values& values( const Verify& verify ) const {
+
+  State& state = *this->state_;
+  std::call_once( state.decoded, [&] {
+
+    try {
+
+      ParseOptions::Scope scope( state.options );
+      auto position = state.lines.cbegin();
+      auto end = state.lines.cend();
+      long lineNumber = state.lineNumber;
+      Values values = Zipper::unzip< ENDFTypes... >(
+                          ParseOptions::activeMemoryResource(), state.nEntries,
+                          position, end, lineNumber,
+                          state.mat, state.mf, state.mt );
+      verify( values );
+      state.values.emplace( std::move( values ) );
+      state.lines = std::string_view();
+      state.buffer.reset();
+    }
+    catch ( int position ) {
+
+      Log::info( "Error in position {}", position );
+      state.error = std::make_exception_ptr( std::exception() );
+    }
+    catch ( ... ) {
+
+      state.error = std::current_exception();
+    }
+  } );
+
+  if ( state.error ) {
+
+    Log::info( "Error encountered while decoding the values of a record" );
+    std::rethrow_exception( state.error );
+  }
+  return *state.values;
+}
+
+/**
+ *  @brief Return the decoded values, decoding them if required
+ */
+const Values& values() const {
+
+  return this->values( [] ( const Values& ) {} );
+}
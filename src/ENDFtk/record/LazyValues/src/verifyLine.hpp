@@ -0,0 +1,49 @@
+template< typename ENDFType >
+static bool isValidField( const char*& field, bool leftover ) {
+
+  const std::string_view characters( field, ENDFType::width );
+  field += ENDFType::width;
+  if constexpr ( std::is_same< typename ENDFType::Parser, RealParser >::value ) {
+
+    // unused fields are decoded since they must be zero
+    double value = 0.;
+    return leftover ? RealParser::decode( characters, value ) &&
+                      ( value == ENDFType::defaultValue )
+                    : RealParser::isValid( characters );
+  }
+  else {
+
+    long value = 0;
+    return readInteger( characters.begin(), 0, ENDFType::width, value ) &&
+           ( not leftover || ( value == ENDFType::defaultValue ) );
+  }
+}
+
+template< typename Iterator >
+static void
+verifyLine( uint64_t nTuples,
+            Iterator& it, const Iterator& end, long& lineNumber,
+            int MAT, int MF, int MT ){
+  if ( std::distance( it, findLineEnd( it, end ) ) < 66 ){
+    Log::error( "The record line does not contain the expected number of "
+                "columns" );
+    Log::info( "Line number: {}", lineNumber );
+    throw std::exception();
+  }
+
+  char columns[ 66 ];
+  std::copy_n( it, 66, columns );
+  const char* field = columns;
+  for ( uint64_t tuple = 0; tuple < Zip::tuplesPerRecord; ++tuple ) {
+    const bool leftover = tuple >= nTuples;
+    if ( not ( isValidField< ENDFTypes >( field, leftover ) && ... ) ){
+      Log::error( "Encountered an invalid value in the record" );
+      Log::info( "Line number: {}", lineNumber );
+      Log::info( "Line: \"{}\"", std::string_view( columns, 66 ) );
+      throw std::exception();
+    }
+  }
+
+  std::advance( it, 66 );
+  tail( MAT, MF, MT, it, end, lineNumber );
+}
@@ -0,0 +1,236 @@
+// include Catch2
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+using Catch::Matchers::WithinRel;
+
+// what we are testing
+#include "ENDFtk/record/LazyValues.hpp"
+
+// other includes
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <thread>
+#include <vector>
+
+// convenience typedefs
+using namespace njoy::ENDFtk;
+using namespace njoy::ENDFtk::record;
+
+SCENARIO( "LazyValues" ) {
+
+  GIVEN( "a record with a sequence of values" ) {
+
+    std::string line =
+      " 1.000000+0 2.000000+0 3.000000+0 4.000000+0 5.000000+0 6.000000+0 125 1451    1\n"
+      " 7.000000+0 8.000000+0 9.000000+0 1.000000+1 1.100000+1 1.200000+1 125 1451    2\n"
+      " 1.300000+1 1.400000+1                                             125 1451    3\n";
+
+    WHEN( "the values are read lazily" ) {
+
+      auto it = line.begin();
+      auto end = line.end();
+      long lineNumber = 0;
+      LazyValues< Real > lazy( 14, it, end, lineNumber, 125, 1, 451 );
+
+      THEN( "the lines are consumed but the values are not decoded" ) {
+
+        CHECK( true == bool( lazy ) );
+        CHECK( 14 == lazy.size() );
+        CHECK( false == lazy.isDecoded() );
+        CHECK( end == it );
+        CHECK( 3 == lineNumber );
+      } // THEN
+
+      THEN( "the values are decoded on first access and shared with copies" ) {
+
+        auto copy = lazy;
+        const auto& values = std::get< 0 >( lazy.values() );
+        CHECK( true == lazy.isDecoded() );
+        CHECK( true == copy.isDecoded() );
+        CHECK( &values == &std::get< 0 >( copy.values() ) );
+
+        CHECK( 14 == values.size() );
+        for ( int i = 0; i < 14; ++i ) {
+
+          CHECK_THAT( values[i], WithinRel( double( i + 1 ) ) );
+        }
+      } // THEN
+
+      THEN( "the values are decoded only once when accessed concurrently" ) {
+
+        std::vector< const LazyValues< Real >::Values* > results( 4 );
+        std::vector< std::thread > threads;
+        for ( unsigned int i = 0; i < results.size(); ++i ) {
+
+          threads.emplace_back( [&, i] { results[i] = &lazy.values(); } );
+        }
+        for ( auto& thread : threads ) {
+
+          thread.join();
+        }
+
+        for ( auto result : results ) {
+
+          CHECK( &lazy.values() == result );
+        }
+      } // THEN
+    } // WHEN
+
+    WHEN( "the values are read lazily from a shared buffer" ) {
+
+      auto buffer = std::make_shared< const std::string >( line );
+      auto it = buffer->begin();
+      auto end = buffer->end();
+      long lineNumber = 0;
+      std::optional< LazyValues< Real > > lazy;
+      {
+        SharedBuffer::Scope scope( buffer, *buffer );
+        lazy.emplace( 14, it, end, lineNumber, 125, 1, 451 );
+      }
+
+      THEN( "the buffer is shared until the values are decoded" ) {
+
+        CHECK( 2 == buffer.use_count() );
+        CHECK( 243 == lazy->memoryUsage().mapped );
+        CHECK( 0 == lazy->memoryUsage().text );
+
+        CHECK( 14 == std::get< 0 >( lazy->values() ).size() );
+        CHECK( 1 == buffer.use_count() );
+        CHECK( 0 == lazy->memoryUsage().mapped );
+      } // THEN
+
+      THEN( "the lines are copied when they are not in the shared buffer" ) {
+
+        auto other = line;
+        auto begin = other.begin();
+        lineNumber = 0;
+        SharedBuffer::Scope scope( buffer, *buffer );
+        LazyValues< Real > copy( 14, begin, other.end(), lineNumber,
+                                 125, 1, 451 );
+        CHECK( 243 == copy.memoryUsage().text );
+        CHECK( 0 == copy.memoryUsage().mapped );
+      } // THEN
+    } // WHEN
+
+    WHEN( "the pairs are read lazily" ) {
+
+      auto it = line.begin();
+      auto end = line.end();
+      long lineNumber = 0;
+      LazyValues< Real, Real > lazy( 7, it, end, lineNumber, 125, 1, 451 );
+
+      THEN( "the values are decoded on first access" ) {
+
+        const auto& values = lazy.values();
+        CHECK( 7 == std::get< 0 >( values ).size() );
+        CHECK( 7 == std::get< 1 >( values ).size() );
+        for ( int i = 0; i < 7; ++i ) {
+
+          CHECK_THAT( std::get< 0 >( values )[i], WithinRel( double( 2 * i + 1 ) ) );
+          CHECK_THAT( std::get< 1 >( values )[i], WithinRel( double( 2 * i + 2 ) ) );
+        }
+        CHECK( end == it );
+        CHECK( 3 == lineNumber );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+
+  GIVEN( "invalid records" ) {
+
+    std::string wrongMT =
+      " 1.000000+0 2.000000+0 3.000000+0 4.000000+0 5.000000+0 6.000000+0 125 1451    1\n"
+      " 7.000000+0 8.000000+0                                             125 1452    2\n";
+    std::string shortLine =
+      " 1.000000+0 2.000000+0 3.000000+0 4.000000+0 5.000000+0 6.000000+0 125 1451    1\n"
+      " 7.000000+0 8.000000+0\n";
+    std::string wrongValue =
+      " 1.000000+0 2.000000+0 3.000000+0 4.000000+0 5.0000a0+0 6.000000+0 125 1451    1\n"
+      " 7.000000+0 8.000000+0                                             125 1451    2\n";
+    std::string nonZeroLeftover =
+      " 1.000000+0 2.000000+0 3.000000+0 4.000000+0 5.000000+0 6.000000+0 125 1451    1\n"
+      " 7.000000+0 8.000000+0 9.000000+0                                  125 1451    2\n";
+    std::string unsorted =
+      " 1.000000+0 2.000000+0 3.000000+0 4.000000+0 5.000000+0 6.000000+0 125 1451    1\n"
+      " 7.000000+0 1.000000+0                                             125 1451    2\n";
+
+    WHEN( "the lines are inconsistent" ) {
+
+      THEN( "an exception is thrown at construction" ) {
+
+        auto it = wrongMT.begin();
+        auto end = wrongMT.end();
+        long lineNumber = 0;
+        CHECK_THROWS( LazyValues< Real >( 8, it, end, lineNumber, 125, 1, 451 ) );
+
+        it = shortLine.begin();
+        end = shortLine.end();
+        lineNumber = 0;
+        CHECK_THROWS( LazyValues< Real >( 8, it, end, lineNumber, 125, 1, 451 ) );
+      } // THEN
+    } // WHEN
+
+    WHEN( "a value is invalid" ) {
+
+      THEN( "an exception is thrown at construction" ) {
+
+        auto it = wrongValue.begin();
+        auto end = wrongValue.end();
+        long lineNumber = 0;
+        CHECK_THROWS( LazyValues< Real >( 8, it, end, lineNumber, 125, 1, 451 ) );
+
+        it = nonZeroLeftover.begin();
+        end = nonZeroLeftover.end();
+        lineNumber = 0;
+        CHECK_THROWS( LazyValues< Real >( 8, it, end, lineNumber, 125, 1, 451 ) );
+      } // THEN
+    } // WHEN
+
+    WHEN( "the values are not valid for the record" ) {
+
+      auto it = unsorted.begin();
+      auto end = unsorted.end();
+      long lineNumber = 0;
+      LazyValues< Real > lazy( 8, it, end, lineNumber, 125, 1, 451 );
+
+      THEN( "an exception is thrown on every access" ) {
+
+        auto verify = [] ( const LazyValues< Real >::Values& values ) {
+
+          const auto& x = std::get< 0 >( values );
+          if ( not std::is_sorted( x.begin(), x.end() ) ) {
+
+            throw std::exception();
+          }
+        };
+        CHECK_THROWS( lazy.values( verify ) );
+        CHECK_THROWS( lazy.values( verify ) );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+
+  GIVEN( "the active parse options" ) {
+
+    WHEN( "lazy decoding is requested" ) {
+
+      ParseOptions options;
+      options.lazy = true;
+      ParseOptions::Scope scope( options );
+
+      THEN( "lazy decoding is only enabled for contiguous buffers" ) {
+
+        CHECK( true == LazyValues< Real >::enabled< std::string::iterator >() );
+        CHECK( false == LazyValues< Real >::enabled<
+                            std::istreambuf_iterator< char > >() );
+      } // THEN
+    } // WHEN
+
+    WHEN( "lazy decoding is not requested" ) {
+
+      THEN( "lazy decoding is not enabled" ) {
+
+        CHECK( false == LazyValues< Real >::enabled< std::string::iterator >() );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+} // SCENARIO
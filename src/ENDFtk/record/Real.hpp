@@ -4,7 +4,7 @@
 // system includes
 
 // other includes
-#include "disco.hpp"
+#include "ENDFtk/record/RealParser.hpp"
 
 namespace njoy {
 namespace ENDFtk {
@@ -13,7 +13,7 @@ namespace record {
   struct Real {
     static constexpr std::size_t width = 11;
     using Type = double;
-    using Parser = disco::ENDF;
+    using Parser = RealParser;
   
     static constexpr Type defaultValue = 0.0;
   };
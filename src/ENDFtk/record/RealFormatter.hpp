@@ -0,0 +1,89 @@
+#ifndef NJOY_ENDFTK_RECORD_REALFORMATTER
+#define NJOY_ENDFTK_RECORD_REALFORMATTER
+
+// system includes
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+// other includes
+#include "disco.hpp"
+
+namespace njoy {
+namespace ENDFtk {
+namespace record {
+
+  /**
+   *  @class
+   *  @brief A fixed width formatter for ENDF floating point fields
+   *
+   *  This formatter replaces the writing of disco::ENDF and produces the
+   *  same 11 character fields: a sign (a blank for positive values), the
+   *  mantissa and a signed exponent without the E character. Seven
+   *  significant digits are used for exponents with a single digit (as in
+   *  1.234567+5), six for exponents with two digits (1.23457-12) and five for
+   *  exponents with three digits. Values are correctly rounded, and a value
+   *  that is rounded up into the next decade uses the number of digits of
+   *  the new exponent. Negative zero is written as zero.
+   *
+   *  The digits are obtained by scaling the value with exact powers of 10
+   *  and rounding the result to an integer. Whenever this could result in a
+   *  rounding that differs from the correctly rounded value (the scaled
+   *  value is too close to halfway between two integers) or when the
+   *  exponent is out of range, the value is formatted using std::snprintf
+   *  instead.
+   */
+  struct RealFormatter : public disco::ENDF {
+
+    static constexpr std::size_t width = 11;
+
+    #include "ENDFtk/record/RealFormatter/src/format.hpp"
+
+    /**
+     *  @brief Write a floating point value as an ENDF field into a buffer
+     *
+     *  Exactly 11 characters are written, without a terminating null
+     *  character. The function returns the position after the field.
+     *
+     *  @param[in] value    the value to be written
+     *  @param[in] buffer   the buffer (at least 11 characters)
+     */
+    static char* write( double value, char* buffer ) {
+
+      if ( std::isfinite( value ) ) {
+
+        format( value, buffer );
+      }
+      else {
+
+        char* position = buffer;
+        disco::ENDF::write( value, position );
+      }
+      return buffer + width;
+    }
+
+    /**
+     *  @brief Write a floating point value as an ENDF field
+     *
+     *  @tparam Iterator   the output iterator type
+     *
+     *  @param[in]     value   the value to be written
+     *  @param[in,out] it      the current position in the output
+     */
+    template< typename Iterator >
+    static void write( double value, Iterator& it ) {
+
+      char field[ width ];
+      write( value, field );
+      it = std::copy( field, field + width, it );
+    }
+  };
+
+} // record namespace
+} // ENDFtk namespace
+} // njoy namespace
+
+#endif
@@ -0,0 +1,176 @@
+/**
+ *  @brief Return the number of decimals used for a given decimal exponent
+ *
+ *  @param[in] exponent   the decimal exponent
+ */
+static constexpr int decimals( int exponent ) {
+
+  return ( exponent > -10 && exponent < 10 ) ? 6
+         : ( exponent > -100 && exponent < 100 ) ? 5 : 4;
+}
+
+/**
+ *  @brief Format a finite floating point value using std::snprintf
+ *
+ *  @param[in] value    the value to be written
+ *  @param[in] buffer   the buffer (at least 11 characters)
+ */
+static void formatSlow( double value, char* buffer ) {
+
+  // format using the number of decimals corresponding to the exponent of
+  // the rounded value
+  char text[ 32 ];
+  int precision = 6;
+  int exponent = 0;
+  for ( int attempt = 0; attempt < 3; ++attempt ) {
+
+    std::snprintf( text, sizeof( text ), "%.*E", precision, value );
+    exponent = std::atoi( std::strchr( text, 'E' ) + 1 );
+    if ( decimals( exponent ) >= precision ) {
+
+      break;
+    }
+    precision = decimals( exponent );
+  }
+
+  // sign, mantissa, sign of the exponent and the exponent without E and
+  // leading zeros (right aligned in the field)
+  char field[ 32 ];
+  char* position = field;
+  const char* mantissa = text;
+  *position++ = *mantissa == '-' ? *mantissa++ : ' ';
+  while ( *mantissa != 'E' ) {
+
+    *position++ = *mantissa++;
+  }
+
+  // a value rounded up into the next decade (e.g. 9.99999949e-10 becomes
+  // 1.00000e-9) can have an exponent that allows more decimals than were
+  // used: the mantissa is then padded with zeros
+  for ( int index = precision; index < decimals( exponent ); ++index ) {
+
+    *position++ = '0';
+  }
+  *position++ = exponent < 0 ? '-' : '+';
+  position += std::snprintf( position, 8, "%d", std::abs( exponent ) );
+
+  const long size = position - field;
+  std::fill( buffer, buffer + std::max( 0l, long( width ) - size ), ' ' );
+  std::copy( field, position, buffer + std::max( 0l, long( width ) - size ) );
+}
+
+/**
+ *  @brief Format a finite floating point value
+ *
+ *  @param[in] value    the value to be written
+ *  @param[in] buffer   the buffer (at least 11 characters)
+ */
+static void format( double value, char* buffer ) {
+
+  // the exact powers of 10 that can be represented as a double
+  static constexpr double powers[] = {
+
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+  };
+
+  // the scaled value is the result of at most two correctly rounded
+  // operations so that its error is well below this margin
+  static constexpr double margin = 1e-7;
+
+  if ( value == 0. ) {
+
+    std::copy( " 0.000000+0", " 0.000000+0" + width, buffer );
+    return;
+  }
+
+  const double absolute = std::abs( value );
+  auto scale = [absolute] ( int power ) {
+
+    double result = absolute;
+    if ( power > 0 ) {
+
+      if ( power > 22 ) { result *= powers[ 22 ]; power -= 22; }
+      result *= powers[ power ];
+    }
+    else if ( power < 0 ) {
+
+      if ( power < -22 ) { result /= powers[ 22 ]; power += 22; }
+      result /= powers[ -power ];
+    }
+    return result;
+  };
+
+  // estimate the decimal exponent from the binary exponent and correct it
+  // using the scaled value (the mantissa is in [ 10^p, 10^(p+1) ) )
+  int binary = 0;
+  std::frexp( absolute, &binary );
+  int exponent = static_cast< int >( std::floor( ( binary - 1 ) * 0.30102999566398120 ) );
+  int precision = 0;
+  double scaled = 0.;
+  bool converged = false;
+  for ( int attempt = 0; attempt < 3; ++attempt ) {
+
+    precision = decimals( exponent );
+    const int power = precision - exponent;
+    if ( ( precision < 5 ) || ( power > 44 ) || ( power < -44 ) ) {
+
+      formatSlow( value, buffer );
+      return;
+    }
+
+    scaled = scale( power );
+    if ( scaled >= powers[ precision + 1 ] ) { ++exponent; }
+    else if ( scaled < powers[ precision ] ) { --exponent; }
+    else { converged = true; break; }
+  }
+
+  // a value within a rounding error of a power of 10 can be scaled above the
+  // range for one exponent and below the range for the next one
+  if ( not converged ) {
+
+    formatSlow( value, buffer );
+    return;
+  }
+
+  // round to the nearest integer when this is unambiguous
+  const double integer = std::floor( scaled );
+  const double fraction = scaled - integer;
+  if ( std::abs( fraction - 0.5 ) < margin ) {
+
+    formatSlow( value, buffer );
+    return;
+  }
+  std::uint64_t digits = static_cast< std::uint64_t >( integer ) +
+                         ( fraction > 0.5 ? 1 : 0 );
+  if ( digits == static_cast< std::uint64_t >( powers[ precision + 1 ] ) ) {
+
+    digits /= 10;
+    ++exponent;
+    if ( decimals( exponent ) != precision ) {
+
+      formatSlow( value, buffer );
+      return;
+    }
+  }
+
+  // sign and mantissa (written from the last digit to the first)
+  buffer[0] = value < 0. ? '-' : ' ';
+  for ( int index = precision + 2; index > 2; --index ) {
+
+    buffer[ index ] = static_cast< char >( '0' + digits % 10 );
+    digits /= 10;
+  }
+  buffer[2] = '.';
+  buffer[1] = static_cast< char >( '0' + digits );
+
+  // exponent
+  char* position = buffer + precision + 3;
+  *position++ = exponent < 0 ? '-' : '+';
+  const int magnitude = std::abs( exponent );
+  if ( magnitude >= 10 ) {
+
+    *position++ = static_cast< char >( '0' + magnitude / 10 );
+  }
+  *position = static_cast< char >( '0' + magnitude % 10 );
+}
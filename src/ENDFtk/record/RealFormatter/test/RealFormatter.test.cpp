@@ -0,0 +1,233 @@
+// include Catch2
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+// what we are testing
+#include "ENDFtk/record/RealFormatter.hpp"
+
+// other includes
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+#include "ENDFtk/record/RealParser.hpp"
+
+// convenience typedefs
+using namespace njoy::ENDFtk;
+
+std::string write( double value ) {
+
+  std::string buffer;
+  auto it = std::back_inserter( buffer );
+  record::RealFormatter::write( value, it );
+  return buffer;
+}
+
+std::string writeDisco( double value ) {
+
+  std::string buffer;
+  auto it = std::back_inserter( buffer );
+  njoy::disco::ENDF::write( value, it );
+  return buffer;
+}
+
+SCENARIO( "record::RealFormatter" ) {
+
+  GIVEN( "values with different exponents" ) {
+
+    WHEN( "the values are written" ) {
+
+      THEN( "the fields are written correctly" ) {
+
+        CHECK( " 0.000000+0" == write( 0. ) );
+        CHECK( " 1.000000+0" == write( 1. ) );
+        CHECK( "-1.000000+0" == write( -1. ) );
+        CHECK( " 1.001000+3" == write( 1001. ) );
+        CHECK( " 9.991673-1" == write( 0.9991673 ) );
+        CHECK( " 2.224631+6" == write( 2.224631e+6 ) );
+        CHECK( " 1.000000-5" == write( 1e-5 ) );
+        CHECK( " 2.722858-5" == write( 2.722858e-5 ) );
+        CHECK( "-1.234567+6" == write( -1.234567e+6 ) );
+        CHECK( " 8.45368-11" == write( 8.45368e-11 ) );
+        CHECK( " 1.00000+11" == write( 1e+11 ) );
+        CHECK( "-6.02040-17" == write( -6.0204e-17 ) );
+        CHECK( " 1.0000+100" == write( 1e+100 ) );
+        CHECK( " 1.2346-120" == write( 1.23456e-120 ) );
+      } // THEN
+
+      THEN( "the values are correctly rounded" ) {
+
+        CHECK( " 1.234568+0" == write( 1.2345675 ) );
+        CHECK( " 1.234568+6" == write( 1234567.5 ) );
+        CHECK( " 1.234568+6" == write( 1234568.5 ) );
+        CHECK( " 1.000000+1" == write( 9.9999996 ) );
+        CHECK( " 9.999999+9" == write( 9.9999994e+9 ) );
+        CHECK( " 1.00000+10" == write( 9.9999996e+9 ) );
+        CHECK( " 1.00000-10" == write( 9.999996e-11 ) );
+      } // THEN
+
+      THEN( "values rounded up into the next decade use the number of digits "
+            "of the new exponent" ) {
+
+        CHECK( " 1.00000+10" == write( 9.9999995e+9 ) );
+        CHECK( "-1.00000+10" == write( -9.9999995e+9 ) );
+        CHECK( " 1.000000-9" == write( 9.99999995e-10 ) );
+        CHECK( " 1.000000-9" == write( 9.99999949e-10 ) );
+        CHECK( " 1.0000+100" == write( 9.999996e+99 ) );
+        CHECK( " 1.00000-99" == write( 9.999996e-100 ) );
+      } // THEN
+
+      THEN( "values on either side of the exponent boundaries are written "
+            "correctly" ) {
+
+        CHECK( " 9.999999+9" == write( 9.999999e+9 ) );
+        CHECK( " 1.00000+10" == write( 1e+10 ) );
+        CHECK( " 1.000000-9" == write( 1e-9 ) );
+        CHECK( " 9.99999-10" == write( 9.99999e-10 ) );
+        CHECK( " 9.99995+99" == write( 9.99995e+99 ) );
+        CHECK( " 1.0000+100" == write( 1e+100 ) );
+        CHECK( " 1.00000-99" == write( 1e-99 ) );
+        CHECK( " 1.0000-100" == write( 1e-100 ) );
+        CHECK( " 1.000000-5" == write( std::nextafter( 1e-5, 0. ) ) );
+        CHECK( " 1.000000-4" == write( std::nextafter( 1e-4, 0. ) ) );
+        CHECK( "-1.000000-1" == write( std::nextafter( -0.1, 0. ) ) );
+      } // THEN
+
+      THEN( "negative zero is written as zero" ) {
+
+        CHECK( " 0.000000+0" == write( -0. ) );
+      } // THEN
+
+      THEN( "exactly 11 characters are written into a buffer" ) {
+
+        char buffer[ 12 ] = "xxxxxxxxxxx";
+        char* position = record::RealFormatter::write( 2.5e-3, buffer );
+        CHECK( buffer + 11 == position );
+        CHECK( std::string( " 2.500000-3" ) == buffer );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+
+  GIVEN( "random values" ) {
+
+    std::mt19937_64 generator( 12345 );
+    std::uniform_real_distribution< double > mantissa( -10., 10. );
+    std::uniform_int_distribution< int > exponent( -99, 99 );
+
+    WHEN( "the values are written" ) {
+
+      THEN( "the fields are identical to those of disco::ENDF and they can be "
+            "read back" ) {
+
+        long different = 0;
+        long unreadable = 0;
+        for ( int i = 0; i < 100000; ++i ) {
+
+          const double value = mantissa( generator ) *
+                               std::pow( 10., exponent( generator ) );
+          const std::string field = write( value );
+          if ( field != writeDisco( value ) ) { ++different; }
+
+          // values below 1e-99 only have 4 decimals
+          double read = 0.;
+          if ( not record::RealParser::decode( field, read ) ||
+               std::abs( read - value ) > 1e-4 * std::abs( value ) ) {
+
+            ++unreadable;
+          }
+        }
+        CHECK( 0 == different );
+        CHECK( 0 == unreadable );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+
+  GIVEN( "values around the rounding boundaries of every decade" ) {
+
+    // values within a few units in the last place of the half-way points that
+    // are rounded into the next decade (for 6, 5, 4 and 3 decimals), of the
+    // powers of 10 and of a half-way point that is not rounded into the next
+    // decade
+    std::vector< double > values;
+    for ( int exponent = -120; exponent <= 120; ++exponent ) {
+
+      const double power = std::pow( 10., exponent );
+      for ( double boundary : { 9.9999995, 9.999995, 9.99995, 9.9995,
+                                10., 1.0000005 } ) {
+
+        double value = boundary * power;
+        for ( int step = 0; step < 3; ++step ) {
+
+          value = std::nextafter( value, 0. );
+        }
+        for ( int step = 0; step < 7; ++step ) {
+
+          values.push_back( value );
+          values.push_back( -value );
+          value = std::nextafter( value, 2. * value );
+        }
+      }
+    }
+
+    WHEN( "the values are written" ) {
+
+      THEN( "the fields are identical to those of disco::ENDF and they can be "
+            "read back" ) {
+
+        long different = 0;
+        long unreadable = 0;
+        for ( double value : values ) {
+
+          const std::string field = write( value );
+          if ( field != writeDisco( value ) ) { ++different; }
+
+          double read = 0.;
+          if ( not record::RealParser::decode( field, read ) ||
+               std::abs( read - value ) > 1e-4 * std::abs( value ) ) {
+
+            ++unreadable;
+          }
+        }
+        CHECK( 0 == different );
+        CHECK( 0 == unreadable );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+} // SCENARIO
+
+TEST_CASE( "Writing real values", "[.][benchmark]" ) {
+
+  std::mt19937_64 generator( 12345 );
+  std::uniform_real_distribution< double > mantissa( -10., 10. );
+  std::uniform_int_distribution< int > exponent( -12, 12 );
+  std::vector< double > values( 100000 );
+  for ( auto& value : values ) {
+
+    value = mantissa( generator ) * std::pow( 10., exponent( generator ) );
+  }
+
+  // divide the number of values by the mean time to get values per second
+  BENCHMARK( "record::RealFormatter" ) {
+
+    std::string buffer;
+    buffer.resize( 11 * values.size() );
+    char* position = buffer.data();
+    for ( auto value : values ) {
+
+      position = record::RealFormatter::write( value, position );
+    }
+    return buffer;
+  };
+
+  BENCHMARK( "disco::ENDF" ) {
+
+    std::string buffer;
+    buffer.reserve( 11 * values.size() );
+    auto it = std::back_inserter( buffer );
+    for ( auto value : values ) {
+
+      njoy::disco::ENDF::write( value, it );
+    }
+    return buffer;
+  };
+}
@@ -0,0 +1,90 @@
+#ifndef NJOY_ENDFTK_RECORD_REALPARSER
+#define NJOY_ENDFTK_RECORD_REALPARSER
+
+// system includes
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string_view>
+
+// other includes
+#include "ENDFtk/Log.hpp"
+#include "disco.hpp"
+
+namespace njoy {
+namespace ENDFtk {
+namespace record {
+
+  /**
+   *  @class
+   *  @brief A fixed width parser for ENDF floating point fields
+   *
+   *  This parser replaces the reading of disco::ENDF (writing is still done
+   *  by disco::ENDF). It decodes all forms of real numbers found in ENDF
+   *  files in an 11 character field: numbers with an implicit exponent
+   *  (1.234567+5, -2.5-3), numbers with an explicit exponent using E or D
+   *  (in upper or lower case), numbers without exponent or decimal point
+   *  and blank fields (which are read as zero).
+   *
+   *  The digits of the field are accumulated into a 64-bit integer (an 11
+   *  character field never has more than 11 digits). The usual mantissa
+   *  form d.dddddd is converted eight characters at a time using 64-bit
+   *  integer arithmetic, the other forms one digit at a time. The value
+   *  is then obtained using a single correctly rounded multiplication or
+   *  division by an exact power of 10 whenever possible. The few remaining
+   *  values (those with a decimal exponent outside of [-22, 22]) are
+   *  converted using std::strtod so that every value is correctly rounded.
+   *
+   *  The syntax of a field can also be verified without decoding the value
+   *  (see isValid()), which is what lazily decoded records do when they are
+   *  constructed.
+   *
+   *  Like disco::ENDF, the parser never reads beyond the end of a line: a
+   *  field that is cut short by the end of the line (or buffer) is decoded
+   *  using the available characters.
+   */
+  struct RealParser : public disco::ENDF {
+
+    static constexpr std::size_t width = 11;
+
+    #include "ENDFtk/record/RealParser/src/decode.hpp"
+    #include "ENDFtk/record/RealParser/src/isValid.hpp"
+
+    /**
+     *  @brief Read a floating point value from an ENDF field
+     *
+     *  @tparam Representation   the type of the value to be returned
+     *  @tparam Iterator         the iterator type
+     *
+     *  @param[in,out] it    the current position in the buffer
+     *  @param[in]     end   the end of the buffer
+     */
+    template< typename Representation, typename Iterator >
+    static Representation read( Iterator& it, const Iterator& end ) {
+
+      char field[ width ];
+      std::size_t size = 0;
+      while ( ( size < width ) && ( it != end ) &&
+              ( *it != '\n' ) && ( *it != '\r' ) ) {
+
+        field[ size++ ] = *it;
+        ++it;
+      }
+
+      double value = 0.;
+      if ( not decode( std::string_view( field, size ), value ) ) {
+
+        Log::error( "Could not read a real value from an ENDF field" );
+        Log::info( "Field: \"{}\"", std::string_view( field, size ) );
+        throw std::exception();
+      }
+      return static_cast< Representation >( value );
+    }
+  };
+
+} // record namespace
+} // ENDFtk namespace
+} // njoy namespace
+
+#endif
@@ -0,0 +1,196 @@
+/**
+ *  @brief Convert a mantissa of the form d.dddddd into an integer, eight
+ *         characters at a time
+ *
+ *  The first digit is moved into the place of the decimal point and a
+ *  leading zero is added, after which the eight digits are validated and
+ *  converted using a few 64-bit integer operations (SWAR) instead of one
+ *  multiplication per digit. The function returns false (and leaves the
+ *  mantissa untouched) if the characters are not of this form.
+ *
+ *  @param[in]  current    the first character of the mantissa
+ *  @param[in]  end        the end of the field
+ *  @param[out] mantissa   the 7 digits as an integer
+ */
+static bool eightDigits( const char* current, const char* end,
+                         std::uint64_t& mantissa ) {
+
+  if ( ( end - current < 8 ) || ( current[1] != '.' ) ) {
+
+    return false;
+  }
+
+  // load the characters with the first one in the least significant byte
+  std::uint64_t chunk = 0;
+  std::memcpy( &chunk, current, 8 );
+#if defined( __BYTE_ORDER__ ) && ( __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__ )
+  chunk = __builtin_bswap64( chunk );
+#endif
+  chunk = ( chunk & 0xFFFFFFFFFFFF0000 ) | ( ( chunk & 0xFF ) << 8 ) | '0';
+
+  // every byte must be in [ '0', '9' ]
+  if ( ( ( chunk & 0xF0F0F0F0F0F0F0F0 ) |
+         ( ( ( chunk + 0x0606060606060606 ) & 0xF0F0F0F0F0F0F0F0 ) >> 4 ) ) !=
+       0x3333333333333333 ) {
+
+    return false;
+  }
+
+  // combine pairs of digits, then pairs of those and finally the two halves
+  chunk -= 0x3030303030303030;
+  chunk = ( chunk * 10 ) + ( chunk >> 8 );
+  chunk = ( ( ( chunk & 0x000000FF000000FF ) * 0x000F424000000064 ) +
+            ( ( ( chunk >> 16 ) & 0x000000FF000000FF ) * 0x0000271000000001 ) )
+          >> 32;
+  mantissa = static_cast< std::uint32_t >( chunk );
+  return true;
+}
+
+/**
+ *  @brief Decode the characters of an ENDF floating point field
+ *
+ *  The function returns false if the field does not contain a valid
+ *  number.
+ *
+ *  @param[in]  field   the characters in the field (at most 11)
+ *  @param[out] value   the decoded value
+ */
+static bool decode( std::string_view field, double& value ) {
+
+  // the exact powers of 10 that can be represented as a double
+  static constexpr double powers[] = {
+
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+  };
+
+  auto isDigit = [] ( char c ) {
+
+    return static_cast< unsigned char >( c - '0' ) < 10;
+  };
+
+  const char* current = field.data();
+  const char* end = current + field.size();
+  auto skipSpaces = [&] () {
+
+    while ( ( current != end ) && ( *current == ' ' ) ) {
+
+      ++current;
+    }
+  };
+
+  // a blank field is zero
+  skipSpaces();
+  if ( current == end ) {
+
+    value = 0.;
+    return true;
+  }
+
+  // the sign of the mantissa
+  const bool negative = *current == '-';
+  if ( ( *current == '-' ) || ( *current == '+' ) ) {
+
+    ++current;
+  }
+
+  // the digits of the mantissa
+  std::uint64_t mantissa = 0;
+  int digits = 0;
+  int exponent = 0;
+  bool fraction = false;
+  if ( eightDigits( current, end, mantissa ) ) {
+
+    // the usual ENDF form: one digit, the decimal point and six decimals
+    digits = 7;
+    exponent = -6;
+    current += 8;
+    fraction = true;
+  }
+  else {
+
+    for ( ; ( current != end ) && isDigit( *current ); ++current, ++digits ) {
+
+      mantissa = 10 * mantissa + ( *current - '0' );
+    }
+    if ( ( current != end ) && ( *current == '.' ) ) {
+
+      ++current;
+      fraction = true;
+    }
+  }
+  if ( fraction ) {
+
+    for ( ; ( current != end ) && isDigit( *current ); ++current, ++digits ) {
+
+      mantissa = 10 * mantissa + ( *current - '0' );
+      --exponent;
+    }
+  }
+  if ( digits == 0 ) {
+
+    return false;
+  }
+
+  // the exponent (explicit using E or D, or implicit using only the sign)
+  skipSpaces();
+  if ( current != end ) {
+
+    const char marker = *current | 0x20;
+    if ( ( marker == 'e' ) || ( marker == 'd' ) ) {
+
+      ++current;
+    }
+    else if ( ( *current != '+' ) && ( *current != '-' ) ) {
+
+      return false;
+    }
+
+    bool negativeExponent = false;
+    if ( ( current != end ) && ( ( *current == '+' ) || ( *current == '-' ) ) ) {
+
+      negativeExponent = *current == '-';
+      ++current;
+    }
+    if ( ( current == end ) || not isDigit( *current ) ) {
+
+      return false;
+    }
+
+    int power = 0;
+    for ( ; ( current != end ) && isDigit( *current ); ++current ) {
+
+      power = 10 * power + ( *current - '0' );
+    }
+    exponent += negativeExponent ? -power : power;
+
+    skipSpaces();
+    if ( current != end ) {
+
+      return false;
+    }
+  }
+
+  // convert the mantissa and decimal exponent into a double
+  if ( mantissa == 0 ) {
+
+    value = 0.;
+  }
+  else if ( ( exponent >= -22 ) && ( exponent <= 22 ) ) {
+
+    // both the mantissa and the power of 10 are exact: a single operation
+    // is correctly rounded
+    value = exponent < 0 ? double( mantissa ) / powers[ -exponent ]
+                         : double( mantissa ) * powers[ exponent ];
+  }
+  else {
+
+    char buffer[ 32 ];
+    std::snprintf( buffer, sizeof( buffer ), "%llue%d",
+                   static_cast< unsigned long long >( mantissa ), exponent );
+    value = std::strtod( buffer, nullptr );
+  }
+
+  value = negative ? -value : value;
+  return true;
+}
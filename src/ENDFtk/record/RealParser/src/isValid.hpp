@@ -0,0 +1,87 @@
+/**
+ *  @brief Verify the characters of an ENDF floating point field without
+ *         decoding the value
+ *
+ *  The field is scanned using the same rules as decode(), but the digits
+ *  are not accumulated and no conversion is done. The function returns true
+ *  if and only if decode() would succeed on the same field.
+ *
+ *  @param[in] field   the characters in the field (at most 11)
+ */
+static bool isValid( std::string_view field ) {
+
+  auto isDigit = [] ( char c ) {
+
+    return static_cast< unsigned char >( c - '0' ) < 10;
+  };
+
+  const char* current = field.data();
+  const char* end = current + field.size();
+  auto skipSpaces = [&] () {
+
+    while ( ( current != end ) && ( *current == ' ' ) ) {
+
+      ++current;
+    }
+  };
+  auto skipDigits = [&] () {
+
+    const char* first = current;
+    while ( ( current != end ) && isDigit( *current ) ) {
+
+      ++current;
+    }
+    return current - first;
+  };
+
+  // a blank field is zero
+  skipSpaces();
+  if ( current == end ) {
+
+    return true;
+  }
+
+  // the mantissa
+  if ( ( *current == '-' ) || ( *current == '+' ) ) {
+
+    ++current;
+  }
+  auto digits = skipDigits();
+  if ( ( current != end ) && ( *current == '.' ) ) {
+
+    ++current;
+    digits += skipDigits();
+  }
+  if ( digits == 0 ) {
+
+    return false;
+  }
+
+  // the exponent (explicit using E or D, or implicit using only the sign)
+  skipSpaces();
+  if ( current == end ) {
+
+    return true;
+  }
+
+  const char marker = *current | 0x20;
+  if ( ( marker == 'e' ) || ( marker == 'd' ) ) {
+
+    ++current;
+  }
+  else if ( ( *current != '+' ) && ( *current != '-' ) ) {
+
+    return false;
+  }
+  if ( ( current != end ) && ( ( *current == '+' ) || ( *current == '-' ) ) ) {
+
+    ++current;
+  }
+  if ( skipDigits() == 0 ) {
+
+    return false;
+  }
+
+  skipSpaces();
+  return current == end;
+}
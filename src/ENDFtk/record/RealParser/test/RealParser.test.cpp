@@ -0,0 +1,295 @@
+// include Catch2
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+// what we are testing
+#include "ENDFtk/record/RealParser.hpp"
+
+// other includes
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// convenience typedefs
+using namespace njoy::ENDFtk;
+
+double read( const std::string& field ) {
+
+  auto it = field.begin();
+  return record::RealParser::read< double >( it, field.end() );
+}
+
+SCENARIO( "record::RealParser" ) {
+
+  GIVEN( "fields using the different ENDF forms of a real value" ) {
+
+    WHEN( "the fields are read" ) {
+
+      THEN( "the values are decoded correctly" ) {
+
+        CHECK( 1.234567e+5 == read( " 1.234567+5" ) );
+        CHECK( -2.5e-3 == read( "-2.5-3     " ) );
+        CHECK( 1.0e+5 == read( "  1.0E+05  " ) );
+        CHECK( 1.0e+5 == read( "  1.0e5    " ) );
+        CHECK( 1.0e-300 == read( " 1.0D-300  " ) );
+        CHECK( 1.0 == read( " 1.0d+0    " ) );
+        CHECK( 12345678901. == read( "12345678901" ) );
+        CHECK( 10. == read( "         10" ) );
+        CHECK( 0.5 == read( "         .5" ) );
+        CHECK( -5. == read( "      -.5e1" ) );
+        CHECK( 1.234567e-38 == read( "1.234567-38" ) );
+        CHECK( 9.999999e+99 == read( "9.999999+99" ) );
+        CHECK( 0. == read( "           " ) );
+        CHECK( 0. == read( " 0.000000+0" ) );
+        CHECK( true == std::signbit( read( "-0.000000+0" ) ) );
+        CHECK( 1.2345678e+5 == read( "1.2345678+5" ) );
+        CHECK( 1.2345e+5 == read( " 1.2345 +5 " ) );
+        CHECK( -9.87654e-10 == read( "-9.87654-10" ) );
+        CHECK( 1.234567 == read( "   1.234567" ) );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+
+  GIVEN( "a field that is cut short by the end of a line" ) {
+
+    std::string line = " 1.5+2\n 2.0+0";
+
+    WHEN( "the field is read" ) {
+
+      auto it = line.begin();
+      auto value = record::RealParser::read< double >( it, line.end() );
+
+      THEN( "the available characters are decoded and the newline is not "
+            "consumed" ) {
+
+        CHECK( 150. == value );
+        CHECK( '\n' == *it );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+
+  GIVEN( "random values written using 7 or 8 significant digits" ) {
+
+    std::mt19937_64 generator( 12345 );
+    std::uniform_real_distribution< double > mantissa( 1., 10. );
+    std::uniform_int_distribution< int > large( -99, 99 );
+    std::uniform_int_distribution< int > small( -9, 9 );
+
+    WHEN( "the fields are read" ) {
+
+      THEN( "the values are correctly rounded" ) {
+
+        char buffer[ 32 ];
+        for ( unsigned int i = 0; i < 100000; ++i ) {
+
+          // 7 significant digits with a 1 or 2 digit exponent, or 8
+          // significant digits with a 1 digit exponent
+          const int digits = i % 2 ? 6 : 7;
+          const int power = i % 2 ? large( generator ) : small( generator );
+          const int size = std::snprintf( buffer, sizeof( buffer ), "%.*f",
+                                          digits, mantissa( generator ) );
+          const std::string value( buffer, size );
+
+          // the reference value is obtained using strtod
+          const double reference =
+              std::strtod( ( value + "e" + std::to_string( power ) ).c_str(),
+                           nullptr );
+
+          // the field uses the implicit exponent form
+          std::string field = value + ( power < 0 ? "-" : "+" )
+                              + std::to_string( std::abs( power ) );
+          field = std::string( 11 - field.size(), ' ' ) + field;
+
+          CHECK( reference == read( field ) );
+        }
+      } // THEN
+    } // WHEN
+  } // GIVEN
+
+  GIVEN( "invalid fields" ) {
+
+    WHEN( "the fields are read" ) {
+
+      THEN( "an exception is thrown" ) {
+
+        CHECK_THROWS( read( " 1.0+      " ) );
+        CHECK_THROWS( read( " 1.0e      " ) );
+        CHECK_THROWS( read( " 1.0x5     " ) );
+        CHECK_THROWS( read( " 1.0 2     " ) );
+        CHECK_THROWS( read( " 1.23x567+5" ) );
+        CHECK_THROWS( read( "    abc    " ) );
+        CHECK_THROWS( read( "    -      " ) );
+        CHECK_THROWS( read( "     .     " ) );
+      } // THEN
+    } // WHEN
+
+    WHEN( "the fields are verified without decoding them" ) {
+
+      THEN( "only valid fields are accepted, like decode() does" ) {
+
+        for ( std::string_view field : { " 1.0+      ", " 1.0e      ",
+                                         " 1.0x5     ", " 1.0 2     ",
+                                         " 1.23x567+5", "    abc    ",
+                                         "    -      ", "     .     " } ) {
+
+          double value = 0.;
+          CHECK( false == record::RealParser::isValid( field ) );
+          CHECK( false == record::RealParser::decode( field, value ) );
+        }
+
+        for ( std::string_view field : { " 1.234567+5", "-2.5-3     ",
+                                         "  1.0E+05  ", " 1.0D-300  ",
+                                         "12345678901", "         .5",
+                                         "      -.5e1", "           ",
+                                         " 1.2345 +5 ", "-9.87654-10" } ) {
+
+          CHECK( true == record::RealParser::isValid( field ) );
+        }
+      } // THEN
+    } // WHEN
+  } // GIVEN
+} // SCENARIO
+
+/**
+ *  Compare every numeric field of an ENDF library with the values read by
+ *  disco::ENDF, bit for bit. The library (a file or a directory of files) is
+ *  given by the ENDFTK_LIBRARY environment variable, e.g.
+ *
+ *    ENDFTK_LIBRARY=/path/to/endfb8.0/neutrons ./record.RealParser.test "[library]"
+ *
+ *  The text records of MF1 MT451 and the first line of each file (the tape
+ *  identification) are not compared.
+ */
+TEST_CASE( "Reading a library", "[.][library]" ) {
+
+  const char* library = std::getenv( "ENDFTK_LIBRARY" );
+  if ( not library ) {
+
+    WARN( "ENDFTK_LIBRARY is not set, no library was compared" );
+    return;
+  }
+
+  std::vector< std::filesystem::path > files;
+  if ( std::filesystem::is_directory( library ) ) {
+
+    for ( const auto& entry : std::filesystem::directory_iterator( library ) ) {
+
+      if ( entry.is_regular_file() ) { files.push_back( entry.path() ); }
+    }
+  }
+  else {
+
+    files.push_back( library );
+  }
+
+  long fields = 0;
+  long identical = 0;
+  long different = 0;
+  long missed = 0;
+  long extended = 0;
+  for ( const auto& file : files ) {
+
+    std::ifstream in( file );
+    std::string line;
+    std::getline( in, line );
+    while ( std::getline( in, line ) ) {
+
+      if ( line.size() < 75 ) { continue; }
+      const int mf = std::atoi( line.substr( 70, 2 ).c_str() );
+      const int mt = std::atoi( line.substr( 72, 3 ).c_str() );
+      if ( ( mt == 0 ) || ( ( mf == 1 ) && ( mt == 451 ) ) ) { continue; }
+
+      for ( std::size_t index = 0; index < 6; ++index ) {
+
+        const std::string field = line.substr( 11 * index, 11 );
+
+        double value = 0.;
+        const bool decoded = record::RealParser::decode( field, value );
+
+        double reference = 0.;
+        bool read = true;
+        try {
+
+          auto it = field.begin();
+          reference = njoy::disco::ENDF::read< double >( it, field.end() );
+        }
+        catch ( ... ) { read = false; }
+
+        ++fields;
+        if ( not read ) {
+
+          // fields disco::ENDF does not read (e.g. using a D exponent)
+          if ( decoded ) { ++extended; }
+        }
+        else if ( not decoded ) {
+
+          if ( ++missed <= 10 ) {
+
+            UNSCOPED_INFO( file.filename().string() << ": \"" << field
+                           << "\" was not decoded" );
+          }
+        }
+        else if ( std::memcmp( &value, &reference, sizeof( double ) ) ) {
+
+          if ( ++different <= 10 ) {
+
+            UNSCOPED_INFO( file.filename().string() << ": \"" << field << "\" "
+                           << value << " != " << reference );
+          }
+        }
+        else {
+
+          ++identical;
+        }
+      }
+    }
+  }
+
+  std::ostringstream summary;
+  summary << files.size() << " files, " << fields << " fields: "
+          << identical << " identical, " << different << " different, "
+          << missed << " not decoded, " << extended
+          << " only decoded by record::RealParser";
+  WARN( summary.str() );
+  CHECK( 0 == different );
+  CHECK( 0 == missed );
+}
+
+TEST_CASE( "Reading real values", "[.][benchmark]" ) {
+
+  const long lines = 100000;
+  std::string buffer;
+  buffer.reserve( 66 * lines );
+  for ( long i = 0; i < lines; ++i ) {
+
+    buffer += " 1.000000-5 3.713628+1 2.530000-2 2.076834+1-1.234567+6 9.87000-10";
+  }
+
+  // divide the buffer size (6.6 MB) by the mean time to get MB/s
+  BENCHMARK( "record::RealParser" ) {
+
+    double sum = 0.;
+    auto it = buffer.cbegin();
+    auto end = buffer.cend();
+    while ( it != end ) { sum += record::RealParser::read< double >( it, end ); }
+    return sum;
+  };
+
+  BENCHMARK( "disco::ENDF" ) {
+
+    double sum = 0.;
+    auto it = buffer.cbegin();
+    auto end = buffer.cend();
+    while ( it != end ) {
+
+      sum += njoy::disco::ENDF::read< double >( it, end );
+    }
+    return sum;
+  };
+}
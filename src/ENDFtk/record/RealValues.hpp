@@ -0,0 +1,94 @@
+#ifndef NJOY_ENDFTK_RECORD_REALVALUES
+#define NJOY_ENDFTK_RECORD_REALVALUES
+
+// system includes
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+// other includes
+#include "range/v3/view/interface.hpp"
+#include "ENDFtk/record/StoredValues.hpp"
+
+namespace njoy {
+namespace ENDFtk {
+namespace record {
+
+  /**
+   *  @class
+   *  @brief A contiguous view of the real values of a record, in double
+   *         precision
+   *
+   *  When the record stores its values in double precision, the view refers
+   *  to these values. When the record stores its values in single precision,
+   *  the values are widened into an array owned by the view (and its copies)
+   *  so that the record itself does not retain the double precision values.
+   *  The iterators of the view remain valid for as long as the record is
+   *  not modified and (for values stored in single precision) as long as a
+   *  copy of the view exists.
+   */
+  class RealValues : public ranges::view_interface< RealValues > {
+
+    /* fields */
+    std::shared_ptr< const std::vector< double > > owner_;
+    const double* begin_ = nullptr;
+    const double* end_ = nullptr;
+
+  public:
+
+    /**
+     *  @brief Default constructor
+     */
+    RealValues() = default;
+
+    /**
+     *  @brief Constructor (values stored in double precision)
+     *
+     *  @param[in] values   the values
+     */
+    explicit RealValues( const std::pmr::vector< double >& values ) :
+      begin_( values.data() ), end_( values.data() + values.size() ) {}
+
+    /**
+     *  @brief Constructor (values stored in double precision)
+     *
+     *  @param[in] values   the values
+     */
+    explicit RealValues( const StoredValues< double >& values ) :
+      begin_( values.begin() ), end_( values.end() ) {}
+
+    /**
+     *  @brief Constructor (values stored in single precision)
+     *
+     *  @param[in] values   the values
+     */
+    explicit RealValues( const std::pmr::vector< float >& values ) :
+      owner_( std::make_shared< const std::vector< double > >(
+                  values.begin(), values.end() ) ),
+      begin_( this->owner_->data() ),
+      end_( this->owner_->data() + this->owner_->size() ) {}
+
+    /**
+     *  @brief Return a view of the values in the range [left, right)
+     *
+     *  @param[in] left    the index of the first value
+     *  @param[in] right   the index after the last value
+     */
+    RealValues slice( std::ptrdiff_t left, std::ptrdiff_t right ) const {
+
+      RealValues result( *this );
+      result.begin_ = this->begin_ + left;
+      result.end_ = this->begin_ + right;
+      return result;
+    }
+
+    const double* begin() const { return this->begin_; }
+    const double* end() const { return this->end_; }
+  };
+
+} // record namespace
+} // ENDFtk namespace
+} // njoy namespace
+
+#endif
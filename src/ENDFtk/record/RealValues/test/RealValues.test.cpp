@@ -0,0 +1,56 @@
+// include Catch2
+#include <catch2/catch_test_macros.hpp>
+
+// what we are testing
+#include "ENDFtk/record/RealValues.hpp"
+
+// other includes
+
+// convenience typedefs
+using namespace njoy::ENDFtk;
+using namespace njoy::ENDFtk::record;
+
+SCENARIO( "RealValues" ) {
+
+  GIVEN( "values stored in double precision" ) {
+
+    std::pmr::vector< double > doubles = { 1., 0.1, 1e+10, -2.5 };
+
+    WHEN( "a view of the values is created" ) {
+
+      RealValues values( doubles );
+
+      THEN( "the view refers to the stored values" ) {
+
+        CHECK( 4 == values.size() );
+        CHECK( doubles.data() == values.data() );
+        CHECK( 0.1 == values[1] );
+        CHECK( -2.5 == values.back() );
+
+        auto slice = values.slice( 1, 3 );
+        CHECK( 2 == slice.size() );
+        CHECK( doubles.data() + 1 == slice.data() );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+
+  GIVEN( "values stored in single precision" ) {
+
+    std::pmr::vector< float > floats = { 1.f, 0.1f, 1e+10f, -2.5f };
+
+    WHEN( "a view of the values is created" ) {
+
+      RealValues values( floats );
+      RealValues slice = values.slice( 1, 3 );
+      values = RealValues();
+
+      THEN( "the widened values are owned by the view and its copies" ) {
+
+        CHECK( 0 == values.size() );
+        CHECK( 2 == slice.size() );
+        CHECK( double( 0.1f ) == slice[0] );
+        CHECK( 1e+10 == slice[1] );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+} // SCENARIO
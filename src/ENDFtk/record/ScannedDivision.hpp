@@ -0,0 +1,81 @@
+#ifndef NJOY_ENDFTK_RECORD_SCANNEDDIVISION
+#define NJOY_ENDFTK_RECORD_SCANNEDDIVISION
+
+// system includes
+
+// other includes
+#include "ENDFtk/record/Tail.hpp"
+
+namespace njoy {
+namespace ENDFtk {
+namespace record {
+
+  /**
+   *  @class
+   *  @brief The structure information of a line found by the record scanner
+   *
+   *  This is the counterpart of StructureDivision for the record scanner: it
+   *  retains the MAT, MF and MT numbers of the line and whether or not the
+   *  six fields in the first 66 columns are all zero (blank fields are read
+   *  as zero). The structure methods follow the rules of StructureDivision.
+   */
+  class ScannedDivision {
+
+  public:
+
+    /* fields */
+    Tail tail;
+    bool emptyBase;
+
+    /* constructor */
+    ScannedDivision( const Tail& tail, bool emptyBase ) :
+      tail( tail ), emptyBase( emptyBase ) {}
+
+    /* methods */
+    int MAT() const { return this->tail.MAT(); }
+    int MF() const { return this->tail.MF(); }
+    int MT() const { return this->tail.MT(); }
+
+    bool isHead() const {
+
+      return this->tail.section() and this->tail.file() and this->tail.material();
+    }
+
+    bool isSendPermissive() const {
+
+      return this->emptyBase and ( this->tail.section() == 0 );
+    }
+
+    bool isSend() const {
+
+      return this->isSendPermissive()
+             and this->tail.file()
+             and ( this->tail.material() > 0 );
+    }
+
+    bool isFendPermissive() const {
+
+      return this->isSendPermissive() and ( this->tail.file() == 0 );
+    }
+
+    bool isFend() const {
+
+      return this->isFendPermissive() and ( this->tail.material() > 0 );
+    }
+
+    bool isMend() const {
+
+      return this->isFendPermissive() and ( this->tail.material() == 0 );
+    }
+
+    bool isTend() const {
+
+      return this->isFendPermissive() and ( this->tail.material() == -1 );
+    }
+  };
+
+} // record namespace
+} // ENDFtk namespace
+} // njoy namespace
+
+#endif
@@ -2,6 +2,8 @@
 #define NJOY_ENDFTK_RECORD_SEQUENCE
 
 // system includes
+#include <memory_resource>
+#include <vector>
 
 // other includes
 #include "ENDFtk/record/Zipper.hpp"
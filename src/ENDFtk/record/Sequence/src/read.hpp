@@ -1,10 +1,25 @@
+/**
+ *  @brief Read the values into a vector
+ */
 template< typename ENDFType, typename Iterator >
 static std::vector< typename ENDFType::Type >
 read( long nEntries,
       Iterator& it, const Iterator& end, long& lineNumber,
       int MAT, int MF, int MT ){
-  std::vector< typename ENDFType::Type > result;
-  std::tie( result ) =
-    Zipper::unzip< ENDFType >( nEntries, it, end, lineNumber, MAT, MF, MT );
-  return result;
+  return std::get< 0 >(
+    Zipper::unzip< ENDFType >( nEntries, it, end, lineNumber, MAT, MF, MT ) );
+}
+
+/**
+ *  @brief Read the values into a vector using the given memory resource
+ */
+template< typename ENDFType, typename Iterator >
+static std::pmr::vector< typename ENDFType::Type >
+read( std::pmr::memory_resource* resource, long nEntries,
+      Iterator& it, const Iterator& end, long& lineNumber,
+      int MAT, int MF, int MT ){
+  // move construct the result to keep the memory resource used by the zipper
+  return std::get< 0 >(
+    Zipper::unzip< ENDFType >( resource, nEntries,
+                               it, end, lineNumber, MAT, MF, MT ) );
 }
@@ -0,0 +1,90 @@
+#ifndef NJOY_ENDFTK_RECORD_SHAREDBUFFER
+#define NJOY_ENDFTK_RECORD_SHAREDBUFFER
+
+// system includes
+#include <functional>
+#include <memory>
+#include <string_view>
+#include <utility>
+
+// other includes
+
+namespace njoy {
+namespace ENDFtk {
+namespace record {
+
+  /**
+   *  @class
+   *  @brief A buffer being parsed in the current thread, together with the
+   *         object that keeps it alive
+   *
+   *  Lazily decoded records (see LazyValues) retain the lines of the record.
+   *  When these lines lie within the active shared buffer (e.g. the content
+   *  of a tree::Section or the memory mapped file it refers to), the records
+   *  share ownership of the buffer instead of copying the lines. Otherwise,
+   *  the lines are copied.
+   *
+   *  Sharing avoids a copy, but a record holds on to the whole buffer and
+   *  not only to its own lines: a single record that is kept (and whose
+   *  values are never requested) keeps the entire section content or
+   *  memory mapped file alive.
+   */
+  struct SharedBuffer {
+
+    std::shared_ptr< const void > owner;
+    std::string_view buffer;
+
+    /**
+     *  @brief Return whether or not the buffer contains the given characters
+     *
+     *  @param[in] characters   the characters
+     */
+    bool contains( std::string_view characters ) const {
+
+      const std::less_equal< const char* > before;
+      return this->owner &&
+             before( this->buffer.data(), characters.data() ) &&
+             before( characters.data() + characters.size(),
+                     this->buffer.data() + this->buffer.size() );
+    }
+
+    /**
+     *  @brief Return the shared buffer that is active in the current thread
+     */
+    static SharedBuffer& active() {
+
+      static thread_local SharedBuffer buffer;
+      return buffer;
+    }
+
+    class Scope;
+  };
+
+  /**
+   *  @class
+   *  @brief Activate a shared buffer in the current thread for the lifetime
+   *         of the scope
+   */
+  class SharedBuffer::Scope {
+
+    SharedBuffer previous_;
+
+  public:
+
+    Scope( std::shared_ptr< const void > owner, std::string_view buffer ) :
+      previous_( active() ) {
+
+      active() = SharedBuffer{ std::move( owner ), buffer };
+    }
+
+    Scope( const Scope& ) = delete;
+    Scope& operator=( const Scope& ) = delete;
+
+    ~Scope() { active() = std::move( this->previous_ ); }
+  };
+
+} // record namespace
+} // ENDFtk namespace
+} // njoy namespace
+
+#endif
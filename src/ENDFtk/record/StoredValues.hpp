@@ -0,0 +1,127 @@
+#ifndef NJOY_ENDFTK_RECORD_STOREDVALUES
+#define NJOY_ENDFTK_RECORD_STOREDVALUES
+
+// system includes
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <memory_resource>
+#include <utility>
+#include <variant>
+#include <vector>
+
+// other includes
+#include "ENDFtk/MemoryUsage.hpp"
+
+namespace njoy {
+namespace ENDFtk {
+namespace record {
+
+  /**
+   *  @class
+   *  @brief The values of a record, stored in the vector they were given in
+   *
+   *  Values read from a buffer are stored in a std::pmr::vector using the
+   *  memory resource of the active parse options, while values given to the
+   *  constructor of a record are usually given in a std::vector. Both are
+   *  moved into the record without copying the values. Copies of the stored
+   *  values keep the type of the vector (a copy of a std::pmr::vector uses
+   *  the default memory resource).
+   */
+  template< typename Type >
+  class StoredValues {
+
+    /* fields */
+    std::variant< std::vector< Type >, std::pmr::vector< Type > > values_;
+
+  public:
+
+    /* constructors */
+
+    StoredValues() = default;
+    StoredValues( std::vector< Type >&& values ) :
+      values_( std::move( values ) ) {}
+    StoredValues( std::pmr::vector< Type >&& values ) :
+      values_( std::move( values ) ) {}
+    StoredValues( std::initializer_list< Type > values ) :
+      values_( std::vector< Type >( values ) ) {}
+
+    /* methods */
+
+    /**
+     *  @brief Apply a function to the vector holding the values
+     *
+     *  @param[in] function   the function to be applied
+     */
+    template< typename Function >
+    decltype(auto) visit( Function&& function ) {
+
+      return std::visit( std::forward< Function >( function ), this->values_ );
+    }
+
+    /**
+     *  @brief Apply a function to the vector holding the values
+     *
+     *  @param[in] function   the function to be applied
+     */
+    template< typename Function >
+    decltype(auto) visit( Function&& function ) const {
+
+      return std::visit( std::forward< Function >( function ), this->values_ );
+    }
+
+    const Type* data() const {
+
+      return this->visit( [] ( const auto& values ) { return values.data(); } );
+    }
+
+    std::size_t size() const {
+
+      return this->visit( [] ( const auto& values ) { return values.size(); } );
+    }
+
+    bool empty() const { return this->size() == 0; }
+    const Type* begin() const { return this->data(); }
+    const Type* end() const { return this->data() + this->size(); }
+    const Type& operator[]( std::size_t index ) const {
+
+      return this->data()[ index ];
+    }
+    const Type& back() const { return this->end()[ -1 ]; }
+
+    /**
+     *  @brief Return the memory used by the values
+     */
+    MemoryUsage memoryUsage() const {
+
+      MemoryUsage usage;
+      this->visit( [&usage] ( const auto& values ) { usage.add( values ); } );
+      return usage;
+    }
+
+    /**
+     *  @brief Equality operator
+     *
+     *  @param[in] rhs   the values on the right
+     */
+    bool operator==( const StoredValues& rhs ) const {
+
+      return std::equal( this->begin(), this->end(), rhs.begin(), rhs.end() );
+    }
+
+    /**
+     *  @brief Not equal operator
+     *
+     *  @param[in] rhs   the values on the right
+     */
+    bool operator!=( const StoredValues& rhs ) const {
+
+      return not ( *this == rhs );
+    }
+  };
+
+} // record namespace
+} // ENDFtk namespace
+} // njoy namespace
+
+#endif
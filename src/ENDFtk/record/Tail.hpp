@@ -2,11 +2,13 @@
 #define NJOY_ENDFTK_RECORD_TAIL
 
 // system includes
+#include <algorithm>
+#include <cstdio>
 #include <string>
 
 // other includes
 #include "disco.hpp"
-#include "tools/Log.hpp"
+#include "ENDFtk/Log.hpp"
 
 namespace njoy {
 namespace ENDFtk {
@@ -66,6 +68,28 @@ namespace record {
     int section() const { return this->fields[2]; }
     int& MT(){ return this->section(); }
     int MT() const { return this->section(); }
+
+    /**
+     *  @brief Write the MAT, MF and MT numbers followed by a blank sequence
+     *         number and the end of line (15 characters) into a buffer
+     *
+     *  The function returns false when one of the numbers does not fit in its
+     *  columns, in which case the content of the buffer should not be used.
+     *
+     *  @param[in] buffer   the buffer (at least 15 characters)
+     */
+    bool format( char* buffer ) const {
+
+      char text[ 32 ];
+      const int size = std::snprintf( text, sizeof( text ), "%4d%2d%3d     \n",
+                                      this->MAT(), this->MF(), this->MT() );
+      if ( size != 15 ) {
+
+        return false;
+      }
+      std::copy( text, text + 15, buffer );
+      return true;
+    }
   };
 } // record namespace
 } // ENDFtk namespace
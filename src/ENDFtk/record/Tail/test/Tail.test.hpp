@@ -66,5 +66,16 @@ SCENARIO( "Checking the values of MAT, MF, and MT" ){
       auto end = tail.end();
       CHECK_THROWS( std::make_unique< Tail >( it, end, lineNumber ) );
     }
+    WHEN("Formatted into a buffer"){
+      char buffer[ 15 ];
+      THEN( "the MAT, MF and MT numbers are written"){
+        CHECK( true == Tail( mat, mf, mt ).format( buffer ) );
+        CHECK( " 125 4  2     \n" == std::string( buffer, 15 ) );
+        CHECK( true == Tail( -1, 0, 0 ).format( buffer ) );
+        CHECK( "  -1 0  0     \n" == std::string( buffer, 15 ) );
+        CHECK( false == Tail( 10000, mf, mt ).format( buffer ) );
+        CHECK( false == Tail( mat, mf, 1000 ).format( buffer ) );
+      }
+    }
   }
 } // SCENARIO
@@ -4,8 +4,9 @@
 // system includes
 
 // other includes
-#include "tools/Log.hpp"
+#include "ENDFtk/Log.hpp"
 #include "disco.hpp"
+#include "ENDFtk/ParseOptions.hpp"
 #include "ENDFtk/record/helper.hpp"
 #include "ENDFtk/record/Integer.hpp"
 #include "ENDFtk/record/Real.hpp"
@@ -24,7 +25,8 @@ namespace record {
     template< typename... Args >
     TailVerification( int expectedValue, Args&&... args ) :
       Tail( std::forward< Args >( args )... ) {
-      if( this->fields[ position ] != expectedValue ){
+      if( ParseOptions::active().verifyTails and
+          ( this->fields[ position ] != expectedValue ) ){
         Log::error( "The record {} number ({}) is inconsistent with expectation.",
                     helper::name< position >, helper::symbol< position > );
         Log::info( "The read {} number is: {}",
@@ -2,9 +2,20 @@
 #define NJOY_ENDFTK_RECORD_ZIPPER
 
 // system includes
+#include <array>
+#include <cstdio>
+#include <cstring>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
 
 // other includes
+#include "ENDFtk/ParseOptions.hpp"
+#include "ENDFtk/record/Real.hpp"
 #include "ENDFtk/record/TailVerifying.hpp"
+#include "ENDFtk/record/scan.hpp"
 
 namespace njoy {
 namespace ENDFtk {
@@ -34,6 +45,8 @@ namespace record {
     #include "ENDFtk/record/Zipper/src/expandReferencePack.hpp"
     #include "ENDFtk/record/Zipper/src/readLine.hpp"
     #include "ENDFtk/record/Zipper/src/readPartialLine.hpp"
+    #include "ENDFtk/record/Zipper/src/assignRealLine.hpp"
+    #include "ENDFtk/record/Zipper/src/readRealLine.hpp"
 
     /* methods */
     #include "ENDFtk/record/Zipper/src/unzip.hpp"
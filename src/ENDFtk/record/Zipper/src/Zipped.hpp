@@ -13,6 +13,11 @@ struct Zipped {
     
   static const std::size_t nPad = 66 % tupleWidth;
 
+  /* whether or not full lines are six real values (read using a fast path) */
+  static constexpr bool realLine =
+    ( std::is_same< ENDFTypes, Real >::value && ... ) &&
+    ( entriesPerRecord == 6 );
+
   static constexpr auto tupleIndices =
     std::make_index_sequence< entriesPerTuple >();
     
@@ -0,0 +1,7 @@
+template< typename Zip, typename Tuple, std::size_t... indices >
+static void
+assignRealLine( Tuple& iteratorTuple, const std::array< double, 6 >& values,
+                std::index_sequence< indices... > ){
+  ( ( std::get< indices % Zip::entriesPerTuple >( iteratorTuple )
+        [ indices / Zip::entriesPerTuple ] = values[ indices ] ), ... );
+}
@@ -0,0 +1,99 @@
+/**
+ *  @brief Create the expected MAT, MF and MT columns of a line
+ *
+ *  The function returns an empty string when the MAT, MF or MT numbers do not
+ *  fit in their columns (in which case the fast path is not used).
+ *
+ *  @param[in] MAT   the expected MAT number
+ *  @param[in] MF    the expected MF number
+ *  @param[in] MT    the expected MT number
+ */
+static std::string makeTail( int MAT, int MF, int MT ) {
+
+  char buffer[ 32 ];
+  const int size = std::snprintf( buffer, sizeof( buffer ),
+                                  "%4d%2d%3d", MAT, MF, MT );
+  return size == 9 ? std::string( buffer, 9 ) : std::string();
+}
+
+/**
+ *  @brief Read a full line of six real values in a single pass
+ *
+ *  This is the fast path for zipped layouts that only contain real values
+ *  (lists of reals and the pairs of a tabulation). The six fields are decoded
+ *  directly from the buffer and the MAT, MF and MT numbers are verified using
+ *  a single comparison with the expected tail.
+ *
+ *  Nothing is consumed and false is returned when the line cannot be read
+ *  this way (the end of the buffer, a short line, a field that cannot be decoded, an unexpected
+ *  tail or an unusual sequence number). The generic path is then used to
+ *  read the line so that errors are reported in the same way.
+ *
+ *  @param[in,out] iteratorTuple   the output iterators
+ *  @param[in,out] it              the current position in the buffer
+ *  @param[in]     end             the end of the buffer
+ *  @param[in,out] lineNumber      the current line number
+ *  @param[in]     tail            the expected MAT, MF and MT columns
+ *  @param[in]     verify          whether or not the MAT, MF and MT columns
+ *                                 should be verified
+ */
+template< typename Zip, typename Tuple, typename Iterator >
+static bool
+readRealLine( Tuple& iteratorTuple,
+              Iterator& it, const Iterator& end, long& lineNumber,
+              const std::string& tail, bool verify = true ) {
+
+  // the end of the buffer cannot be dereferenced
+  if ( ( tail.size() != 9 ) || ( it == end ) ) {
+
+    return false;
+  }
+
+  const auto eol = findLineEnd( it, end );
+  const char* line = &*it;
+  std::size_t length = std::distance( it, eol );
+  if ( ( length > 0 ) && ( line[ length - 1 ] == '\r' ) ) {
+
+    --length;
+  }
+
+  // the line must contain the data and the MAT, MF and MT numbers
+  if ( ( length < 75 ) || ( length > 80 ) ||
+       ( verify && std::memcmp( line + 66, tail.data(), 9 ) ) ) {
+
+    return false;
+  }
+
+  // the sequence number is either blank or right aligned
+  std::size_t column = 75;
+  while ( ( column < length ) && ( line[ column ] == ' ' ) ) {
+
+    ++column;
+  }
+  while ( ( column < length ) &&
+          ( static_cast< unsigned char >( line[ column ] - '0' ) < 10 ) ) {
+
+    ++column;
+  }
+  if ( column != length ) {
+
+    return false;
+  }
+
+  std::array< double, 6 > values;
+  for ( std::size_t index = 0; index < 6; ++index ) {
+
+    if ( not RealParser::decode( std::string_view( line + 11 * index, 11 ),
+                                 values[ index ] ) ) {
+
+      return false;
+    }
+  }
+
+  assignRealLine< Zip >( iteratorTuple, values,
+                         std::make_index_sequence< 6 >() );
+
+  it = eol == end ? end : std::next( eol );
+  ++lineNumber;
+  return true;
+}
@@ -1,20 +1,35 @@
-template< typename... ENDFTypes, typename Iterator >
-static std::tuple< std::vector< typename ENDFTypes::Type >... >
-unzip
-( uint64_t nEntries,
+/**
+ *  @brief Read the values into the given vectors
+ */
+template< typename... ENDFTypes, typename Result, typename Iterator >
+static void
+unzipInto
+( Result& result, uint64_t nEntries,
   Iterator& it, const Iterator& end, long& lineNumber,
   int MAT, int MF, int MT ){
-    
-  std::tuple< std::vector< typename ENDFTypes::Type >... > result;    
+
   reserve( nEntries, result );
 
   using Zip = Zipped< ENDFTypes... >;
   auto iterators = makeIteratorTuple( result, Zip::tupleIndices );
 
   int remainingLines = nEntries / Zip::tuplesPerRecord;
-  while ( remainingLines-- ){
-    readLine< Zip >( iterators, it, end, lineNumber, MAT, MF, MT );
-    increment< Zip >( iterators );
+  if constexpr ( Zip::realLine && isContiguous< Iterator > ){
+    const auto tail = makeTail( MAT, MF, MT );
+    const bool verify = ParseOptions::active().verifyTails;
+    while ( remainingLines-- ){
+      if ( not readRealLine< Zip >( iterators, it, end, lineNumber,
+                                    tail, verify ) ){
+        readLine< Zip >( iterators, it, end, lineNumber, MAT, MF, MT );
+      }
+      increment< Zip >( iterators );
+    }
+  }
+  else {
+    while ( remainingLines-- ){
+      readLine< Zip >( iterators, it, end, lineNumber, MAT, MF, MT );
+      increment< Zip >( iterators );
+    }
   }
     
   const int remainingEntries = nEntries % Zip::tuplesPerRecord;
@@ -23,6 +38,37 @@ unzip
       ( remainingEntries, iterators, it, end, lineNumber,
         MAT, MF, MT, Zip::tupleIndices );
   }
-    
+}
+
+/**
+ *  @brief Read the values into vectors
+ */
+template< typename... ENDFTypes, typename Iterator >
+static std::tuple< std::vector< typename ENDFTypes::Type >... >
+unzip
+( uint64_t nEntries,
+  Iterator& it, const Iterator& end, long& lineNumber,
+  int MAT, int MF, int MT ){
+
+  std::tuple< std::vector< typename ENDFTypes::Type >... > result;
+  unzipInto< ENDFTypes... >( result, nEntries,
+                             it, end, lineNumber, MAT, MF, MT );
+  return result;
+}
+
+/**
+ *  @brief Read the values into vectors using the given memory resource
+ */
+template< typename... ENDFTypes, typename Iterator >
+static std::tuple< std::pmr::vector< typename ENDFTypes::Type >... >
+unzip
+( std::pmr::memory_resource* resource, uint64_t nEntries,
+  Iterator& it, const Iterator& end, long& lineNumber,
+  int MAT, int MF, int MT ){
+
+  std::tuple< std::pmr::vector< typename ENDFTypes::Type >... >
+    result{ std::pmr::vector< typename ENDFTypes::Type >( resource )... };
+  unzipInto< ENDFTypes... >( result, nEntries,
+                             it, end, lineNumber, MAT, MF, MT );
   return result;
 }
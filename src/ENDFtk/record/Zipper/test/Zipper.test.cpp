@@ -16,5 +16,6 @@ using namespace njoy::ENDFtk::record;
 #include "ENDFtk/record/Zipper/test/process.test.hpp"
 #include "ENDFtk/record/Zipper/test/readLine.test.hpp"
 #include "ENDFtk/record/Zipper/test/readPartialLine.test.hpp"
+#include "ENDFtk/record/Zipper/test/readRealLine.test.hpp"
 #include "ENDFtk/record/Zipper/test/reserve.test.hpp"
 #include "ENDFtk/record/Zipper/test/unzip.test.hpp"
@@ -0,0 +1,68 @@
+SCENARIO( "The Zipper readRealLine function", "[ENDFtk], [Zipper]" ){
+  GIVEN("a full line of real values" ){
+    std::string line =
+      " 1.000000-5 2.000000+0 3.000000+0 4.000000+0 5.000000+0 6.000000+7 125 3102    1\n"
+      " 1.000000-5 2.000000+0 3.000000+0 4.000000+0 5.000000+0 6.000000+7 125 3102\r\n"
+      " 1.000000-5 2.000000+0 3.000000+0 4.000000+0 5.000000+0 6.000000+7 125 3 12    1\n"
+      " 1.000000-5 2.000000+0 3.000000+0 4.000000+0 5.000000+0 6.000000+7 125 3102\n";
+
+    using Zip = Zipper::Zipped< Real, Real >;
+    auto tail = Zipper::makeTail( 125, 3, 102 );
+
+    auto it = line.begin();
+    auto end = line.end();
+    auto lineNumber = 0l;
+    std::array< double, 3 > xsink;
+    std::array< double, 3 > ysink;
+
+    auto iteratorTuple = std::make_tuple( xsink.begin(), ysink.begin() );
+
+    WHEN("passed to the zipper's readRealLine function"){
+      THEN( "values will be correct"){
+        CHECK( " 125 3102" == tail );
+        CHECK( true == Zip::realLine );
+        CHECK( false == Zipper::Zipped< Real, Integer<11> >::realLine );
+
+        CHECK( true == Zipper::readRealLine< Zip >
+                         ( iteratorTuple, it, end, lineNumber, tail ) );
+        CHECK_THAT( xsink[0], WithinRel( 1e-5 ) );
+        CHECK_THAT( ysink[0], WithinRel( 2. ) );
+        CHECK_THAT( xsink[1], WithinRel( 3. ) );
+        CHECK_THAT( ysink[1], WithinRel( 4. ) );
+        CHECK_THAT( xsink[2], WithinRel( 5. ) );
+        CHECK_THAT( ysink[2], WithinRel( 6e+7 ) );
+        CHECK( 1 == lineNumber );
+        CHECK( std::next( line.begin(), 81 ) == it );
+
+        // a line with a carriage return and without sequence number
+        CHECK( true == Zipper::readRealLine< Zip >
+                         ( iteratorTuple, it, end, lineNumber, tail ) );
+        CHECK( 2 == lineNumber );
+        CHECK( std::next( line.begin(), 158 ) == it );
+      }
+    }
+
+    WHEN("the line cannot be read using the fast path"){
+      THEN( "nothing is consumed"){
+        it = std::next( line.begin(), 158 );
+        CHECK( false == Zipper::readRealLine< Zip >
+                          ( iteratorTuple, it, end, lineNumber, tail ) );
+        CHECK( 0 == lineNumber );
+        CHECK( std::next( line.begin(), 158 ) == it );
+
+        CHECK( "" == Zipper::makeTail( 10000, 3, 102 ) );
+        it = line.begin();
+        CHECK( false == Zipper::readRealLine< Zip >
+                          ( iteratorTuple, it, end, lineNumber, "" ) );
+        CHECK( line.begin() == it );
+
+        // the end of the buffer
+        it = end;
+        CHECK( false == Zipper::readRealLine< Zip >
+                          ( iteratorTuple, it, end, lineNumber, tail ) );
+        CHECK( end == it );
+        CHECK( 0 == lineNumber );
+      }
+    }
+  }
+}
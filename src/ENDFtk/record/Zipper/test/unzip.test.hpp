@@ -21,3 +21,48 @@ SCENARIO( "The Zipper unzip function", "[ENDFtk], [Zipper]" ){
     }
   }
 }
+
+SCENARIO( "The Zipper unzip function for real values", "[ENDFtk], [Zipper]" ){
+  GIVEN("a record with zipped real values" ){
+    std::string line =
+      " 1.000000+0 2.000000+0 3.000000+0 4.000000+0 5.000000+0 6.000000+0 125 3102    1\n"
+      " 7.000000+0 8.000000+0 9.000000+0 1.000000+1 1.100000+1 1.200000+1 125 3102    2\n"
+      " 1.300000+1 1.400000+1                                             125 3102    3\n";
+
+    WHEN("passed to the zipper's unzip function"){
+      THEN( "extracted values will be correct"){
+        auto it = line.begin();
+        auto end = line.end();
+        auto lineNumber = 0l;
+        auto vectors = Zipper::unzip< Real, Real >
+          ( 7, it, end, lineNumber, 125, 3, 102 );
+        for ( int i = 0; i < 7; ++i ){
+          CHECK_THAT( std::get< 0 >( vectors )[i], WithinRel( double(2 * i + 1) ) );
+          CHECK_THAT( std::get< 1 >( vectors )[i], WithinRel( double(2 * i + 2) ) );
+        }
+        CHECK( 3 == lineNumber );
+        CHECK( end == it );
+
+        it = line.begin();
+        lineNumber = 0;
+        auto values = Zipper::unzip< Real >
+          ( 14, it, end, lineNumber, 125, 3, 102 );
+        for ( int i = 0; i < 14; ++i ){
+          CHECK_THAT( std::get< 0 >( values )[i], WithinRel( double(i + 1) ) );
+        }
+        CHECK( 3 == lineNumber );
+        CHECK( end == it );
+      }
+    }
+
+    WHEN("the record has an unexpected tail"){
+      THEN( "an exception is thrown"){
+        auto it = line.begin();
+        auto end = line.end();
+        auto lineNumber = 0l;
+        CHECK_THROWS( Zipper::unzip< Real, Real >
+                        ( 7, it, end, lineNumber, 125, 3, 1 ) );
+      }
+    }
+  }
+}
@@ -0,0 +1,131 @@
+#ifndef NJOY_ENDFTK_RECORD_NARROW
+#define NJOY_ENDFTK_RECORD_NARROW
+
+// system includes
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <exception>
+#include <limits>
+#include <memory_resource>
+#include <type_traits>
+#include <vector>
+
+// other includes
+#include "ENDFtk/Log.hpp"
+#include "ENDFtk/ParseOptions.hpp"
+#include "ENDFtk/record/StoredValues.hpp"
+
+namespace njoy {
+namespace ENDFtk {
+namespace record {
+
+  /**
+   *  @brief Return the values in single precision and release the double
+   *         precision values
+   *
+   *  The single precision values use the memory resource of the double
+   *  precision values (the default memory resource for a std::vector). A
+   *  finite value outside of the single precision range overflows to infinity
+   *  (a warning is issued). The precision report in the active parse options
+   *  (if any) is updated with the number of values, the number of values
+   *  that overflowed, the number of values that were not exactly
+   *  representable and the largest relative difference between a finite
+   *  value and its single precision representation.
+   *
+   *  @param[in,out] doubles   the values in double precision
+   */
+  template< typename Allocator >
+  std::pmr::vector< float >
+  narrow( std::vector< double, Allocator >& doubles ) {
+
+    std::pmr::memory_resource* resource = std::pmr::get_default_resource();
+    if constexpr ( std::is_same_v< Allocator,
+                                   std::pmr::polymorphic_allocator< double > > ) {
+
+      resource = doubles.get_allocator().resource();
+    }
+
+    std::pmr::vector< float > floats( resource );
+    floats.reserve( doubles.size() );
+
+    std::size_t overflows = 0;
+    std::size_t inexact = 0;
+    double error = 0.;
+    for ( auto value : doubles ) {
+
+      // converting a value outside of the single precision range is undefined
+      if ( std::isfinite( value ) and
+           std::abs( value ) > std::numeric_limits< float >::max() ) {
+
+        ++overflows;
+        const float infinity = std::numeric_limits< float >::infinity();
+        floats.push_back( value < 0. ? -infinity : infinity );
+        continue;
+      }
+
+      const float narrowed = static_cast< float >( value );
+      if ( narrowed != value and not std::isnan( value ) ) {
+
+        ++inexact;
+        error = std::max( error, std::abs( ( narrowed - value ) / value ) );
+      }
+      floats.push_back( narrowed );
+    }
+
+    if ( overflows ) {
+
+      Log::warning( "Values overflowed when stored in single precision" );
+      Log::info( "Number of values: {}", overflows );
+    }
+
+    auto report = ParseOptions::active().precisionReport;
+    if ( report ) {
+
+      report->values += floats.size();
+      report->overflows += overflows;
+      report->inexact += inexact;
+      report->maxRelativeError = std::max( report->maxRelativeError, error );
+    }
+
+    std::vector< double, Allocator >( doubles.get_allocator() ).swap( doubles );
+    return floats;
+  }
+
+  /**
+   *  @brief Return the values in single precision and release the double
+   *         precision values
+   *
+   *  @param[in,out] doubles   the values in double precision
+   */
+  inline std::pmr::vector< float > narrow( StoredValues< double >& doubles ) {
+
+    return doubles.visit( [] ( auto& values ) { return narrow( values ); } );
+  }
+
+  /**
+   *  @brief Verify that values stored in single precision may be printed
+   *
+   *  Printing values stored in single precision does not reproduce the values
+   *  that were parsed, so it must be allowed explicitly by setting lossyOutput
+   *  in the parse options used to read the record. The record stores this
+   *  flag when its values are narrowed.
+   *
+   *  @param[in] allowed   whether or not lossy output was allowed
+   */
+  inline void verifyLossyOutput( bool allowed ) {
+
+    if ( not allowed ) {
+
+      Log::error( "Values stored in single precision cannot be printed" );
+      Log::info( "Set lossyOutput in the parse options used to read the "
+                 "record to allow printing these values" );
+      throw std::exception();
+    }
+  }
+
+} // record namespace
+} // ENDFtk namespace
+} // njoy namespace
+
+#endif
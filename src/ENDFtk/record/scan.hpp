@@ -0,0 +1,298 @@
+#ifndef NJOY_ENDFTK_RECORD_SCAN
+#define NJOY_ENDFTK_RECORD_SCAN
+
+// system includes
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+// other includes
+#include "ENDFtk/Log.hpp"
+#include "ENDFtk/record/Tail.hpp"
+#include "ENDFtk/record/ScannedDivision.hpp"
+#include "ENDFtk/record/RealParser.hpp"
+
+namespace njoy {
+namespace ENDFtk {
+namespace record {
+
+  /**
+   *  @brief Return whether or not the iterator points into contiguous memory
+   *
+   *  This is true for character pointers (e.g. const char*) and for the
+   *  iterators of std::string, std::string_view and std::vector< char >.
+   */
+  template< typename Iterator >
+  constexpr bool isContiguous =
+      std::is_pointer< Iterator >::value ||
+      std::is_same< Iterator, std::string::iterator >::value ||
+      std::is_same< Iterator, std::string::const_iterator >::value ||
+      std::is_same< Iterator, std::string_view::iterator >::value ||
+      std::is_same< Iterator, std::string_view::const_iterator >::value ||
+      std::is_same< Iterator, std::vector< char >::iterator >::value ||
+      std::is_same< Iterator, std::vector< char >::const_iterator >::value;
+
+  /**
+   *  @brief Return the position of the newline character that ends the
+   *         current line, or the end of the buffer if there is none
+   *
+   *  @param[in] begin   the beginning of the current line
+   *  @param[in] end     the end of the buffer
+   */
+  template< typename Iterator >
+  Iterator findLineEnd( const Iterator& begin, const Iterator& end ) {
+
+    if constexpr ( isContiguous< Iterator > ) {
+
+      if ( begin == end ) {
+
+        return end;
+      }
+
+      const char* first = &*begin;
+      const void* found = std::memchr( first, '\n', std::distance( begin, end ) );
+      return found ? std::next( begin, static_cast< const char* >( found ) - first )
+                   : end;
+    }
+    else {
+
+      return std::find( begin, end, '\n' );
+    }
+  }
+
+  /**
+   *  @brief Decode an integer field of a line without throwing
+   *
+   *  The field may contain leading and trailing blanks and a sign. A blank
+   *  field is read as zero. The function returns false if the field is not a
+   *  valid integer.
+   *
+   *  @param[in]  begin    the beginning of the line
+   *  @param[in]  offset   the offset of the field in the line
+   *  @param[in]  width    the width of the field
+   *  @param[out] value    the decoded value
+   */
+  template< typename Iterator >
+  bool readInteger( const Iterator& begin, long offset, long width,
+                    long& value ) {
+
+    value = 0;
+    bool negative = false;
+    bool sign = false;
+    bool digits = false;
+    bool trailing = false;
+    auto character = std::next( begin, offset );
+    for ( long column = 0; column < width; ++column ) {
+
+      const char c = *character++;
+      if ( c == ' ' ) {
+
+        trailing = digits || sign;
+      }
+      else if ( trailing ) {
+
+        return false;
+      }
+      else if ( ( c == '-' ) || ( c == '+' ) ) {
+
+        if ( digits || sign ) { return false; }
+        sign = true;
+        negative = c == '-';
+      }
+      else if ( ( c >= '0' ) && ( c <= '9' ) ) {
+
+        digits = true;
+        value = 10 * value + ( c - '0' );
+      }
+      else {
+
+        return false;
+      }
+    }
+    if ( sign && not digits ) { return false; }
+    if ( negative ) { value = -value; }
+    return true;
+  }
+
+  /**
+   *  @brief Decode the MAT, MF and MT numbers of a line without throwing
+   *
+   *  Only columns 67 to 75 of the line are decoded. The missing columns of a
+   *  line shorter than 75 characters are read as blanks, in the same way the
+   *  records read them. No value is returned if one of the fields is not a
+   *  valid MAT, MF or MT number (the MAT number must be at least -1, the MF
+   *  and MT numbers at least 0).
+   *
+   *  @param[in] begin   the beginning of the line
+   *  @param[in] eol     the end of the line
+   */
+  template< typename Iterator >
+  std::optional< Tail > readTail( const Iterator& begin, const Iterator& eol ) {
+
+    if ( std::distance( begin, eol ) < 75 ) {
+
+      char line[ 75 ];
+      std::fill( std::copy( begin, eol, line ), line + 75, ' ' );
+      return readTail< const char* >( line, line + 75 );
+    }
+
+    long mat, mf, mt;
+    if ( readInteger( begin, 66, 4, mat ) && ( mat >= -1 ) &&
+         readInteger( begin, 70, 2, mf ) && ( mf >= 0 ) &&
+         readInteger( begin, 72, 3, mt ) && ( mt >= 0 ) ) {
+
+      return Tail( static_cast< int >( mat ), static_cast< int >( mf ),
+                   static_cast< int >( mt ) );
+    }
+    return std::nullopt;
+  }
+
+  /**
+   *  @brief Decode whether or not the six fields in the first 66 columns of a
+   *         line are zero without throwing
+   *
+   *  Blank fields are read as zero. No value is returned if one of the fields
+   *  is not a valid number.
+   *
+   *  @param[in] begin   the beginning of the line (at least 66 characters)
+   */
+  template< typename Iterator >
+  std::optional< bool > readEmptyBase( const Iterator& begin ) {
+
+    auto base = std::next( begin, 66 );
+    if ( std::all_of( begin, base, [] ( char c ) { return c == ' '; } ) ) {
+
+      return true;
+    }
+
+    bool empty = true;
+    char field[ 11 ];
+    for ( long offset = 0; offset < 22; offset += 11 ) {
+
+      std::copy( std::next( begin, offset ), std::next( begin, offset + 11 ),
+                 field );
+      double value = 0.;
+      if ( not RealParser::decode( std::string_view( field, 11 ), value ) ) {
+
+        return std::nullopt;
+      }
+      empty = empty && ( value == 0. );
+    }
+    for ( long offset = 22; offset < 66; offset += 11 ) {
+
+      long value = 0;
+      if ( not readInteger( begin, offset, 11, value ) ) {
+
+        return std::nullopt;
+      }
+      empty = empty && ( value == 0 );
+    }
+    return empty;
+  }
+
+  /**
+   *  @brief Decode the structure information of a line without throwing
+   *
+   *  In addition to the MAT, MF and MT numbers (see readTail()), the first 66
+   *  columns are decoded for lines with an MT number equal to 0 since they
+   *  can only be a SEND, FEND, MEND or TEND record when these columns are
+   *  zero. The missing columns of a line shorter than 75 characters are read
+   *  as blanks. No value is returned if one of the decoded fields is not
+   *  valid.
+   *
+   *  @param[in] begin   the beginning of the line
+   *  @param[in] eol     the end of the line
+   */
+  template< typename Iterator >
+  std::optional< ScannedDivision >
+  readDivision( const Iterator& begin, const Iterator& eol ) {
+
+    if ( std::distance( begin, eol ) < 75 ) {
+
+      char line[ 75 ];
+      std::fill( std::copy( begin, eol, line ), line + 75, ' ' );
+      return readDivision< const char* >( line, line + 75 );
+    }
+
+    auto tail = readTail( begin, eol );
+    if ( not tail ) {
+
+      return std::nullopt;
+    }
+    if ( tail->MT() != 0 ) {
+
+      return ScannedDivision( *tail, false );
+    }
+
+    auto empty = readEmptyBase( begin );
+    if ( not empty ) {
+
+      return std::nullopt;
+    }
+    return ScannedDivision( *tail, *empty );
+  }
+
+  /**
+   *  @brief Skip the current line and return its structure information
+   *
+   *  Unlike skip(), this function does not read the sequence number of the
+   *  line and only reads the first 66 columns when the MT number is 0 (see
+   *  readDivision()). It looks for the end of the line and decodes the MAT,
+   *  MF and MT numbers in columns 67 to 75, which is all that is required to
+   *  find the structure of an ENDF tape.
+   *
+   *  The missing columns of a line shorter than 75 characters are read as
+   *  blanks, like the records do, as long as the line is terminated by a
+   *  newline character. An exception is thrown when the last line of the
+   *  buffer is shorter than 75 characters (the record is incomplete) or when
+   *  the decoded fields are not valid.
+   *
+   *  @param[in,out] begin        the beginning of the line
+   *  @param[in]     end          the end of the buffer
+   *  @param[in,out] lineNumber   the current line number
+   */
+  template< typename Iterator >
+  ScannedDivision scan( Iterator& begin, const Iterator& end,
+                        long& lineNumber ) {
+
+    const auto eol = findLineEnd( begin, end );
+    if ( ( eol == end ) && ( std::distance( begin, eol ) < 75 ) ) {
+
+      Log::error( "Encountered the end of the buffer before the end of a "
+                  "record" );
+      Log::info( "Error while scanning line {}", lineNumber );
+      throw std::exception();
+    }
+
+    auto division = readDivision( begin, eol );
+    if ( not division ) {
+
+      if ( readTail( begin, eol ) ) {
+
+        Log::error( "Encountered an illegal value in the first 66 columns of "
+                    "a structure record" );
+      }
+      else {
+
+        Log::error( "Encountered an illegal MAT, MF or MT number" );
+      }
+      Log::info( "Error while scanning line {}: \"{}\"",
+                 lineNumber, std::string( begin, eol ) );
+      throw std::exception();
+    }
+
+    begin = eol == end ? end : std::next( eol );
+    ++lineNumber;
+    return *division;
+  }
+
+} // record namespace
+} // ENDFtk namespace
+} // njoy namespace
+
+#endif
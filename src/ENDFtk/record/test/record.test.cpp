@@ -1,8 +1,11 @@
 // include Catch2
 #include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
 
 // what we are testing
 #include "ENDFtk/record/skip.hpp"
+#include "ENDFtk/record/scan.hpp"
+#include "ENDFtk/record/narrow.hpp"
 
 // other includes
 
@@ -44,3 +47,232 @@ SCENARIO( "Skipping records" ) {
     } // WHEN
   } // GIVEN
 } // SCENARIO
+
+SCENARIO( "Scanning records" ) {
+
+  GIVEN( "A string with a number of lines" ) {
+
+    std::string line =
+      " 1.000000+0 2.000000+0 3.000000+0 4.000000+0 5.000000+0 6.000000+0 125 1451    1\n"
+      "                                                                   125 1  0    2\n"
+      "                                                                   125 0  0    0\n"
+      "                                                                     0 0  0    0\n"
+      "                                                                    -1 0  0    0";
+
+    auto it = line.begin();
+    auto end = line.end();
+    auto lineNumber = 0l;
+    WHEN( "scanning records" ) {
+
+      THEN( "the MAT, MF and MT numbers are returned" ) {
+
+        auto division = record::scan(it, end, lineNumber);
+        CHECK( 125 == division.MAT() );
+        CHECK( 1 == division.MF() );
+        CHECK( 451 == division.MT() );
+        CHECK( true == division.isHead() );
+
+        division = record::scan(it, end, lineNumber);
+        CHECK( true == division.isSend() );
+        division = record::scan(it, end, lineNumber);
+        CHECK( true == division.isFend() );
+        division = record::scan(it, end, lineNumber);
+        CHECK( true == division.isMend() );
+        division = record::scan(it, end, lineNumber);
+        CHECK( true == division.isTend() );
+        CHECK( it == end );
+        CHECK( 5 == lineNumber );
+      } // THEN
+
+      THEN( "structure records require zero or blank fields like a "
+            "StructureDivision" ) {
+
+        std::string line =
+          " 0.000000+0 0.0                 0          0         +0            125 1  0     \n"
+          " 1.000000+0                                                        125 1  0     \n"
+          "                                                      1              0 0  0     \n";
+        auto it = line.cbegin();
+        auto end = line.cend();
+        auto lineNumber = 0l;
+
+        auto division = record::scan(it, end, lineNumber);
+        CHECK( true == division.isSend() );
+        division = record::scan(it, end, lineNumber);
+        CHECK( false == division.isSend() );
+        CHECK( false == division.isHead() );
+        division = record::scan(it, end, lineNumber);
+        CHECK( false == division.isMend() );
+        CHECK( it == end );
+      } // THEN
+
+      THEN( "the missing columns of a short line are read as blanks" ) {
+
+        std::string line = "\n"
+          " 1.000000+0 2.000000+0\n"
+          "short line\n";
+        std::string_view view( line );
+        auto it = view.begin();
+        auto end = view.end();
+        auto lineNumber = 0l;
+
+        auto division = record::scan(it, end, lineNumber);
+        CHECK( true == division.isMend() );
+        division = record::scan(it, end, lineNumber);
+        CHECK( 0 == division.MT() );
+        CHECK( false == division.isMend() );
+        CHECK( std::next( view.begin(), 24 ) == it );
+        CHECK_THROWS( record::scan(it, end, lineNumber) );
+
+        auto begin = std::next( view.begin(), 24 );
+        auto eol = record::findLineEnd( begin, end );
+        auto tail = record::readTail( begin, eol );
+        CHECK( true == tail.has_value() );
+        CHECK( 0 == tail->MAT() );
+        CHECK( false == record::readDivision( begin, eol ).has_value() );
+      } // THEN
+
+      THEN( "an exception is thrown for an illegal value in a structure "
+            "record" ) {
+
+        std::string line =
+          " 1.000000+0 2.00000a+0                                             125 1  0    1\n";
+        auto it = line.begin();
+        auto end = line.end();
+        auto lineNumber = 0l;
+        CHECK_THROWS( record::scan(it, end, lineNumber) );
+      } // THEN
+
+      THEN( "an exception is thrown with there isn't enough characters" ) {
+
+        std::string line =
+          " 1.000000+0 2.000000+0 3.000000+0 4.000000+0 5.000000+0 6.000000+0 125 14";
+        auto it = line.begin();
+        auto end = line.end();
+        auto lineNumber = 0l;
+        CHECK_THROWS( record::scan(it, end, lineNumber) );
+      } // THEN
+
+      THEN( "an exception is thrown for an illegal MAT, MF or MT number" ) {
+
+        std::string line =
+          " 1.000000+0 2.000000+0 3.000000+0 4.000000+0 5.000000+0 6.000000+0 1 5 1451    1\n";
+        auto it = line.begin();
+        auto end = line.end();
+        auto lineNumber = 0l;
+        CHECK_THROWS( record::scan(it, end, lineNumber) );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+} // SCENARIO
+
+TEST_CASE( "Skipping and scanning a large tape", "[.][benchmark]" ) {
+
+  const long lines = 100000;
+  std::string tape;
+  tape.reserve( 81 * lines );
+  for ( long i = 0; i < lines; ++i ) {
+
+    tape += " 1.000000+0 2.000000+0 3.000000+0 4.000000+0 5.000000+0 6.000000+0 125 3  1    1\n";
+  }
+
+  // divide the lines by the mean time to get the number of lines per second
+  BENCHMARK( "record::skip" ) {
+
+    auto it = tape.cbegin();
+    auto end = tape.cend();
+    long lineNumber = 0;
+    while ( it != end ) { record::skip( it, end, lineNumber ); }
+    return lineNumber;
+  };
+
+  BENCHMARK( "record::scan" ) {
+
+    auto it = tape.cbegin();
+    auto end = tape.cend();
+    long lineNumber = 0;
+    while ( it != end ) { record::scan( it, end, lineNumber ); }
+    return lineNumber;
+  };
+}
+
+SCENARIO( "Narrowing values" ) {
+
+  GIVEN( "values in double precision" ) {
+
+    WHEN( "the values are narrowed" ) {
+
+      std::pmr::vector< double > doubles = { 1., 0.1, 0., -1e+10 };
+
+      PrecisionReport report;
+      ParseOptions options;
+      options.precisionReport = &report;
+      ParseOptions::Scope scope( options );
+
+      auto floats = record::narrow( doubles );
+
+      THEN( "the double precision values are released and the report is "
+            "updated" ) {
+
+        CHECK( 0 == doubles.size() );
+        CHECK( 0 == doubles.capacity() );
+        CHECK( 4 == floats.size() );
+        CHECK( 0.1f == floats[1] );
+        CHECK( 0.f == floats[2] );
+        CHECK( -1e+10f == floats[3] );
+
+        CHECK( 4 == report.values );
+        CHECK( 0 == report.overflows );
+        CHECK( 1 == report.inexact );
+        CHECK( 16 == report.savedMemory() );
+        CHECK( 0. < report.maxRelativeError );
+        CHECK( report.maxRelativeError < 1e-7 );
+      } // THEN
+    } // WHEN
+
+    WHEN( "values are outside of the single precision range" ) {
+
+      std::pmr::vector< double > doubles = { 1., 1e+300, -1e+300, 1e-300 };
+
+      PrecisionReport report;
+      ParseOptions options;
+      options.precisionReport = &report;
+      ParseOptions::Scope scope( options );
+
+      auto floats = record::narrow( doubles );
+
+      THEN( "the overflows and the loss of precision are reported" ) {
+
+        CHECK( 4 == floats.size() );
+        CHECK( 1.f == floats[0] );
+        CHECK( std::numeric_limits< float >::infinity() == floats[1] );
+        CHECK( -std::numeric_limits< float >::infinity() == floats[2] );
+        CHECK( 0.f == floats[3] );
+
+        CHECK( 4 == report.values );
+        CHECK( 2 == report.overflows );
+        CHECK( 1 == report.inexact );
+        CHECK( 1. == report.maxRelativeError );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+} // SCENARIO
+
+SCENARIO( "Verifying lossy output" ) {
+
+  GIVEN( "records read with and without lossy output" ) {
+
+    WHEN( "printing single precision values is verified" ) {
+
+      THEN( "an exception is thrown unless lossy output was allowed" ) {
+
+        CHECK_THROWS( record::verifyLossyOutput( false ) );
+        CHECK_NOTHROW( record::verifyLossyOutput( true ) );
+
+        ParseOptions options;
+        options.lossyOutput = true;
+        ParseOptions::Scope scope( options );
+        CHECK_THROWS( record::verifyLossyOutput( false ) );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+} // SCENARIO
@@ -251,6 +251,16 @@ namespace section {
     long NC() const { return 4 + this->NWD() + this->NXC(); }
 
     #include "ENDFtk/section/1/451/src/description.hpp"
+
+    /**
+     *  @brief Return the memory owned by the section (outside of the object)
+     */
+    MemoryUsage memoryUsage() const {
+
+      return MemoryUsage::of( this->parameters_, this->description_,
+                              this->index_ );
+    }
+
     #include "ENDFtk/section/1/451/src/print.hpp"
 
     /**
@@ -71,6 +71,14 @@ namespace section {
                                                 { return v.NC(); },
                                              this->data_ ); }
 
+    /**
+     *  @brief Return the memory owned by the section (outside of the object)
+     */
+    MemoryUsage memoryUsage() const {
+
+      return MemoryUsage::of( this->data_ );
+    }
+
     #include "ENDFtk/section/1/452/src/print.hpp"
 
     /**
@@ -107,6 +107,14 @@ namespace section{
                                                 { return v.NC(); },
                                              this->nubar_ ); }
 
+    /**
+     *  @brief Return the memory owned by the section (outside of the object)
+     */
+    MemoryUsage memoryUsage() const {
+
+      return MemoryUsage::of( this->lambda_, this->nubar_ );
+    }
+
     #include "ENDFtk/section/1/455/src/print.hpp"
 
     /**
@@ -72,5 +72,6 @@ public:
   }
 
   using ListRecord::NC;
+  using ListRecord::memoryUsage;
   using ListRecord::print;
 };
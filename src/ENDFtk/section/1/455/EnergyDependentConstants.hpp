@@ -90,5 +90,6 @@ public:
   auto incidentEnergies() const { return this->E(); }
 
   using InterpolationSequenceRecord::NC;
+  using InterpolationSequenceRecord::memoryUsage;
   using InterpolationSequenceRecord::print;
 };
@@ -172,5 +172,6 @@ public:
   auto total() const  { return this->ET(); }
 
   using ListRecord::NC;
+  using ListRecord::memoryUsage;
   using ListRecord::print;
 };
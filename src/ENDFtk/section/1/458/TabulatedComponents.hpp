@@ -224,5 +224,14 @@ public:
   }
 
   #include "ENDFtk/section/1/458/TabulatedComponents/src/NC.hpp"
+
+  /**
+   *  @brief Return the memory owned by the component (outside of the object)
+   */
+  MemoryUsage memoryUsage() const {
+
+    return MemoryUsage::of( this->values_, this->components_ );
+  }
+
   #include "ENDFtk/section/1/458/TabulatedComponents/src/print.hpp"
 };
@@ -167,5 +167,6 @@ public:
   auto total() const  { return this->ET(); }
 
   using ListRecord::NC;
+  using ListRecord::memoryUsage;
   using ListRecord::print;
 };
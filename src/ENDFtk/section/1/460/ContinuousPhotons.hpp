@@ -57,5 +57,6 @@ public:
   auto decayConstants() const { return this->lambdas(); }
 
   using ListRecord::NC;
+  using ListRecord::memoryUsage;
   using ListRecord::print;
 };
@@ -51,5 +51,6 @@ public:
   using TabulationRecord::interpolants;
   using TabulationRecord::boundaries;
   using TabulationRecord::NC;
+  using TabulationRecord::memoryUsage;
   using TabulationRecord::print;
 };
@@ -48,5 +48,14 @@ public:
   }
 
   #include "ENDFtk/section/1/460/DiscretePhotons/src/NC.hpp"
+
+  /**
+   *  @brief Return the memory owned by the component (outside of the object)
+   */
+  MemoryUsage memoryUsage() const {
+
+    return MemoryUsage::of( this->photons_ );
+  }
+
   #include "ENDFtk/section/1/460/DiscretePhotons/src/print.hpp"
 };
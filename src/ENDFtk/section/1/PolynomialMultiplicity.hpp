@@ -60,6 +60,7 @@ namespace section{
     auto coefficients() const { return this->C(); }
 
     using ListRecord::NC;
+    using ListRecord::memoryUsage;
     using ListRecord::print;
   };
 
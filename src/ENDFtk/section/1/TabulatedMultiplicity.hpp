@@ -64,6 +64,7 @@ namespace section{
     using TabulationRecord::interpolants;
     using TabulationRecord::boundaries;
     using TabulationRecord::NC;
+    using TabulationRecord::memoryUsage;
     using TabulationRecord::print;
   };
 
@@ -81,6 +81,15 @@ namespace section {
     const PhotonProduction& photonProduction() const { return this->photon_; }
 
     #include "ENDFtk/section/12/src/NC.hpp"
+
+    /**
+     *  @brief Return the memory owned by the section (outside of the object)
+     */
+    MemoryUsage memoryUsage() const {
+
+      return MemoryUsage::of( this->photon_ );
+    }
+
     #include "ENDFtk/section/12/src/print.hpp"
 
     using Base::MT;
@@ -73,5 +73,14 @@ public:
   }
 
   #include "ENDFtk/section/12/Multiplicities/src/NC.hpp"
+
+  /**
+   *  @brief Return the memory owned by the component (outside of the object)
+   */
+  MemoryUsage memoryUsage() const {
+
+    return MemoryUsage::of( this->total_, this->partials_ );
+  }
+
   #include "ENDFtk/section/12/Multiplicities/src/print.hpp"
 };
@@ -128,5 +128,6 @@ public:
   auto conditionalProbabilities() const { return this->GP(); }
 
   using ListRecord::NC;
+  using ListRecord::memoryUsage;
   using ListRecord::print;
 };
@@ -79,6 +79,15 @@ namespace section {
     }
 
     #include "ENDFtk/section/13/src/NC.hpp"
+
+    /**
+     *  @brief Return the memory owned by the section (outside of the object)
+     */
+    MemoryUsage memoryUsage() const {
+
+      return MemoryUsage::of( this->total_, this->partials_ );
+    }
+
     #include "ENDFtk/section/13/src/print.hpp"
 
     using Base::MT;
@@ -43,5 +43,6 @@ public:
   using TabulationRecord::y;
   using TabulationRecord::regions;
   using TabulationRecord::NC;
+  using TabulationRecord::memoryUsage;
   using TabulationRecord::print;
 };
@@ -139,6 +139,15 @@ namespace section {
     const auto& photonAngularDistributions() const { return this->photons_; }
 
     #include "ENDFtk/section/14/src/NC.hpp"
+
+    /**
+     *  @brief Return the memory owned by the section (outside of the object)
+     */
+    MemoryUsage memoryUsage() const {
+
+      return MemoryUsage::of( this->photons_ );
+    }
+
     #include "ENDFtk/section/14/src/print.hpp"
 
     using Base::MT;
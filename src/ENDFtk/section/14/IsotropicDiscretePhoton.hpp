@@ -64,5 +64,14 @@ public:
    */
   static constexpr long NC() { return 1; }
 
+  /**
+   *  @brief Return the memory owned by the component (the values are stored
+   *         in the object itself)
+   */
+  MemoryUsage memoryUsage() const {
+
+    return MemoryUsage();
+  }
+
   #include "ENDFtk/section/14/IsotropicDiscretePhoton/src/print.hpp"
 };
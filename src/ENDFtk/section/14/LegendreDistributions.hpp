@@ -72,5 +72,6 @@ public:
   using AngularDistributions< LegendreCoefficients >::angularDistributions;
 
   using AngularDistributions< LegendreCoefficients >::NC;
+  using AngularDistributions< LegendreCoefficients >::memoryUsage;
   using AngularDistributions< LegendreCoefficients >::print;
 };
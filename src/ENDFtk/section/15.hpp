@@ -69,6 +69,15 @@ namespace section {
     }
   
     #include "ENDFtk/section/5/src/NC.hpp"               // taken from MF5
+
+    /**
+     *  @brief Return the memory owned by the section (outside of the object)
+     */
+    MemoryUsage memoryUsage() const {
+
+      return MemoryUsage::of( this->partials_ );
+    }
+
     #include "ENDFtk/section/5/src/print.hpp"            // taken from MF5
   
     using Base::MT;
@@ -29,5 +29,14 @@ public:
   const Distribution& distribution() const { return this->distribution_; }
 
   #include "ENDFtk/section/15/PartialDistribution/src/NC.hpp"
+
+  /**
+   *  @brief Return the memory owned by the component (outside of the object)
+   */
+  MemoryUsage memoryUsage() const {
+
+    return MemoryUsage::of( this->probability_, this->distribution_ );
+  }
+
   #include "ENDFtk/section/15/PartialDistribution/src/print.hpp"
 };
@@ -2,9 +2,11 @@
 #define NJOY_ENDFTK_SECTION_2_151
 
 // system includes
+#include <array>
 #include <complex>
 #include <variant>
 #include <optional>
+#include <vector>
 
 // other includes
 #include "range/v3/algorithm/count.hpp"
@@ -116,6 +118,14 @@ namespace section {
     using BaseWithoutMT::atomicWeightRatio;
     using BaseWithoutMT::AWR;
 
+    /**
+     *  @brief Return the memory owned by the section (outside of the object)
+     */
+    MemoryUsage memoryUsage() const {
+
+      return MemoryUsage::of( this->isotopes_ );
+    }
+
     #include "ENDFtk/section/2/151/src/print.hpp"
     #include "ENDFtk/section/2/151/src/NC.hpp"
   };
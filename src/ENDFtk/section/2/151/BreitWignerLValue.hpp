@@ -117,6 +117,14 @@ public:
                     { return { std::move( chunk ) }; } );
   }
 
+  /**
+   *  @brief Return the resonance parameters as contiguous columns
+   *
+   *  The columns are ER, AJ, GT, GN, GG and GF.
+   */
+  using BreitWignerReichMooreLValueBase::columns;
+
   using BreitWignerReichMooreLValueBase::NC;
+  using BreitWignerReichMooreLValueBase::memoryUsage;
   using BreitWignerReichMooreLValueBase::print;
 };
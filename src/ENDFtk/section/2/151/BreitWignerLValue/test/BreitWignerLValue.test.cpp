@@ -266,6 +266,18 @@ void verifyChunk( const BreitWignerLValue& chunk ) {
   CHECK_THAT( 0.04, WithinRel( chunk.resonances()[1].competitiveWidth(), 1e-8 ) );
 
   CHECK( 3 == chunk.NC() );
+
+  auto columns = chunk.columns();
+  CHECK( 6 == columns.size() );
+  for ( unsigned int i = 0; i < 2; ++i ) {
+
+    CHECK( chunk.ER()[i] == columns[0][i] );
+    CHECK( chunk.AJ()[i] == columns[1][i] );
+    CHECK( chunk.GT()[i] == columns[2][i] );
+    CHECK( chunk.GN()[i] == columns[3][i] );
+    CHECK( chunk.GG()[i] == columns[4][i] );
+    CHECK( chunk.GF()[i] == columns[5][i] );
+  }
 }
 
 std::string invalidSize() {
@@ -122,5 +122,14 @@ public:
   }
 
   #include "ENDFtk/section/2/151/BreitWignerReichMooreBase/src/NC.hpp"
+
+  /**
+   *  @brief Return the memory owned by the component (outside of the object)
+   */
+  MemoryUsage memoryUsage() const {
+
+    return MemoryUsage::of( this->lvalues_ );
+  }
+
   #include "ENDFtk/section/2/151/BreitWignerReichMooreBase/src/print.hpp"
 };
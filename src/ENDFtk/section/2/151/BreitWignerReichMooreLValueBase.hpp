@@ -50,6 +50,14 @@ protected:
     return ListRecord::list() | ranges::views::chunk(6);
   }
 
+  /**
+   *  @brief Return the resonance parameters as six contiguous columns
+   */
+  std::array< std::vector< double >, 6 > columns() const {
+
+    return ListRecord::columns< 6 >();
+  }
+
 public:
 
   /* get methods */
@@ -111,5 +119,6 @@ public:
   auto spinValues() const { return this->AJ(); }
 
   using ListRecord::NC;
+  using ListRecord::memoryUsage;
   using ListRecord::print;
 };
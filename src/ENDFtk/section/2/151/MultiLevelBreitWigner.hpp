@@ -47,5 +47,6 @@ public:
   using BreitWignerReichMooreBase::lValues;
 
   using BreitWignerReichMooreBase::NC;
+  using BreitWignerReichMooreBase::memoryUsage;
   using BreitWignerReichMooreBase::print;
 };
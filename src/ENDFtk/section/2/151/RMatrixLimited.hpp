@@ -148,5 +148,14 @@ public:
   double scatteringRadius() const { return this->AP(); }
 
   #include "ENDFtk/section/2/151/RMatrixLimited/src/NC.hpp"
+
+  /**
+   *  @brief Return the memory owned by the component (outside of the object)
+   */
+  MemoryUsage memoryUsage() const {
+
+    return MemoryUsage::of( this->particle_pairs_, this->spin_groups_ );
+  }
+
   #include "ENDFtk/section/2/151/RMatrixLimited/src/print.hpp"
 };
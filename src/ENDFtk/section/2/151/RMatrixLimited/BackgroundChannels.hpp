@@ -63,5 +63,14 @@ public:
   unsigned int numberBackgroundChannels() const { return this->KBK(); }
 
   #include "ENDFtk/section/2/151/RMatrixLimited/BackgroundChannels/src/NC.hpp"
+
+  /**
+   *  @brief Return the memory owned by the component (outside of the object)
+   */
+  MemoryUsage memoryUsage() const {
+
+    return MemoryUsage::of( this->channels_ );
+  }
+
   #include "ENDFtk/section/2/151/RMatrixLimited/BackgroundChannels/src/print.hpp"
 };
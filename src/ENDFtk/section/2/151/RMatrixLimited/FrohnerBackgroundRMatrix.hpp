@@ -62,6 +62,15 @@ public:
    */
   static constexpr long NC() { return 3; }
 
+  /**
+   *  @brief Return the memory owned by the component (the values are stored
+   *         in the object itself)
+   */
+  MemoryUsage memoryUsage() const {
+
+    return MemoryUsage();
+  }
+
   /**
    *  @brief Print this MF2/MT151 component
    *
@@ -158,5 +158,6 @@ public:
                                                    { return int( mt ); } ); }
 
   using ListRecord::NC;
+  using ListRecord::memoryUsage;
   using ListRecord::print;
 };
@@ -151,5 +151,6 @@ public:
   auto effectiveChannelRadii() const { return this->APE(); }
 
   using ListRecord::NC;
+  using ListRecord::memoryUsage;
   using ListRecord::print;
 };
@@ -71,5 +71,6 @@ public:
   auto resonanceParameters() const { return this->GAM(); }
 
   using ListRecord::NC;
+  using ListRecord::memoryUsage;
   using ListRecord::print;
 };
@@ -95,5 +95,14 @@ public:
   long NC() const { return this->channels_.NC() + this->parameters_.NC() +
                            this->background_.NC(); };
 
+  /**
+   *  @brief Return the memory owned by the component (outside of the object)
+   */
+  MemoryUsage memoryUsage() const {
+
+    return MemoryUsage::of( this->channels_, this->parameters_,
+                            this->background_ );
+  }
+
   #include "ENDFtk/section/2/151/RMatrixLimited/SpinGroup/src/print.hpp"
 };
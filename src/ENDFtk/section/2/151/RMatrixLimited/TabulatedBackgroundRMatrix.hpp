@@ -106,6 +106,14 @@ public:
    */
   long NC() const { return 1 + this->real_.NC() + this->imaginary_.NC(); }
 
+  /**
+   *  @brief Return the memory owned by the component (outside of the object)
+   */
+  MemoryUsage memoryUsage() const {
+
+    return MemoryUsage::of( this->real_, this->imaginary_ );
+  }
+
   /**
    *  @brief Print this MF2/MT151 component
    *
@@ -53,5 +53,6 @@ public:
   using BreitWignerReichMooreBase::lValues;
 
   using BreitWignerReichMooreBase::NC;
+  using BreitWignerReichMooreBase::memoryUsage;
   using BreitWignerReichMooreBase::print;
 };
@@ -91,6 +91,14 @@ public:
                     { return { std::move( chunk ) }; } );
   }
 
+  /**
+   *  @brief Return the resonance parameters as contiguous columns
+   *
+   *  The columns are ER, AJ, GN, GG, GFA and GFB.
+   */
+  using BreitWignerReichMooreLValueBase::columns;
+
   using BreitWignerReichMooreLValueBase::NC;
+  using BreitWignerReichMooreLValueBase::memoryUsage;
   using BreitWignerReichMooreLValueBase::print;
 };
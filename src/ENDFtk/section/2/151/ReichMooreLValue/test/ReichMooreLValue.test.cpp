@@ -251,6 +251,18 @@ void verifyChunk( const ReichMooreLValue& chunk ) {
   CHECK_THAT( 4., WithinRel( chunk.resonances()[1].secondFissionWidth() ) );
 
   CHECK( 3 == chunk.NC() );
+
+  auto columns = chunk.columns();
+  CHECK( 6 == columns.size() );
+  for ( unsigned int i = 0; i < 2; ++i ) {
+
+    CHECK( chunk.ER()[i] == columns[0][i] );
+    CHECK( chunk.AJ()[i] == columns[1][i] );
+    CHECK( chunk.GN()[i] == columns[2][i] );
+    CHECK( chunk.GG()[i] == columns[3][i] );
+    CHECK( chunk.GFA()[i] == columns[4][i] );
+    CHECK( chunk.GFB()[i] == columns[5][i] );
+  }
 }
 
 std::string invalidSize() {
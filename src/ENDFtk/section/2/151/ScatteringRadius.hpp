@@ -42,5 +42,6 @@ public:
   using TabulationRecord::y;
   using TabulationRecord::regions;
   using TabulationRecord::NC;
+  using TabulationRecord::memoryUsage;
   using TabulationRecord::print;
 };
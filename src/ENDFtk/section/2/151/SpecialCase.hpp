@@ -75,5 +75,14 @@ public:
    */
   long NC() const { return 1; }
 
+  /**
+   *  @brief Return the memory owned by the component (the values are stored
+   *         in the object itself)
+   */
+  MemoryUsage memoryUsage() const {
+
+    return MemoryUsage();
+  }
+
   #include "ENDFtk/section/2/151/SpecialCase/src/print.hpp"
 };
@@ -106,4 +106,12 @@ public:
 
     return ranges::cpp20::views::all( this->lvalues_ );
   }
+
+  /**
+   *  @brief Return the memory owned by the component (outside of the object)
+   */
+  MemoryUsage memoryUsage() const {
+
+    return MemoryUsage::of( this->lvalues_ );
+  }
 };
@@ -167,5 +167,6 @@ public:
   }
 
   using ListRecord::NC;
+  using ListRecord::memoryUsage;
   using ListRecord::print;
 };
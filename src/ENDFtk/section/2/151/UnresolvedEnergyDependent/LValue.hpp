@@ -21,5 +21,6 @@ public:
   using UnresolvedLValueBase< JValue >::jValues;
 
   using UnresolvedLValueBase< JValue >::NC;
+  using UnresolvedLValueBase< JValue >::memoryUsage;
   using UnresolvedLValueBase< JValue >::print;
 };
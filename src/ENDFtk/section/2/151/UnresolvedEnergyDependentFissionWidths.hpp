@@ -101,5 +101,15 @@ public:
   using UnresolvedBaseWithoutSpin::lValues;
 
   #include "ENDFtk/section/2/151/UnresolvedEnergyDependentFissionWidths/src/NC.hpp"
+
+  /**
+   *  @brief Return the memory owned by the component (outside of the object)
+   */
+  MemoryUsage memoryUsage() const {
+
+    return UnresolvedBaseWithoutSpin::memoryUsage() +
+           MemoryUsage::of( this->energies_ );
+  }
+
   #include "ENDFtk/section/2/151/UnresolvedEnergyDependentFissionWidths/src/print.hpp"
 };
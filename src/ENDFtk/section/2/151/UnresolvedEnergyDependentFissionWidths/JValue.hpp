@@ -162,5 +162,6 @@ public:
   }
 
   using ListRecord::NC;
+  using ListRecord::memoryUsage;
   using ListRecord::print;
 };
@@ -27,5 +27,6 @@ public:
   using UnresolvedLValueBase< JValue >::NE;
 
   using UnresolvedLValueBase< JValue >::NC;
+  using UnresolvedLValueBase< JValue >::memoryUsage;
   using UnresolvedLValueBase< JValue >::print;
 };
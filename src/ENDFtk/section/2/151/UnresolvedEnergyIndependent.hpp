@@ -64,5 +64,6 @@ public:
   using UnresolvedBase::lValues;
 
   using UnresolvedBase::NC;
+  using UnresolvedBase::memoryUsage;
   using UnresolvedBase::print;
 };
@@ -186,5 +186,6 @@ public:
   auto averageCompetitiveWidths() const { return this->GX(); }
 
   using ListRecord::NC;
+  using ListRecord::memoryUsage;
   using ListRecord::print;
 };
@@ -66,5 +66,14 @@ public:
   unsigned int NE() const { return this->jvalues_.front().NE(); }
 
   #include "ENDFtk/section/2/151/UnresolvedLValueBase/src/NC.hpp"
+
+  /**
+   *  @brief Return the memory owned by the component (outside of the object)
+   */
+  MemoryUsage memoryUsage() const {
+
+    return MemoryUsage::of( this->jvalues_ );
+  }
+
   #include "ENDFtk/section/2/151/UnresolvedLValueBase/src/print.hpp"
 };
@@ -173,6 +173,14 @@ namespace section {
     using BaseWithoutMT::atomicWeightRatio;
     using BaseWithoutMT::AWR;
 
+    /**
+     *  @brief Return the memory owned by the section (outside of the object)
+     */
+    MemoryUsage memoryUsage() const {
+
+      return MemoryUsage::of( this->data_ );
+    }
+
     #include "ENDFtk/section/2/152/src/print.hpp"
     #include "ENDFtk/section/2/152/src/NC.hpp"
   };
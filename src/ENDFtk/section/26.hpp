@@ -122,6 +122,15 @@ namespace section {
     }
 
     #include "ENDFtk/section/26/src/NC.hpp"
+
+    /**
+     *  @brief Return the memory owned by the section (outside of the object)
+     */
+    MemoryUsage memoryUsage() const {
+
+      return MemoryUsage::of( this->products_ );
+    }
+
     #include "ENDFtk/section/26/src/print.hpp"
 
     using Base::MT;
@@ -88,5 +88,14 @@ public:
   long NC() const { return this->data_.NC(); }
 
   // taken from MF6
+
+  /**
+   *  @brief Return the memory owned by the component (outside of the object)
+   */
+  MemoryUsage memoryUsage() const {
+
+    return MemoryUsage::of( this->data_ );
+  }
+
   #include "ENDFtk/section/6/DiscreteTwoBodyScattering/src/print.hpp"
 };
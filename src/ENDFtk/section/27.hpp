@@ -95,6 +95,14 @@ namespace section{
      */
     auto regions() const { return this->table.regions(); }
 
+    /**
+     *  @brief Return the memory owned by the section (outside of the object)
+     */
+    MemoryUsage memoryUsage() const {
+
+      return MemoryUsage::of( this->table );
+    }
+
     #include "ENDFtk/section/3/src/print.hpp" // taken from MF3
 
     using Base::MT;
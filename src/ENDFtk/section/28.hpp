@@ -62,6 +62,15 @@ namespace section{
     }
 
     #include "ENDFtk/section/28/src/NC.hpp"
+
+    /**
+     *  @brief Return the memory owned by the section (outside of the object)
+     */
+    MemoryUsage memoryUsage() const {
+
+      return MemoryUsage::of( this->subshells_ );
+    }
+
     #include "ENDFtk/section/28/src/print.hpp"
 
     using Base::MT;
@@ -120,5 +120,6 @@ public:
   }
 
   using ListRecord::NC;
+  using ListRecord::memoryUsage;
   using ListRecord::print;
 };
@@ -115,6 +115,14 @@ namespace section {
      */
     auto regions() const { return this->table.regions(); }
 
+    /**
+     *  @brief Return the memory owned by the section (outside of the object)
+     */
+    MemoryUsage memoryUsage() const {
+
+      return MemoryUsage::of( this->table );
+    }
+
     #include "ENDFtk/section/3/src/print.hpp"
 
     using Base::MT;
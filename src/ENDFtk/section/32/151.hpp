@@ -2,8 +2,10 @@
 #define NJOY_ENDFTK_SECTION_32_151
 
 // system includes
+#include <array>
 #include <optional>
 #include <variant>
+#include <vector>
 
 // other includes
 #include "range/v3/range/conversion.hpp"
@@ -120,6 +122,14 @@ namespace section {
     using BaseWithoutMT::AWR;
     using BaseWithoutMT::atomicWeightRatio;
 
+    /**
+     *  @brief Return the memory owned by the section (outside of the object)
+     */
+    MemoryUsage memoryUsage() const {
+
+      return MemoryUsage::of( this->isotopes_ );
+    }
+
     #include "ENDFtk/section/32/151/src/print.hpp"
     #include "ENDFtk/section/32/151/src/NC.hpp"
   };
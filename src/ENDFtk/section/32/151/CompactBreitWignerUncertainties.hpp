@@ -181,6 +181,19 @@ public:
                     { return { std::move( chunk ) }; } );
   }
 
+  /**
+   *  @brief Return the resonance parameters and uncertainties as contiguous
+   *         columns
+   *
+   *  The twelve columns are given in the order of the values of a resonance:
+   *  ER, AJ, GT, GN, GG, GF, DER, two unused columns, DGN, DGG and DGF.
+   */
+  std::array< std::vector< double >, 12 > columns() const {
+
+    return ListRecord::columns< 12 >();
+  }
+
   using ListRecord::NC;
+  using ListRecord::memoryUsage;
   using ListRecord::print;
 };
@@ -317,6 +317,22 @@ void verifyChunk( const CompactBreitWignerUncertainties& chunk ) {
   CHECK_THAT( 12., WithinRel( chunk.resonances()[1].fissionWidthUncertainty() ) );
 
   CHECK( 5 == chunk.NC() );
+
+  auto columns = chunk.columns();
+  CHECK( 12 == columns.size() );
+  for ( unsigned int i = 0; i < 2; ++i ) {
+
+    CHECK( chunk.ER()[i] == columns[0][i] );
+    CHECK( chunk.AJ()[i] == columns[1][i] );
+    CHECK( chunk.GT()[i] == columns[2][i] );
+    CHECK( chunk.GN()[i] == columns[3][i] );
+    CHECK( chunk.GG()[i] == columns[4][i] );
+    CHECK( chunk.GF()[i] == columns[5][i] );
+    CHECK( chunk.DER()[i] == columns[6][i] );
+    CHECK( chunk.DGN()[i] == columns[9][i] );
+    CHECK( chunk.DGG()[i] == columns[10][i] );
+    CHECK( chunk.DGF()[i] == columns[11][i] );
+  }
 }
 
 std::string invalidSize() {
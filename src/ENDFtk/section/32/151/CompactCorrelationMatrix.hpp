@@ -74,5 +74,14 @@ public:
   }
 
   #include "ENDFtk/section/32/151/CompactCorrelationMatrix/src/NC.hpp"
+
+  /**
+   *  @brief Return the memory owned by the component (outside of the object)
+   */
+  MemoryUsage memoryUsage() const {
+
+    return MemoryUsage::of( this->i_, this->j_, this->correlations_ );
+  }
+
   #include "ENDFtk/section/32/151/CompactCorrelationMatrix/src/print.hpp"
 };
@@ -143,5 +143,15 @@ public:
   }
 
   #include "ENDFtk/section/32/151/CompactCovarianceBase/src/NC.hpp"
+
+  /**
+   *  @brief Return the memory owned by the component (outside of the object)
+   */
+  MemoryUsage memoryUsage() const {
+
+    return MemoryUsage::of( this->dap_, this->uncertainties_,
+                            this->matrix_ );
+  }
+
   #include "ENDFtk/section/32/151/CompactCovarianceBase/src/print.hpp"
 };
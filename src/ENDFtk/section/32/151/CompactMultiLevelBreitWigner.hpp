@@ -59,5 +59,6 @@ public:
   using CompactCovarianceBase::correlationMatrix;
 
   using CompactCovarianceBase::NC;
+  using CompactCovarianceBase::memoryUsage;
   using CompactCovarianceBase::print;
 };
@@ -78,5 +78,6 @@ public:
   using CompactCovarianceBase::correlationMatrix;
 
   using CompactCovarianceBase::NC;
+  using CompactCovarianceBase::memoryUsage;
   using CompactCovarianceBase::print;
 };
@@ -55,5 +55,14 @@ public:
   }
 
   #include "ENDFtk/section/32/151/CompactRMatrixLimitedUncertainties/src/NC.hpp"
+
+  /**
+   *  @brief Return the memory owned by the component (outside of the object)
+   */
+  MemoryUsage memoryUsage() const {
+
+    return MemoryUsage::of( this->particle_pairs_, this->spin_groups_ );
+  }
+
   #include "ENDFtk/section/32/151/CompactRMatrixLimitedUncertainties/src/print.hpp"
 };
@@ -171,5 +171,6 @@ public:
                                                    { return int( mt ); } ); }
 
   using ListRecord::NC;
+  using ListRecord::memoryUsage;
   using ListRecord::print;
 };
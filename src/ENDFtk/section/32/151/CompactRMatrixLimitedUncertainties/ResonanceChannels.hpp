@@ -130,5 +130,6 @@ public:
   auto effectiveChannelRadii() const { return this->APE(); }
 
   using ListRecord::NC;
+  using ListRecord::memoryUsage;
   using ListRecord::print;
 };
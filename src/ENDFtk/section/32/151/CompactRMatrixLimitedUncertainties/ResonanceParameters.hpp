@@ -111,5 +111,6 @@ public:
   auto resonanceParameterUncertainties() const { return this->DGAM(); }
 
   using ListRecord::NC;
+  using ListRecord::memoryUsage;
   using ListRecord::print;
 };
@@ -78,5 +78,13 @@ public:
    */
   long NC() const { return this->channels_.NC() + this->parameters_.NC(); };
 
+  /**
+   *  @brief Return the memory owned by the component (outside of the object)
+   */
+  MemoryUsage memoryUsage() const {
+
+    return MemoryUsage::of( this->channels_, this->parameters_ );
+  }
+
   #include "ENDFtk/section/32/151/CompactRMatrixLimitedUncertainties/SpinGroup/src/print.hpp"
 };
@@ -68,5 +68,6 @@ public:
   using CompactCovarianceBase::correlationMatrix;
 
   using CompactCovarianceBase::NC;
+  using CompactCovarianceBase::memoryUsage;
   using CompactCovarianceBase::print;
 };
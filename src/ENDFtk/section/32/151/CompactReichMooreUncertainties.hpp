@@ -183,6 +183,20 @@ public:
                     { return { std::move( chunk ) }; } );
   }
 
+  /**
+   *  @brief Return the resonance parameters and uncertainties as contiguous
+   *         columns
+   *
+   *  The twelve columns are given in the order of the values of a resonance:
+   *  ER, AJ, GN, GG, GFA, GFB, DER, an unused column, DGN, DGG, DGFA and
+   *  DGFB.
+   */
+  std::array< std::vector< double >, 12 > columns() const {
+
+    return ListRecord::columns< 12 >();
+  }
+
   using ListRecord::NC;
+  using ListRecord::memoryUsage;
   using ListRecord::print;
 };
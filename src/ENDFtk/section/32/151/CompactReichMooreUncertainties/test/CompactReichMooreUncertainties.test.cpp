@@ -328,6 +328,23 @@ void verifyChunk( const CompactReichMooreUncertainties& chunk ) {
   CHECK_THAT( 16., WithinRel( chunk.resonances()[1].secondFissionWidthUncertainty() ) );
 
   CHECK( 5 == chunk.NC() );
+
+  auto columns = chunk.columns();
+  CHECK( 12 == columns.size() );
+  for ( unsigned int i = 0; i < 2; ++i ) {
+
+    CHECK( chunk.ER()[i] == columns[0][i] );
+    CHECK( chunk.AJ()[i] == columns[1][i] );
+    CHECK( chunk.GN()[i] == columns[2][i] );
+    CHECK( chunk.GG()[i] == columns[3][i] );
+    CHECK( chunk.GFA()[i] == columns[4][i] );
+    CHECK( chunk.GFB()[i] == columns[5][i] );
+    CHECK( chunk.DER()[i] == columns[6][i] );
+    CHECK( chunk.DGN()[i] == columns[8][i] );
+    CHECK( chunk.DGG()[i] == columns[9][i] );
+    CHECK( chunk.DGFA()[i] == columns[10][i] );
+    CHECK( chunk.DGFB()[i] == columns[11][i] );
+  }
 }
 
 std::string invalidSize() {
@@ -58,5 +58,6 @@ public:
   using CompactCovarianceBase::correlationMatrix;
 
   using CompactCovarianceBase::NC;
+  using CompactCovarianceBase::memoryUsage;
   using CompactCovarianceBase::print;
 };
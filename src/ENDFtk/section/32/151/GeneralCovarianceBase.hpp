@@ -179,5 +179,14 @@ public:
   }
 
   #include "ENDFtk/section/32/151/GeneralCovarianceBase/src/NC.hpp"
+
+  /**
+   *  @brief Return the memory owned by the component (outside of the object)
+   */
+  MemoryUsage memoryUsage() const {
+
+    return MemoryUsage::of( this->dap_, this->short_, this->long_ );
+  }
+
   #include "ENDFtk/section/32/151/GeneralCovarianceBase/src/print.hpp"
 };
@@ -65,5 +65,6 @@ public:
   using GeneralCovarianceBase::shortRangeBlocks;
 
   using GeneralCovarianceBase::NC;
+  using GeneralCovarianceBase::memoryUsage;
   using GeneralCovarianceBase::print;
 };
@@ -66,5 +66,6 @@ public:
   using GeneralCovarianceBase::longRangeBlocks;
 
   using GeneralCovarianceBase::NC;
+  using GeneralCovarianceBase::memoryUsage;
   using GeneralCovarianceBase::print;
 };
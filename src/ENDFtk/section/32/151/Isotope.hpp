@@ -70,6 +70,14 @@ public:
     return ranges::cpp20::views::all( this->ranges_ );
   }
 
+  /**
+   *  @brief Return the memory owned by the component (outside of the object)
+   */
+  MemoryUsage memoryUsage() const {
+
+    return MemoryUsage::of( this->ranges_ );
+  }
+
   #include "ENDFtk/section/32/151/Isotope/src/print.hpp"
   #include "ENDFtk/section/32/151/Isotope/src/NC.hpp"
 };
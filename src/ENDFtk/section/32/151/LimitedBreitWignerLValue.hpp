@@ -241,5 +241,6 @@ public:
   }
 
   using ListRecord::NC;
+  using ListRecord::memoryUsage;
   using ListRecord::print;
 };
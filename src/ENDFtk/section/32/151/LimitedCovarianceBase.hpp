@@ -133,5 +133,14 @@ public:
   }
 
   #include "ENDFtk/section/32/151/LimitedCovarianceBase/src/NC.hpp"
+
+  /**
+   *  @brief Return the memory owned by the component (outside of the object)
+   */
+  MemoryUsage memoryUsage() const {
+
+    return MemoryUsage::of( this->dap_, this->lvalues_ );
+  }
+
   #include "ENDFtk/section/32/151/LimitedCovarianceBase/src/print.hpp"
 };
@@ -49,5 +49,6 @@ public:
   using LimitedCovarianceBase::lValues;
 
   using LimitedCovarianceBase::NC;
+  using LimitedCovarianceBase::memoryUsage;
   using LimitedCovarianceBase::print;
 };
@@ -41,5 +41,6 @@ public:
 
 
   using ListRecord::NC;
+  using ListRecord::memoryUsage;
   using ListRecord::print;
 };
@@ -37,5 +37,14 @@ public:
   }
 
   #include "ENDFtk/section/32/151/ScatteringRadiusCovariances/src/NC.hpp"
+
+  /**
+   *  @brief Return the memory owned by the component (outside of the object)
+   */
+  MemoryUsage memoryUsage() const {
+
+    return MemoryUsage::of( this->ni_ );
+  }
+
   #include "ENDFtk/section/32/151/ScatteringRadiusCovariances/src/print.hpp"
 };
@@ -55,5 +55,14 @@ public:
   }
 
   #include "ENDFtk/section/32/151/ShortRangeRMatrixLimitedBlock/src/NC.hpp"
+
+  /**
+   *  @brief Return the memory owned by the component (outside of the object)
+   */
+  MemoryUsage memoryUsage() const {
+
+    return MemoryUsage::of( this->parameters_, this->covariance_ );
+  }
+
   #include "ENDFtk/section/32/151/ShortRangeRMatrixLimitedBlock/src/print.hpp"
 };
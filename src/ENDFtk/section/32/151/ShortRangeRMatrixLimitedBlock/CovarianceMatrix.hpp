@@ -52,5 +52,6 @@ public:
   //! @todo provide convenience interface for the covariance data
 
   using ListRecord::NC;
+  using ListRecord::memoryUsage;
   using ListRecord::print;
 };
@@ -86,5 +86,6 @@ public:
   //! @todo provide convenience interface for the covariance data
 
   using ShortRangeBreitWignerReichMooreBlockBase::NC;
+  using ShortRangeBreitWignerReichMooreBlockBase::memoryUsage;
   using ShortRangeBreitWignerReichMooreBlockBase::print;
 };
@@ -116,5 +116,14 @@ public:
   }
 
   #include "ENDFtk/section/32/151/UnresolvedRelativeCovariances/src/NC.hpp"
+
+  /**
+   *  @brief Return the memory owned by the component (outside of the object)
+   */
+  MemoryUsage memoryUsage() const {
+
+    return MemoryUsage::of( this->lvalues_, this->matrix_ );
+  }
+
   #include "ENDFtk/section/32/151/UnresolvedRelativeCovariances/src/print.hpp"
 };
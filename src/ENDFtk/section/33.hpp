@@ -73,6 +73,15 @@ namespace section{
     }
 
     #include "ENDFtk/section/33/src/NC.hpp"
+
+    /**
+     *  @brief Return the memory owned by the section (outside of the object)
+     */
+    MemoryUsage memoryUsage() const {
+
+      return MemoryUsage::of( this->reactions_ );
+    }
+
     #include "ENDFtk/section/33/src/print.hpp"
 
     using Base::MT;
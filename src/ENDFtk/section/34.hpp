@@ -81,6 +81,15 @@ namespace section{
     }
 
     #include "ENDFtk/section/34/src/NC.hpp"
+
+    /**
+     *  @brief Return the memory owned by the section (outside of the object)
+     */
+    MemoryUsage memoryUsage() const {
+
+      return MemoryUsage::of( this->reactions_ );
+    }
+
     #include "ENDFtk/section/34/src/print.hpp"
 
     using Base::MT;
@@ -74,5 +74,14 @@ public:
   }
 
   #include "ENDFtk/section/34/LegendreBlock/src/NC.hpp"
+
+  /**
+   *  @brief Return the memory owned by the component (outside of the object)
+   */
+  MemoryUsage memoryUsage() const {
+
+    return MemoryUsage::of( this->ni_ );
+  }
+
   #include "ENDFtk/section/34/LegendreBlock/src/print.hpp"
 };
@@ -85,5 +85,14 @@ public:
   }
 
   #include "ENDFtk/section/34/ReactionBlock/src/NC.hpp"
+
+  /**
+   *  @brief Return the memory owned by the component (outside of the object)
+   */
+  MemoryUsage memoryUsage() const {
+
+    return MemoryUsage::of( this->lblocks_ );
+  }
+
   #include "ENDFtk/section/34/ReactionBlock/src/print.hpp"
 };
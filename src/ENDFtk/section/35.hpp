@@ -68,6 +68,15 @@ namespace section{
     }
 
     #include "ENDFtk/section/35/src/NC.hpp"
+
+    /**
+     *  @brief Return the memory owned by the section (outside of the object)
+     */
+    MemoryUsage memoryUsage() const {
+
+      return MemoryUsage::of( this->energyBlocks_ );
+    }
+
     #include "ENDFtk/section/35/src/print.hpp"
 
     using Base::MT;
@@ -200,6 +200,15 @@ namespace section {
     #include "ENDFtk/section/4/src/angularDistributions.hpp"
 
     #include "ENDFtk/section/4/src/NC.hpp"
+
+    /**
+     *  @brief Return the memory owned by the section (outside of the object)
+     */
+    MemoryUsage memoryUsage() const {
+
+      return MemoryUsage::of( this->distributions_ );
+    }
+
     #include "ENDFtk/section/4/src/print.hpp"
 
     using Base::MT;
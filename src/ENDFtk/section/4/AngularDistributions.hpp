@@ -85,5 +85,6 @@ public:
   }
 
   using InterpolationSequenceRecord< Records >::NC;
+  using InterpolationSequenceRecord< Records >::memoryUsage;
   using InterpolationSequenceRecord< Records >::print;
 };
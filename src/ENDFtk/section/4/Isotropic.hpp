@@ -40,6 +40,15 @@ public:
    */
   static constexpr long NC() { return 0; }
 
+  /**
+   *  @brief Return the memory owned by the component (the values are stored
+   *         in the object itself)
+   */
+  MemoryUsage memoryUsage() const {
+
+    return MemoryUsage();
+  }
+
   /**
    *  @brief Print this ENDF component
    */
@@ -56,5 +56,6 @@ public:
   auto coefficients() const { return this->A(); }
 
   using ListRecord::NC;
+  using ListRecord::memoryUsage;
   using ListRecord::print;
 };
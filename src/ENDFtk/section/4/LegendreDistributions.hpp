@@ -47,5 +47,6 @@ public:
   using AngularDistributions< LegendreCoefficients >::angularDistributions;
 
   using AngularDistributions< LegendreCoefficients >::NC;
+  using AngularDistributions< LegendreCoefficients >::memoryUsage;
   using AngularDistributions< LegendreCoefficients >::print;
 };
@@ -115,5 +115,13 @@ public:
   long NC() const { return this->legendre_.NC() +
   	                       this->tabulated_.NC(); }
 
+  /**
+   *  @brief Return the memory owned by the component (outside of the object)
+   */
+  MemoryUsage memoryUsage() const {
+
+    return MemoryUsage::of( this->legendre_, this->tabulated_ );
+  }
+
   #include "ENDFtk/section/4/MixedDistributions/src/print.hpp"
 };
@@ -47,5 +47,6 @@ public:
   using AngularDistributions< TabulatedDistribution >::angularDistributions;
 
   using AngularDistributions< TabulatedDistribution >::NC;
+  using AngularDistributions< TabulatedDistribution >::memoryUsage;
   using AngularDistributions< TabulatedDistribution >::print;
 };
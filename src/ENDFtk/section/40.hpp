@@ -80,6 +80,15 @@ namespace section{
     }
 
     #include "ENDFtk/section/40/src/NC.hpp"
+
+    /**
+     *  @brief Return the memory owned by the section (outside of the object)
+     */
+    MemoryUsage memoryUsage() const {
+
+      return MemoryUsage::of( this->levelBlocks_ );
+    }
+
     #include "ENDFtk/section/40/src/print.hpp"
 
     using Base::MT;
@@ -84,5 +84,14 @@ public:
   }
 
   #include "ENDFtk/section/40/LevelBlock/src/NC.hpp"
+
+  /**
+   *  @brief Return the memory owned by the component (outside of the object)
+   */
+  MemoryUsage memoryUsage() const {
+
+    return MemoryUsage::of( this->reactions_ );
+  }
+
   #include "ENDFtk/section/40/LevelBlock/src/print.hpp"
 };
@@ -89,6 +89,15 @@ namespace section {
     }
   
     #include "ENDFtk/section/5/src/NC.hpp"
+
+    /**
+     *  @brief Return the memory owned by the section (outside of the object)
+     */
+    MemoryUsage memoryUsage() const {
+
+      return MemoryUsage::of( this->partials_ );
+    }
+
     #include "ENDFtk/section/5/src/print.hpp"
   
     using Base::MT;
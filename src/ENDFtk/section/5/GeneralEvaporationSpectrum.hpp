@@ -50,5 +50,14 @@ public:
   const DistributionFunction& distributionFunction() const { return this->g(); }
 
   #include "ENDFtk/section/5/GeneralEvaporationSpectrum/src/NC.hpp"
+
+  /**
+   *  @brief Return the memory owned by the component (outside of the object)
+   */
+  MemoryUsage memoryUsage() const {
+
+    return MemoryUsage::of( this->temperature_, this->distribution_ );
+  }
+
   #include "ENDFtk/section/5/GeneralEvaporationSpectrum/src/print.hpp"
 };
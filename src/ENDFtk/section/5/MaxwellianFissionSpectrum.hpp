@@ -31,5 +31,6 @@ public:
   using EffectiveTemperature::interpolants;
   using EffectiveTemperature::boundaries;
   using EffectiveTemperature::NC;
+  using EffectiveTemperature::memoryUsage;
   using EffectiveTemperature::print;
 };
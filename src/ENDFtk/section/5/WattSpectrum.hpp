@@ -39,5 +39,14 @@ public:
   const Parameter& b() const { return this->parameters_[1]; }
 
   #include "ENDFtk/section/5/WattSpectrum/src/NC.hpp"
+
+  /**
+   *  @brief Return the memory owned by the component (outside of the object)
+   */
+  MemoryUsage memoryUsage() const {
+
+    return MemoryUsage::of( this->parameters_ );
+  }
+
   #include "ENDFtk/section/5/WattSpectrum/src/print.hpp"
 };
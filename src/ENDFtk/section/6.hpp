@@ -166,6 +166,15 @@ namespace section {
     }
 
     #include "ENDFtk/section/6/src/NC.hpp"
+
+    /**
+     *  @brief Return the memory owned by the section (outside of the object)
+     */
+    MemoryUsage memoryUsage() const {
+
+      return MemoryUsage::of( this->products_ );
+    }
+
     #include "ENDFtk/section/6/src/print.hpp"
 
     using Base::MT;
@@ -63,5 +63,6 @@ public:
   auto coefficients() const { return this->A(); }
 
   using ListRecord::NC;
+  using ListRecord::memoryUsage;
   using ListRecord::print;
 };
@@ -114,5 +114,6 @@ public:
   auto interferenceCoefficients() const { return this->A(); }
 
   using ListRecord::NC;
+  using ListRecord::memoryUsage;
   using ListRecord::print;
 };
@@ -113,5 +113,6 @@ protected:
 public:
 
   using ListRecord::NC;
+  using ListRecord::memoryUsage;
   using ListRecord::print;
 };
@@ -46,5 +46,6 @@ public:
   auto parameters() const { return Base::data(); }
 
   using Base::NC;
+  using Base::memoryUsage;
   using Base::print;
 };
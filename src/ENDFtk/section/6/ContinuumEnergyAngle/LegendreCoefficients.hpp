@@ -69,5 +69,6 @@ public:
   auto coefficients() const { return this->A(); }
 
   using Base::NC;
+  using Base::memoryUsage;
   using Base::print;
 };
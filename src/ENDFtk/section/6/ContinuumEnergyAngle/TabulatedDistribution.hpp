@@ -85,5 +85,6 @@ public:
   auto probabilities() const { return this->F(); }
 
   using Base::NC;
+  using Base::memoryUsage;
   using Base::print;
 };
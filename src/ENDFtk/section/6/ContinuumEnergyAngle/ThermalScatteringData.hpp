@@ -106,5 +106,6 @@ public:
   auto cosines() const { return this->MU();  }
 
   using ListRecord::NC;
+  using ListRecord::memoryUsage;
   using ListRecord::print;
 };
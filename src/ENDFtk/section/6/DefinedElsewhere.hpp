@@ -25,5 +25,6 @@ public:
   int LAW() const { return this->law_; }
 
   using NoLawDataGiven::NC;
+  using NoLawDataGiven::memoryUsage;
   using NoLawDataGiven::print;
 };
@@ -17,5 +17,6 @@ public:
   static constexpr int LAW() { return 4; }
 
   using NoLawDataGiven::NC;
+  using NoLawDataGiven::memoryUsage;
   using NoLawDataGiven::print;
 };
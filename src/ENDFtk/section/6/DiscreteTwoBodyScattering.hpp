@@ -93,5 +93,13 @@ public:
    */
   long NC() const { return this->data_.NC(); }
 
+  /**
+   *  @brief Return the memory owned by the component (outside of the object)
+   */
+  MemoryUsage memoryUsage() const {
+
+    return MemoryUsage::of( this->data_ );
+  }
+
   #include "ENDFtk/section/6/DiscreteTwoBodyScattering/src/print.hpp"
 };
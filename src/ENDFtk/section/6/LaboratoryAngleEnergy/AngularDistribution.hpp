@@ -86,5 +86,6 @@ public:
   }
 
   using InterpolationSequenceRecord::NC;
+  using InterpolationSequenceRecord::memoryUsage;
   using InterpolationSequenceRecord::print;
 };
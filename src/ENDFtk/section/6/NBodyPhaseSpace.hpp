@@ -38,5 +38,6 @@ public:
   int numberParticles() const { return this->NPSX(); }
 
   using ControlRecord::NC;
+  using ControlRecord::memoryUsage;
   using ControlRecord::print;
 };
@@ -78,5 +78,13 @@ public:
                                               { return v.NC(); },
                                            this->law_ ); }
 
+  /**
+   *  @brief Return the memory owned by the component (outside of the object)
+   */
+  MemoryUsage memoryUsage() const {
+
+    return MemoryUsage::of( this->multiplicity_, this->law_ );
+  }
+
   #include "ENDFtk/section/6/ReactionProduct/src/print.hpp"
 };
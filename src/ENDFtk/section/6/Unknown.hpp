@@ -16,5 +16,6 @@ public:
   static constexpr int LAW() { return 0; }
 
   using NoLawDataGiven::NC;
+  using NoLawDataGiven::memoryUsage;
   using NoLawDataGiven::print;
 };
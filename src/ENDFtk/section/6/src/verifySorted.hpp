@@ -2,6 +2,11 @@ template < typename Range, typename String >
 static void
 verifySorted( const Range& values, const String& name ){
 
+  if ( not ParseOptions::active().verifySorted ) {
+
+    return;
+  }
+
   auto iter = std::is_sorted_until( values.begin(), values.end() );
   const bool valuesAreSorted = ( iter == values.end() );
 
@@ -79,6 +79,15 @@ namespace section{
     const ScatteringLaw& scatteringLaw() const { return this->law_; }
 
     #include "ENDFtk/section/7/2/src/NC.hpp"
+
+    /**
+     *  @brief Return the memory owned by the section (outside of the object)
+     */
+    MemoryUsage memoryUsage() const {
+
+      return MemoryUsage::of( this->law_ );
+    }
+
     #include "ENDFtk/section/7/2/src/print.hpp"
 
     /**
@@ -160,5 +160,14 @@ public:
   auto thermalScatteringValues() const { return this->S(); }
 
   #include "ENDFtk/section/7/2/CoherentElastic/src/NC.hpp"
+
+  /**
+   *  @brief Return the memory owned by the component (outside of the object)
+   */
+  MemoryUsage memoryUsage() const {
+
+    return MemoryUsage::of( this->principal_, this->temperatures_ );
+  }
+
   #include "ENDFtk/section/7/2/CoherentElastic/src/print.hpp"
 };
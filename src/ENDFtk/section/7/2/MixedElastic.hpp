@@ -39,5 +39,14 @@ public:
   const IncoherentElastic& incoherent() const { return this->incoherent_; }
 
   #include "ENDFtk/section/7/2/MixedElastic/src/NC.hpp"
+
+  /**
+   *  @brief Return the memory owned by the component (outside of the object)
+   */
+  MemoryUsage memoryUsage() const {
+
+    return MemoryUsage::of( this->coherent_, this->incoherent_ );
+  }
+
   #include "ENDFtk/section/7/2/MixedElastic/src/print.hpp"
 };
@@ -130,6 +130,16 @@ namespace section{
     }
 
     #include "ENDFtk/section/7/4/src/NC.hpp"
+
+    /**
+     *  @brief Return the memory owned by the section (outside of the object)
+     */
+    MemoryUsage memoryUsage() const {
+
+      return MemoryUsage::of( this->b_, this->law_, this->principal_,
+                              this->secondary_ );
+    }
+
     #include "ENDFtk/section/7/4/src/print.hpp"
 
     /**
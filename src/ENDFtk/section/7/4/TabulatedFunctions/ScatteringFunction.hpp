@@ -159,5 +159,14 @@ public:
   auto thermalScatteringValues() const { return this->S(); }
 
   #include "ENDFtk/section/7/4/TabulatedFunctions/ScatteringFunction/src/NC.hpp"
+
+  /**
+   *  @brief Return the memory owned by the component (outside of the object)
+   */
+  MemoryUsage memoryUsage() const {
+
+    return MemoryUsage::of( this->alphas_, this->temperatures_ );
+  }
+
   #include "ENDFtk/section/7/4/TabulatedFunctions/ScatteringFunction/src/print.hpp"
 };
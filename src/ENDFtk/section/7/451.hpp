@@ -61,6 +61,15 @@ namespace section{
     }
 
     #include "ENDFtk/section/7/451/src/NC.hpp"
+
+    /**
+     *  @brief Return the memory owned by the section (outside of the object)
+     */
+    MemoryUsage memoryUsage() const {
+
+      return MemoryUsage::of( this->elements_ );
+    }
+
     #include "ENDFtk/section/7/451/src/print.hpp"
 
     /**
@@ -108,5 +108,6 @@ public:
 //  }
 
   using ListRecord::NC;
+  using ListRecord::memoryUsage;
   using ListRecord::print;
 };
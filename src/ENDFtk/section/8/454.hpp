@@ -75,6 +75,15 @@ namespace section {
     auto incidentEnergies() const { return this->E(); }
 
     #include "ENDFtk/section/8/454/src/NC.hpp"
+
+    /**
+     *  @brief Return the memory owned by the section (outside of the object)
+     */
+    MemoryUsage memoryUsage() const {
+
+      return MemoryUsage::of( this->data_ );
+    }
+
     #include "ENDFtk/section/8/454/src/print.hpp"
 
     /**
@@ -147,6 +147,16 @@ namespace section{
     }
 
     #include "ENDFtk/section/8/457/src/NC.hpp"
+
+    /**
+     *  @brief Return the memory owned by the section (outside of the object)
+     */
+    MemoryUsage memoryUsage() const {
+
+      return MemoryUsage::of( this->energies_, this->modes_,
+                              this->spectra_ );
+    }
+
     #include "ENDFtk/section/8/457/src/print.hpp"
 
     /**
@@ -114,5 +114,6 @@ public:
   auto heavyParticleDecayEnergy() const { return this->EHP(); }
 
   using ListRecord::NC;
+  using ListRecord::memoryUsage;
   using ListRecord::print;
 };
@@ -132,5 +132,15 @@ public:
   }
 
   #include "ENDFtk/section/8/457/DecaySpectrum/src/NC.hpp"
+
+  /**
+   *  @brief Return the memory owned by the component (outside of the object)
+   */
+  MemoryUsage memoryUsage() const {
+
+    return MemoryUsage::of( this->data_, this->discrete_,
+                            this->continuous_ );
+  }
+
   #include "ENDFtk/section/8/457/DecaySpectrum/src/print.hpp"
 };
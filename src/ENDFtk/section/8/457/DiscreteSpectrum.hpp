@@ -126,5 +126,6 @@ public:
   auto internalConversionCoefficientLShell() const { return this->RICL(); }
 
   using ListRecord::NC;
+  using ListRecord::memoryUsage;
   using ListRecord::print;
 };
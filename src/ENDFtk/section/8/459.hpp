@@ -80,6 +80,15 @@ namespace section {
 
     // these deliberately references MF8/MT454 since the code is common
     #include "ENDFtk/section/8/454/src/NC.hpp"
+
+    /**
+     *  @brief Return the memory owned by the section (outside of the object)
+     */
+    MemoryUsage memoryUsage() const {
+
+      return MemoryUsage::of( this->data_ );
+    }
+
     #include "ENDFtk/section/8/454/src/print.hpp"
 
     /**
@@ -2,6 +2,8 @@
 #define NJOY_ENDFTK_SECTION_8_FISSIONYIELDDATA
 
 // system includes
+#include <array>
+#include <vector>
 
 // other includes
 #include "ENDFtk/macros.hpp"
@@ -122,6 +124,20 @@ namespace section{
      */
     auto fissionYields() const { return this->Y(); }
 
+    /**
+     *  @brief Return the fission product data as contiguous columns
+     *
+     *  The data is de-interleaved in a single pass into four columns: the
+     *  fission product ZA identifiers, the isomeric states, the fission
+     *  yield values and the fission yield uncertainties. Numerical code
+     *  should prefer these columns over the strided ZAFP(), FPS() and Y()
+     *  views.
+     */
+    std::array< std::vector< double >, 4 > columns() const {
+
+      return ListRecord::columns< 4 >();
+    }
+
     /**
      *  @brief Return the fission products
      */
@@ -136,6 +152,7 @@ namespace section{
     }
 
     using ListRecord::NC;
+    using ListRecord::memoryUsage;
     using ListRecord::print;
   };
 
@@ -170,6 +170,25 @@ void verifyChunk( const FissionYieldData& chunk ) {
   CHECK_THAT( 0, WithinRel( chunk.fissionYields()[2][1] ) );
 
   CHECK( 3 == chunk.NC() );
+
+  auto columns = chunk.columns();
+  CHECK( 4 == columns.size() );
+  for ( unsigned int i = 0; i < 4; ++i ) {
+
+    CHECK( 3 == columns[i].size() );
+  }
+  CHECK_THAT( 23066, WithinRel( columns[0][0] ) );
+  CHECK_THAT( 54135, WithinRel( columns[0][1] ) );
+  CHECK_THAT( 72171, WithinRel( columns[0][2] ) );
+  CHECK_THAT( 0, WithinRel( columns[1][0] ) );
+  CHECK_THAT( 0, WithinRel( columns[1][1] ) );
+  CHECK_THAT( 0, WithinRel( columns[1][2] ) );
+  CHECK_THAT( 2.05032e-19, WithinRel( columns[2][0] ) );
+  CHECK_THAT( 7.851250e-4, WithinRel( columns[2][1] ) );
+  CHECK_THAT( 0, WithinRel( columns[2][2] ) );
+  CHECK_THAT( 1.31220e-19, WithinRel( columns[3][0] ) );
+  CHECK_THAT( 4.710750e-5, WithinRel( columns[3][1] ) );
+  CHECK_THAT( 0, WithinRel( columns[3][2] ) );
 }
 
 std::string invalidChunk() {
@@ -131,6 +131,7 @@ public:
   auto secondArrayFValues() const { return this->FL(); }
 
   using ListRecord::NC;
+  using ListRecord::memoryUsage;
   using ListRecord::print;
 };
 
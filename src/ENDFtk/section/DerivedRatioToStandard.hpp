@@ -147,6 +147,15 @@ class ENDFTK_PYTHON_EXPORT DerivedRatioToStandard {
 
 
   #include "ENDFtk/section/DerivedRatioToStandard/src/NC.hpp"
+
+  /**
+   *  @brief Return the memory owned by the component (outside of the object)
+   */
+  MemoryUsage memoryUsage() const {
+
+    return MemoryUsage::of( this->list_ );
+  }
+
   #include "ENDFtk/section/DerivedRatioToStandard/src/print.hpp"
 
 };
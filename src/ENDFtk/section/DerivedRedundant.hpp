@@ -101,6 +101,15 @@ class ENDFTK_PYTHON_EXPORT DerivedRedundant {
   auto reactions() const { return this->XMTI(); }
 
   #include "ENDFtk/section/DerivedRedundant/src/NC.hpp"
+
+  /**
+   *  @brief Return the memory owned by the component (outside of the object)
+   */
+  MemoryUsage memoryUsage() const {
+
+    return MemoryUsage::of( this->list_ );
+  }
+
   #include "ENDFtk/section/DerivedRedundant/src/print.hpp"
 
 };
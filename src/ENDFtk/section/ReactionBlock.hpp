@@ -127,6 +127,15 @@ public:
   }
 
   #include "ENDFtk/section/ReactionBlock/src/NC.hpp"
+
+  /**
+   *  @brief Return the memory owned by the component (outside of the object)
+   */
+  MemoryUsage memoryUsage() const {
+
+    return MemoryUsage::of( this->nc_, this->ni_ );
+  }
+
   #include "ENDFtk/section/ReactionBlock/src/print.hpp"
 };
 
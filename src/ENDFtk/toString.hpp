@@ -0,0 +1,115 @@
+#ifndef NJOY_ENDFTK_TOSTRING
+#define NJOY_ENDFTK_TOSTRING
+
+// system includes
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <variant>
+
+// other includes
+#include "ENDFtk/section.hpp"
+#include "ENDFtk/file/Type.hpp"
+#include "ENDFtk/Material.hpp"
+
+namespace njoy {
+namespace ENDFtk {
+
+  /**
+   *  @brief Return the number of lines printed for a parsed section (the
+   *         SEND record included)
+   *
+   *  @param[in] section   the parsed section
+   */
+  template< int MF, int... MT >
+  std::size_t printedLines( const section::Type< MF, MT... >& section ) {
+
+    return section.NC() + 1;
+  }
+
+  /**
+   *  @brief Return the number of lines printed for one of the parsed sections
+   *         of a file (the SEND record included)
+   *
+   *  @param[in] section   the parsed section
+   */
+  template< typename... Sections >
+  std::size_t printedLines( const std::variant< Sections... >& section ) {
+
+    return std::visit( [] ( const auto& value )
+                          { return printedLines( value ); },
+                       section );
+  }
+
+  /**
+   *  @brief Return the number of lines printed for a parsed file (the FEND
+   *         record included)
+   *
+   *  @param[in] file   the parsed file
+   */
+  template< int MF >
+  std::size_t printedLines( const file::Type< MF >& file ) {
+
+    // files that are not implemented yet are not printed
+    std::size_t lines = 0;
+    if constexpr ( MF != 30 ) {
+
+      lines += 1;
+      for ( const auto& section : file.sections() ) {
+
+        lines += printedLines( section );
+      }
+    }
+    return lines;
+  }
+
+  /**
+   *  @brief Return the number of lines printed for a parsed material (the
+   *         MEND record included)
+   *
+   *  @param[in] material   the parsed material
+   */
+  inline std::size_t printedLines( const Material& material ) {
+
+    std::size_t lines = 1;
+    for ( const auto& file : material.files() ) {
+
+      lines += std::visit( [] ( const auto& value )
+                              { return printedLines( value ); },
+                           file );
+    }
+    return lines;
+  }
+
+  /**
+   *  @brief Print a parsed component into a string
+   *
+   *  Every ENDF line is 81 characters long (the newline character included),
+   *  so the size of the string follows from the number of lines printed by
+   *  the component. The memory for the string is reserved once using the
+   *  given number of lines, after which the component is printed through a
+   *  std::back_inserter. The number of lines is only used to reserve memory:
+   *  the string contains whatever the component printed, even when it printed
+   *  more or fewer lines than expected (the string then grows or is simply
+   *  shorter than the reserved size).
+   *
+   *  @param[in] lines       the number of lines printed by the component
+   *  @param[in] component   the component to be printed
+   *  @param[in] numbers     the MAT, MF and MT numbers required by the print
+   *                         function of the component
+   */
+  template< typename Component, typename... Numbers >
+  std::string toString( std::size_t lines, const Component& component,
+                        Numbers... numbers ) {
+
+    std::string buffer;
+    buffer.reserve( lines * 81 );
+    auto output = std::back_inserter( buffer );
+    component.print( output, numbers... );
+    return buffer;
+  }
+
+} // ENDFtk namespace
+} // njoy namespace
+
+#endif
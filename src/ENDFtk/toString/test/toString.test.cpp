@@ -0,0 +1,150 @@
+// include Catch2
+#include <catch2/catch_test_macros.hpp>
+
+// what we are testing
+#include "ENDFtk/toString.hpp"
+
+// other includes
+#include "ENDFtk/tree/toMaterial.hpp"
+
+// convenience typedefs
+using namespace njoy::ENDFtk;
+
+std::string chunk();
+std::string chunkMF1();
+std::string chunkMF3();
+std::string chunkMT102();
+
+template< typename Object, typename... Numbers >
+std::string print( const Object& object, Numbers... numbers ) {
+
+  std::string buffer;
+  auto output = std::back_inserter( buffer );
+  object.print( output, numbers... );
+  return buffer;
+}
+
+SCENARIO( "toString" ) {
+
+  GIVEN( "a parsed material" ) {
+
+    std::string string = chunk();
+    auto begin = string.begin();
+    auto end = string.end();
+    long lineNumber = 0;
+
+    StructureDivision division( begin, end, lineNumber );
+    Material material( division, begin, end, lineNumber );
+
+    const auto& mf1 = std::get< file::Type< 1 > >( material.file( 1 ) );
+    const auto& mf3 = std::get< file::Type< 3 > >( material.file( 3 ) );
+    const auto& mt102 = mf3.section( 102 );
+
+    WHEN( "the number of printed lines is requested" ) {
+
+      THEN( "the SEND, FEND and MEND records are included" ) {
+
+        CHECK( 5 == printedLines( mt102 ) );
+        CHECK( 17 == printedLines( mf1.section( 451 ) ) );
+        CHECK( 18 == printedLines( mf1 ) );
+        CHECK( 11 == printedLines( mf3 ) );
+        CHECK( 30 == printedLines( material ) );
+      } // THEN
+    } // WHEN
+
+    WHEN( "the components are printed into a string" ) {
+
+      THEN( "the strings are identical to those printed using an output "
+            "iterator" ) {
+
+        CHECK( print( mt102, 125, 3 ) == toString( 5, mt102, 125, 3 ) );
+        CHECK( print( mf1, 125 ) ==
+               toString( printedLines( mf1 ), mf1, 125 ) );
+        CHECK( print( mf3, 125 ) ==
+               toString( printedLines( mf3 ), mf3, 125 ) );
+        CHECK( print( material ) ==
+               toString( printedLines( material ), material ) );
+
+        CHECK( chunkMT102() == toString( 5, mt102, 125, 3 ) );
+        CHECK( string == toString( printedLines( material ), material ) );
+      } // THEN
+
+      THEN( "the tree components have the same content" ) {
+
+        CHECK( chunkMT102() == tree::toSection( mt102, 125 ).content() );
+        CHECK( chunkMF3() == tree::toFile( mf3, 125 ).content() );
+        CHECK( string == tree::toMaterial( material ).content() );
+      } // THEN
+    } // WHEN
+
+    WHEN( "the number of lines is too small" ) {
+
+      THEN( "the remaining lines are appended" ) {
+
+        CHECK( chunkMT102() == toString( 4, mt102, 125, 3 ) );
+        CHECK( chunkMT102() == toString( 0, mt102, 125, 3 ) );
+        CHECK( string == toString( 1, material ) );
+      } // THEN
+    } // WHEN
+
+    WHEN( "the number of lines is too large" ) {
+
+      THEN( "the string only contains the printed lines" ) {
+
+        CHECK( chunkMT102() == toString( 6, mt102, 125, 3 ) );
+        CHECK( string == toString( 100, material ) );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+} // SCENARIO
+
+std::string chunk() {
+
+  return chunkMF1() + chunkMF3() +
+    "                                                                     0 0  0     \n";
+}
+
+std::string chunkMF1() {
+
+  return
+    " 1.001000+3 9.991673-1          1          2          3          4 125 1451     \n"
+    " 5.000000+0 6.000000+0          7          8          0         12 125 1451     \n"
+    " 1.300000+1 1.400000+1         15          0         17         18 125 1451     \n"
+    " 1.900000+1 0.000000+0         21          0          9          3 125 1451     \n"
+    "  1-H -  1 LANL       EVAL-JUL16 G.M.Hale                          125 1451     \n"
+    "                      DIST-JAN17                       20170124    125 1451     \n"
+    "----ENDF/B-VIII.0     MATERIAL  125                                125 1451     \n"
+    "-----INCIDENT NEUTRON DATA                                         125 1451     \n"
+    "------ENDF-6 FORMAT                                                125 1451     \n"
+    "                                                                   125 1451     \n"
+    " ****************************************************************  125 1451     \n"
+    "                                                                   125 1451     \n"
+    " ****************************************************************  125 1451     \n"
+    "                                1        451         16          5 125 1451     \n"
+    "                                3          1          5          4 125 1451     \n"
+    "                                3        102          5          5 125 1451     \n"
+    "                                                                   125 1  0     \n"
+    "                                                                   125 0  0     \n";
+}
+
+std::string chunkMF3() {
+
+  return
+    " 1.001000+3 9.991673-1          0          0          0          0 125 3  1     \n"
+    " 0.000000+0 0.000000+0          0          0          1          2 125 3  1     \n"
+    "          2          2                                             125 3  1     \n"
+    " 1.000000-5 3.713628+1 2.000000+7 4.827500-1                       125 3  1     \n"
+    "                                                                   125 3  0     \n"
+    + chunkMT102() +
+    "                                                                   125 0  0     \n";
+}
+
+std::string chunkMT102() {
+
+  return
+    " 1.001000+3 9.991673-1          0          0          0          0 125 3102     \n"
+    " 2.224631+6 2.224631+6          0          0          1          3 125 3102     \n"
+    "          3          5                                             125 3102     \n"
+    " 1.000000-5 1.672869+1 1.000000+0 1.672869-2 2.000000+7 2.722858-5 125 3102     \n"
+    "                                                                   125 3  0     \n";
+}
@@ -0,0 +1,120 @@
+#ifndef NJOY_ENDFTK_TREE_DIFFERENCE
+#define NJOY_ENDFTK_TREE_DIFFERENCE
+
+// system includes
+
+// other includes
+
+namespace njoy {
+namespace ENDFtk {
+namespace tree {
+
+  /**
+   *  @class
+   *  @brief A difference between two ENDF trees
+   *
+   *  This class identifies a section (using its MAT, MF and MT numbers) that
+   *  was added, removed or changed when comparing a candidate tree with a
+   *  reference tree.
+   */
+  class Difference {
+
+  public:
+
+    /**
+     *  @brief The type of difference
+     */
+    enum class Status {
+
+      Added,      // the section is only present in the candidate
+      Removed,    // the section is only present in the reference
+      Changed     // the section is present in both but its content differs
+    };
+
+  private:
+
+    /* fields */
+    int mat_;
+    int mf_;
+    int mt_;
+    Status status_;
+
+  public:
+
+    /* constructor */
+
+    /**
+     *  @brief Constructor
+     *
+     *  @param[in] MAT      the MAT number of the section
+     *  @param[in] MF       the MF number of the section
+     *  @param[in] MT       the MT number of the section
+     *  @param[in] status   the type of difference
+     */
+    Difference( int MAT, int MF, int MT, Status status ) :
+      mat_( MAT ), mf_( MF ), mt_( MT ), status_( status ) {}
+
+    /* methods */
+
+    /**
+     *  @brief Return the MAT number of the section
+     */
+    int MAT() const { return this->mat_; }
+
+    /**
+     *  @brief Return the MF number of the section
+     */
+    int MF() const { return this->mf_; }
+
+    /**
+     *  @brief Return the MT number of the section
+     */
+    int MT() const { return this->mt_; }
+
+    /**
+     *  @brief Return the type of difference
+     */
+    Status status() const { return this->status_; }
+
+    /**
+     *  @brief Return whether or not the section was added
+     */
+    bool isAdded() const { return this->status_ == Status::Added; }
+
+    /**
+     *  @brief Return whether or not the section was removed
+     */
+    bool isRemoved() const { return this->status_ == Status::Removed; }
+
+    /**
+     *  @brief Return whether or not the section was changed
+     */
+    bool isChanged() const { return this->status_ == Status::Changed; }
+
+    /**
+     *  @brief Equality operator
+     *
+     *  @param[in] rhs   the difference to compare with
+     */
+    bool operator==( const Difference& rhs ) const {
+
+      return ( this->mat_ == rhs.mat_ ) && ( this->mf_ == rhs.mf_ ) &&
+             ( this->mt_ == rhs.mt_ ) && ( this->status_ == rhs.status_ );
+    }
+
+    /**
+     *  @brief Inequality operator
+     *
+     *  @param[in] rhs   the difference to compare with
+     */
+    bool operator!=( const Difference& rhs ) const {
+
+      return !( *this == rhs );
+    }
+  };
+
+} // tree namespace
+} // ENDFtk namespace
+} // njoy namespace
+
+#endif
@@ -8,6 +8,7 @@
 // other includes
 #include "range/v3/view/subrange.hpp"
 #include "range/v3/view/map.hpp"
+#include "ENDFtk/MemoryUsage.hpp"
 #include "ENDFtk/file/Type.hpp"
 #include "ENDFtk/tree/Section.hpp"
 #include "ENDFtk/tree/toSection.hpp"
@@ -157,22 +158,21 @@ namespace tree {
      */
     std::size_t size() const { return this->sections_.size(); }
 
+    #include "ENDFtk/tree/File/src/forEachChunk.hpp"
+
     /**
      *  @brief Return the file's content
      */
     auto content() const {
 
-      std::string content;
-      for ( const auto& section : this->sections() ) {
-
-        content += section.content();
-      }
+      std::size_t size = 0;
+      this->forEachChunk( [&] ( std::string_view chunk )
+                              { size += chunk.size(); } );
 
-      if ( content.size() ) {
-
-        auto output = std::back_inserter( content );
-        FEND( this->MAT() ).print( output );
-      }
+      std::string content;
+      content.reserve( size );
+      this->forEachChunk( [&] ( std::string_view chunk )
+                              { content += chunk; } );
 
       return content;
     }
@@ -183,6 +183,9 @@ namespace tree {
 
     #include "ENDFtk/tree/File/src/parse.hpp"
 
+    #include "ENDFtk/tree/File/src/memoryUsage.hpp"
+
+    #include "ENDFtk/tree/File/src/normalise.hpp"
     #include "ENDFtk/tree/File/src/clean.hpp"
   };
 
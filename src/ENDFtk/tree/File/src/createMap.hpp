@@ -1,34 +1,35 @@
 template< typename BufferIterator >
 static std::map< int, Section >
 createMap
-( const HEAD& head, BufferIterator begin,
-  BufferIterator& position, const BufferIterator& end, long& lineNumber ){
+( const record::Tail& head, BufferIterator begin,
+  BufferIterator& position, const BufferIterator& end, long& lineNumber,
+  const std::shared_ptr< const MappedFile >& mapping ){
 
   std::map< int, Section > sections;
 
-  // read the first HEAD record (we need a structure division)
+  // scan the first HEAD record again (we only need its MAT, MF and MT)
   --lineNumber;
   position = begin;
-  auto division = StructureDivision( position, end, lineNumber );
+  auto division = record::scan( position, end, lineNumber );
 
   // continue reading sections for the same mf
   auto mf = head.MF();
-  while ( division.isHead() && ( division.tail.MF() == mf ) ) {
+  while ( division.isHead() && ( division.MF() == mf ) ) {
 
     // check for duplicate mt
-    if ( sections.count( division.tail.MT() ) ) {
+    if ( sections.count( division.MT() ) ) {
 
-      Log::error( "Found a duplicate section for MT{}", division.tail.MT() );
+      Log::error( "Found a duplicate section for MT{}", division.MT() );
       Log::info( "Current position: MAT{} MF{} MT{} at line {}",
-                 division.tail.MAT(), division.tail.MF(), division.tail.MT(),
+                 division.MAT(), division.MF(), division.MT(),
                  lineNumber );
       throw std::exception();
     }
 
     // add the section
-    sections.emplace( division.tail.MT(),
-                      Section( asHead( division ),
-                               begin, position, end, lineNumber ) );
+    sections.emplace( division.MT(),
+                      Section( division.tail,
+                               begin, position, end, lineNumber, mapping ) );
 
     // check for end of stream
     if ( position >= end ) {
@@ -39,12 +40,12 @@ createMap
 
     // skip any duplicate SEND records
     begin = position;
-    division = StructureDivision( position, end, lineNumber );
+    division = record::scan( position, end, lineNumber );
 
     while ( division.isSend() ) {
 
       begin = position;
-      division = StructureDivision( position, end, lineNumber );
+      division = record::scan( position, end, lineNumber );
       if ( position >= end ) {
 
         break;
@@ -58,7 +59,7 @@ createMap
     position = begin;
     Log::info( "The FEND record for MF{} appears to be missing", mf );
     Log::info( "Current position: MAT{} MF{} MT{} at line {}",
-               division.tail.MAT(), division.tail.MF(), division.tail.MT(),
+               division.MAT(), division.MF(), division.MT(),
                lineNumber );
   }
 
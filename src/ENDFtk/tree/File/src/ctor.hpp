@@ -11,20 +11,42 @@ File( unsigned int mat, unsigned int mf ) : mat_( mat ), mf_( mf ) {}
  *
  *  This constructor is not to be called directly by a user.
  *
- *  @param[in] head         the first head record of the file
+ *  @param[in] tail         the MAT, MF and MT numbers of the first section
  *  @param[in] begin        the beginning of the buffer
  *  @param[in] position     the current position in the buffer
  *  @param[in] end          the end of the buffer
  *  @param[in] lineNumber   the current line number
+ *  @param[in] mapping      the memory mapped file the buffer belongs to (if any)
  */
 template< typename BufferIterator >
-File( const HEAD& head, BufferIterator begin,
-      BufferIterator& position, const BufferIterator& end, long& lineNumber )
-  try: mat_( head.MAT() ),
-       mf_( head.MF() ),
-       sections_( createMap( head, begin, position, end, lineNumber ) ) {}
+File( const record::Tail& tail, BufferIterator begin,
+      BufferIterator& position, const BufferIterator& end, long& lineNumber,
+      const std::shared_ptr< const MappedFile >& mapping = nullptr )
+  try: mat_( tail.MAT() ),
+       mf_( tail.MF() ),
+       sections_( createMap( tail, begin, position, end, lineNumber,
+                             mapping ) ) {}
   catch ( std::exception& e ) {
 
     Log::info( "Trouble encountered while constructing an ENDF tree file" );
     throw e;
   }
+
+/**
+ *  @brief Constructor (from a buffer)
+ *
+ *  This constructor is not to be called directly by a user.
+ *
+ *  @param[in] head         the first head record of the file
+ *  @param[in] begin        the beginning of the buffer
+ *  @param[in] position     the current position in the buffer
+ *  @param[in] end          the end of the buffer
+ *  @param[in] lineNumber   the current line number
+ *  @param[in] mapping      the memory mapped file the buffer belongs to (if any)
+ */
+template< typename BufferIterator >
+File( const HEAD& head, BufferIterator begin,
+      BufferIterator& position, const BufferIterator& end, long& lineNumber,
+      const std::shared_ptr< const MappedFile >& mapping = nullptr ) :
+  File( record::Tail( head.MAT(), head.MF(), head.MT() ),
+        begin, position, end, lineNumber, mapping ) {}
@@ -0,0 +1,29 @@
+/**
+ *  @brief Call a function for every piece of the file's content
+ *
+ *  The function is called with a std::string_view for the content of every
+ *  section, followed by the FEND record. Concatenating them yields the
+ *  file's content.
+ *
+ *  The string views for the sections refer to their content and remain
+ *  valid as long as the sections are not modified, the string views for
+ *  the structure records are only valid during the call.
+ *
+ *  @param[in] function   the function to be called
+ */
+template< typename Function >
+void forEachChunk( Function&& function ) const {
+
+  for ( const auto& section : this->sections() ) {
+
+    function( section.view() );
+  }
+
+  if ( not this->sections_.empty() ) {
+
+    std::string record;
+    auto output = std::back_inserter( record );
+    FEND( this->MAT() ).print( output );
+    function( std::string_view( record ) );
+  }
+}
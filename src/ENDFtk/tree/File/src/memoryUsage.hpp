@@ -0,0 +1,14 @@
+/**
+ *  @brief Return the memory used by the file and its sections
+ */
+MemoryUsage memoryUsage() const {
+
+  MemoryUsage usage;
+  usage.overhead = sizeof( File );
+  for ( const auto& entry : this->sections_ ) {
+
+    usage.overhead += MemoryUsage::node< int, Section >();
+    usage += entry.second.memoryUsage();
+  }
+  return usage;
+}
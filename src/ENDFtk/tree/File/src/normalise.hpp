@@ -0,0 +1,16 @@
+/**
+ *  @brief Normalise the file
+ *
+ *  This function normalises every section in the file (see
+ *  Section::normalise()).
+ *
+ *  @param[in] renumber   renumber the lines instead of removing the
+ *                        sequence numbers
+ */
+void normalise( bool renumber = false ) {
+
+  for ( auto& section : this->sections() ) {
+
+    section.normalise( renumber );
+  }
+}
@@ -23,3 +23,44 @@ file::Type< MF > parse() const {
   long lineNumber = 1;
   return this->parse<MF>( lineNumber );
 }
+
+/**
+ *  @brief Parse the file using the given parse options
+ *
+ *  @param[in] options      the parse options
+ *  @param[in] lineNumber   the line number to be used in parsing
+ */
+template< int MF >
+file::Type< MF > parse( const ParseOptions& options, long& lineNumber ) const {
+
+  ParseOptions::Scope scope( options );
+  return this->parse<MF>( lineNumber );
+}
+
+/**
+ *  @brief Parse the file using the given parse options
+ *
+ *  @param[in] options   the parse options
+ */
+template< int MF >
+file::Type< MF > parse( const ParseOptions& options ) const {
+
+  long lineNumber = 1;
+  return this->parse<MF>( options, lineNumber );
+}
+
+/**
+ *  @brief Parse the file using the given memory resource for the values of
+ *         the records in the file
+ *
+ *  The memory resource must outlive the parsed file.
+ *
+ *  @param[in] resource   the memory resource
+ */
+template< int MF >
+file::Type< MF > parse( std::pmr::memory_resource& resource ) const {
+
+  ParseOptions options = ParseOptions::active();
+  options.memoryResource = &resource;
+  return this->parse<MF>( options );
+}
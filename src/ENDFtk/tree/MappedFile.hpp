@@ -0,0 +1,111 @@
+#ifndef NJOY_ENDFTK_TREE_MAPPEDFILE
+#define NJOY_ENDFTK_TREE_MAPPEDFILE
+
+// system includes
+#include <cstdint>
+#include <string>
+#include <string_view>
+#if defined( _WIN32 )
+#include <filesystem>
+#include <fstream>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// other includes
+#include "ENDFtk/Log.hpp"
+
+namespace njoy {
+namespace ENDFtk {
+namespace tree {
+
+  /**
+   *  @class
+   *  @brief A read-only memory mapped file
+   *
+   *  This class maps the content of a file into memory so that the ENDF tree
+   *  components can refer to the content of the file without copying it. The
+   *  mapping is released when the object is destroyed, so it is usually
+   *  shared between the sections that refer to it.
+   *
+   *  On platforms without POSIX memory mapping, the content of the file is
+   *  read into memory instead.
+   */
+  class MappedFile {
+
+    /* fields */
+    const char* data_ = nullptr;
+    std::size_t size_ = 0;
+    std::int64_t modified_ = 0;
+#if defined( _WIN32 )
+    std::string buffer_;
+#endif
+
+  public:
+
+    /* constructor */
+    #include "ENDFtk/tree/MappedFile/src/ctor.hpp"
+
+    MappedFile( const MappedFile& ) = delete;
+    MappedFile( MappedFile&& ) = delete;
+    MappedFile& operator=( const MappedFile& ) = delete;
+    MappedFile& operator=( MappedFile&& ) = delete;
+
+    ~MappedFile() {
+
+#if !defined( _WIN32 )
+      if ( this->data_ ) {
+
+        munmap( const_cast< char* >( this->data_ ), this->size_ );
+      }
+#endif
+    }
+
+    /* methods */
+
+    /**
+     *  @brief Return the number of bytes in the mapped file
+     */
+    std::size_t size() const { return this->size_; }
+
+    /**
+     *  @brief Return the last modification time of the mapped file
+     *
+     *  The value is only meant to be compared with the modification time of
+     *  another mapping of the same file (its unit and epoch depend on the
+     *  platform).
+     */
+    std::int64_t modificationTime() const { return this->modified_; }
+
+    /**
+     *  @brief Return a pointer to the first byte of the mapped file
+     */
+    const char* data() const { return this->data_; }
+
+    /**
+     *  @brief Return a begin iterator to the mapped file
+     */
+    const char* begin() const { return this->data_; }
+
+    /**
+     *  @brief Return an end iterator to the mapped file
+     */
+    const char* end() const { return this->data_ + this->size_; }
+
+    /**
+     *  @brief Return the content of the mapped file
+     */
+    std::string_view content() const {
+
+      return std::string_view( this->data_, this->size_ );
+    }
+  };
+
+} // tree namespace
+} // ENDFtk namespace
+} // njoy namespace
+
+#endif
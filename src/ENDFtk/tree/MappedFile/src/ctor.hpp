@@ -0,0 +1,70 @@
+/**
+ *  @brief Constructor
+ *
+ *  @param[in] filename   the name of the file to be mapped
+ */
+MappedFile( const std::string& filename ) {
+
+#if defined( _WIN32 )
+
+  std::ifstream in( filename,
+                    std::ios::in | std::ios::binary | std::ios::ate );
+  if ( not in ) {
+
+    Log::error( "Could not open file \'{}\'", filename );
+    throw std::exception();
+  }
+
+  const auto file_size = in.tellg();
+  in.seekg( 0, std::ios::beg );
+  this->buffer_.resize( file_size / sizeof( char ) );
+  in.read( &( this->buffer_[ 0 ] ), file_size );
+  this->data_ = this->buffer_.data();
+  this->size_ = this->buffer_.size();
+  this->modified_ = std::filesystem::last_write_time( filename )
+                        .time_since_epoch().count();
+
+#else
+
+  int descriptor = open( filename.c_str(), O_RDONLY );
+  if ( descriptor == -1 ) {
+
+    Log::error( "Could not open file \'{}\'", filename );
+    throw std::exception();
+  }
+
+  struct stat status;
+  if ( fstat( descriptor, &status ) == -1 ) {
+
+    close( descriptor );
+    Log::error( "Could not determine the size of file \'{}\'", filename );
+    throw std::exception();
+  }
+
+  // an empty file cannot be mapped, the mapping remains empty in that case
+  this->size_ = status.st_size;
+#if defined( __APPLE__ )
+  this->modified_ = static_cast< std::int64_t >( status.st_mtimespec.tv_sec )
+                    * 1000000000 + status.st_mtimespec.tv_nsec;
+#else
+  this->modified_ = static_cast< std::int64_t >( status.st_mtim.tv_sec )
+                    * 1000000000 + status.st_mtim.tv_nsec;
+#endif
+  if ( this->size_ ) {
+
+    void* address = mmap( nullptr, this->size_, PROT_READ, MAP_PRIVATE,
+                          descriptor, 0 );
+    if ( address == MAP_FAILED ) {
+
+      close( descriptor );
+      Log::error( "Could not map file \'{}\' into memory", filename );
+      throw std::exception();
+    }
+    this->data_ = static_cast< const char* >( address );
+  }
+
+  // the mapping remains valid after the file descriptor is closed
+  close( descriptor );
+
+#endif
+}
@@ -0,0 +1,70 @@
+// include Catch2
+#include <catch2/catch_test_macros.hpp>
+
+// what we are testing
+#include "ENDFtk/tree/MappedFile.hpp"
+
+// other includes
+#include <fstream>
+
+// convenience typedefs
+using namespace njoy::ENDFtk;
+
+SCENARIO( "tree::MappedFile" ) {
+
+  GIVEN( "an existing file" ) {
+
+    std::string content =
+      " 1.001000+3 9.991673-1          0          0          0          0 125 3  1     \n"
+      "                                                                   125 3  0     \n";
+    {
+      std::ofstream out( "mapped.txt", std::ios::out | std::ios::binary );
+      out << content;
+    }
+
+    WHEN( "the file is mapped" ) {
+
+      tree::MappedFile file( "mapped.txt" );
+
+      THEN( "the content can be accessed" ) {
+
+        CHECK( content.size() == file.size() );
+        CHECK( content == file.content() );
+        CHECK( content == std::string( file.begin(), file.end() ) );
+        CHECK( file.data() == file.begin() );
+      } // THEN
+
+      THEN( "mapping the same file again gives the same modification time" ) {
+
+        tree::MappedFile again( "mapped.txt" );
+        CHECK( file.modificationTime() == again.modificationTime() );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+
+  GIVEN( "an empty file" ) {
+
+    {
+      std::ofstream out( "empty.txt", std::ios::out | std::ios::binary );
+    }
+
+    WHEN( "the file is mapped" ) {
+
+      tree::MappedFile file( "empty.txt" );
+
+      THEN( "the mapping is empty" ) {
+
+        CHECK( 0 == file.size() );
+        CHECK( "" == file.content() );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+
+  GIVEN( "a file that does not exist" ) {
+
+    THEN( "an exception is thrown" ) {
+
+      CHECK_THROWS( tree::MappedFile( "does-not-exist.txt" ) );
+    } // THEN
+  } // GIVEN
+} // SCENARIO
@@ -6,10 +6,12 @@
 #include <map>
 
 // other includes
+#include "ENDFtk/MemoryUsage.hpp"
 #include "ENDFtk/tree/Section.hpp"
 #include "ENDFtk/tree/toSection.hpp"
 #include "ENDFtk/tree/File.hpp"
 #include "ENDFtk/tree/toFile.hpp"
+#include "ENDFtk/tree/ParallelParser.hpp"
 
 namespace njoy {
 namespace ENDFtk {
@@ -201,22 +203,21 @@ namespace tree {
      */
     std::size_t size() const { return files_.size(); }
 
+    #include "ENDFtk/tree/Material/src/forEachChunk.hpp"
+
     /**
      *  @brief Return the material's content
      */
     auto content() const {
 
-      std::string content;
-      for ( const auto& file : this->files() ) {
-
-        content += file.content();
-      }
+      std::size_t size = 0;
+      this->forEachChunk( [&] ( std::string_view chunk )
+                              { size += chunk.size(); } );
 
-      if ( content.size() ) {
-
-        auto output = std::back_inserter( content );
-        MEND().print( output );
-      }
+      std::string content;
+      content.reserve( size );
+      this->forEachChunk( [&] ( std::string_view chunk )
+                              { content += chunk; } );
 
       return content;
     }
@@ -226,7 +227,11 @@ namespace tree {
     #include "ENDFtk/tree/Material/src/insert.hpp"
 
     #include "ENDFtk/tree/Material/src/parse.hpp"
+    #include "ENDFtk/tree/Material/src/tryParse.hpp"
+
+    #include "ENDFtk/tree/Material/src/memoryUsage.hpp"
 
+    #include "ENDFtk/tree/Material/src/normalise.hpp"
     #include "ENDFtk/tree/Material/src/clean.hpp"
   };
 
@@ -1,34 +1,35 @@
 template< typename BufferIterator >
 static std::map< int, File >
 createMap
-( const HEAD& head, BufferIterator begin,
-  BufferIterator& position, const BufferIterator& end, long& lineNumber ){
+( const record::Tail& head, BufferIterator begin,
+  BufferIterator& position, const BufferIterator& end, long& lineNumber,
+  const std::shared_ptr< const MappedFile >& mapping ){
 
   std::map< int, File > files;
 
-  // read the first HEAD record (we need a structure division)
+  // scan the first HEAD record again (we only need its MAT, MF and MT)
   --lineNumber;
   position = begin;
-  auto division = StructureDivision( position, end, lineNumber );
+  auto division = record::scan( position, end, lineNumber );
 
   // continue reading sections for the same mf
   auto mat = head.MAT();
-  while ( division.isHead() && ( division.tail.MAT() == mat ) ) {
+  while ( division.isHead() && ( division.MAT() == mat ) ) {
 
     // check for duplicate mf
-    if ( files.count( division.tail.MF() ) ) {
+    if ( files.count( division.MF() ) ) {
 
-      Log::error( "Found a duplicate section for MF{}", division.tail.MF() );
+      Log::error( "Found a duplicate section for MF{}", division.MF() );
       Log::info( "Current position: MAT{} MF{} MT{} at line {}",
-                 division.tail.MAT(), division.tail.MF(), division.tail.MT(),
+                 division.MAT(), division.MF(), division.MT(),
                  lineNumber );
       throw std::exception();
     }
 
     // add the file
-    files.emplace( division.tail.MF(),
-                   File( asHead( division ),
-                         begin, position, end, lineNumber ) );
+    files.emplace( division.MF(),
+                   File( division.tail,
+                         begin, position, end, lineNumber, mapping ) );
 
     // check for end of stream
     if ( position >= end ) {
@@ -39,12 +40,12 @@ createMap
 
     // skip any duplicate FEND records
     begin = position;
-    division = StructureDivision( position, end, lineNumber );
+    division = record::scan( position, end, lineNumber );
 
     while ( division.isFend() ) {
 
       begin = position;
-      division = StructureDivision( position, end, lineNumber );
+      division = record::scan( position, end, lineNumber );
       if ( position >= end ) {
 
         break;
@@ -58,7 +59,7 @@ createMap
     position = begin;
     Log::info( "The MEND record for MAT{} appears to be missing", mat );
     Log::info( "Current position: MAT{} MF{} MT{} at line {}",
-               division.tail.MAT(), division.tail.MF(), division.tail.MT(),
+               division.MAT(), division.MF(), division.MT(),
                lineNumber );
   }
 
@@ -10,20 +10,43 @@ Material( unsigned int mat ) : mat_( mat ) {}
  *
  *  This constructor is not to be called directly by a user.
  *
- *  @param[in] head         the first head record of the material
+ *  @param[in] tail         the MAT, MF and MT numbers of the first section
  *  @param[in] begin        the beginning of the buffer
  *  @param[in] position     the current position in the buffer
  *  @param[in] end          the end of the buffer
  *  @param[in] lineNumber   the current line number
+ *  @param[in] mapping      the memory mapped file the buffer belongs to (if any)
  */
 template< typename BufferIterator >
-Material( const HEAD& head, BufferIterator begin, BufferIterator& position,
-          const BufferIterator& end, long& lineNumber )
-  try : mat_( head.MAT() ),
-        files_( createMap( head, begin, position, end, lineNumber ) ) {}
+Material( const record::Tail& tail, BufferIterator begin,
+          BufferIterator& position, const BufferIterator& end,
+          long& lineNumber,
+          const std::shared_ptr< const MappedFile >& mapping = nullptr )
+  try : mat_( tail.MAT() ),
+        files_( createMap( tail, begin, position, end, lineNumber,
+                           mapping ) ) {}
   catch( std::exception& e ) {
 
     Log::info( "Trouble encountered while constructing a material tree." );
-    Log::info( "Material number (MAT): {}", head.MAT() );
+    Log::info( "Material number (MAT): {}", tail.MAT() );
     throw e;
   }
+
+/**
+ *  @brief Constructor (from a buffer)
+ *
+ *  This constructor is not to be called directly by a user.
+ *
+ *  @param[in] head         the first head record of the material
+ *  @param[in] begin        the beginning of the buffer
+ *  @param[in] position     the current position in the buffer
+ *  @param[in] end          the end of the buffer
+ *  @param[in] lineNumber   the current line number
+ *  @param[in] mapping      the memory mapped file the buffer belongs to (if any)
+ */
+template< typename BufferIterator >
+Material( const HEAD& head, BufferIterator begin, BufferIterator& position,
+          const BufferIterator& end, long& lineNumber,
+          const std::shared_ptr< const MappedFile >& mapping = nullptr ) :
+  Material( record::Tail( head.MAT(), head.MF(), head.MT() ),
+            begin, position, end, lineNumber, mapping ) {}
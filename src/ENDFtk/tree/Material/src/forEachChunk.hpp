@@ -0,0 +1,34 @@
+/**
+ *  @brief Call a function for every piece of the material's content
+ *
+ *  The function is called with a std::string_view for the content of every
+ *  section and for every FEND record, followed by the MEND record.
+ *  Concatenating them yields the material's content.
+ *
+ *  The string views for the sections refer to their content and remain
+ *  valid as long as the sections are not modified, the string views for
+ *  the structure records are only valid during the call.
+ *
+ *  @param[in] function   the function to be called
+ */
+template< typename Function >
+void forEachChunk( Function&& function ) const {
+
+  bool empty = true;
+  for ( const auto& file : this->files() ) {
+
+    file.forEachChunk( [&] ( std::string_view chunk ) {
+
+      empty = false;
+      function( chunk );
+    } );
+  }
+
+  if ( not empty ) {
+
+    std::string record;
+    auto output = std::back_inserter( record );
+    MEND().print( output );
+    function( std::string_view( record ) );
+  }
+}
@@ -0,0 +1,14 @@
+/**
+ *  @brief Return the memory used by the material, its files and sections
+ */
+MemoryUsage memoryUsage() const {
+
+  MemoryUsage usage;
+  usage.overhead = sizeof( Material );
+  for ( const auto& entry : this->files_ ) {
+
+    usage.overhead += MemoryUsage::node< int, File >();
+    usage += entry.second.memoryUsage();
+  }
+  return usage;
+}
@@ -0,0 +1,16 @@
+/**
+ *  @brief Normalise the material
+ *
+ *  This function normalises every section in the material (see
+ *  Section::normalise()).
+ *
+ *  @param[in] renumber   renumber the lines instead of removing the
+ *                        sequence numbers
+ */
+void normalise( bool renumber = false ) {
+
+  for ( auto& file : this->files() ) {
+
+    file.normalise( renumber );
+  }
+}
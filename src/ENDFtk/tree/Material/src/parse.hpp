@@ -21,3 +21,98 @@
   long lineNumber = 1;
   return this->parse( lineNumber );
 }
+
+/**
+ *  @brief Parse the material using the given parse options
+ *
+ *  @param[in] options      the parse options
+ *  @param[in] lineNumber   the line number to be used in parsing
+ */
+::njoy::ENDFtk::Material parse( const ParseOptions& options,
+                                long& lineNumber ) const {
+
+  ParseOptions::Scope scope( options );
+  return this->parse( lineNumber );
+}
+
+/**
+ *  @brief Parse the material using the given parse options
+ *
+ *  @param[in] options   the parse options
+ */
+::njoy::ENDFtk::Material parse( const ParseOptions& options ) const {
+
+  long lineNumber = 1;
+  return this->parse( options, lineNumber );
+}
+
+/**
+ *  @brief Parse the material using the given memory resource for the values
+ *         of the records in the material
+ *
+ *  Using a std::pmr::monotonic_buffer_resource allows parsing the entire
+ *  material into a single arena that is released in one go. The memory
+ *  resource must outlive the parsed material.
+ *
+ *  @param[in] resource   the memory resource
+ */
+::njoy::ENDFtk::Material parse( std::pmr::memory_resource& resource ) const {
+
+  ParseOptions options = ParseOptions::active();
+  options.memoryResource = &resource;
+  return this->parse( options );
+}
+
+/**
+ *  @brief Parse the material using multiple threads
+ *
+ *  The sections of the material are parsed concurrently, the resulting
+ *  material is identical to the one obtained with parse(). When sections
+ *  cannot be parsed, the error for the section with the lowest MF and MT
+ *  number is reported.
+ *
+ *  @param[in] threads   the number of threads to be used (default 0, which
+ *                       uses all available hardware threads)
+ */
+::njoy::ENDFtk::Material parallelParse( unsigned int threads = 0 ) const {
+
+  ParallelParser parser;
+  parser.material( this->MAT() );
+  for ( const auto& file : this->files() ) {
+
+    parser.file( file );
+  }
+
+  return std::move( parser.parse( threads ).front() );
+}
+
+/**
+ *  @brief Parse a selection of files and sections of the material
+ *
+ *  The selection maps MF numbers onto the MT numbers of the sections to be
+ *  parsed (an empty list of MT numbers selects all sections in the file).
+ *  The resulting material only contains the selected files and sections
+ *  that are present in the material. Sections that were not selected are
+ *  never read, so that unsupported files can be present in the material as
+ *  long as they are not selected.
+ *
+ *  @param[in] selection   the MF and MT numbers to be parsed
+ *  @param[in] threads     the number of threads to be used (default 1, 0
+ *                         uses all available hardware threads)
+ */
+::njoy::ENDFtk::Material
+parse( const std::map< int, std::vector< int > >& selection,
+       unsigned int threads = 1 ) const {
+
+  ParallelParser parser;
+  parser.material( this->MAT() );
+  for ( const auto& [ mf, mts ] : selection ) {
+
+    if ( this->hasMF( mf ) ) {
+
+      parser.file( this->MF( mf ), mts );
+    }
+  }
+
+  return std::move( parser.parse( threads ).front() );
+}
@@ -0,0 +1,65 @@
+/**
+ *  @brief Parse the material without throwing an exception
+ *
+ *  The structure of every section is verified before the material is parsed
+ *  (see Section::verify()) so that the most common errors are reported
+ *  without throwing and catching exceptions internally. Any other error is
+ *  detected by the record decoders, which log it and throw an exception as
+ *  they do for parse(): this function catches that exception and returns the
+ *  error for the section and line on which it was detected, with the type of
+ *  the record that failed and the field that could not be read (when these
+ *  are known). Callers that do not want these log messages can create a
+ *  LogSilencer.
+ */
+ParseResult< ::njoy::ENDFtk::Material > tryParse() const {
+
+  for ( const auto& file : this->files() ) {
+
+    for ( const auto& section : file.sections() ) {
+
+      if ( auto error = section.verify() ) {
+
+        return std::move( *error );
+      }
+    }
+  }
+
+  long lineNumber = 1;
+  ParseError::Context context;
+  try {
+
+    return this->parse( lineNumber );
+  }
+  catch ( ... ) {
+
+    // find the section containing the line (a section has NC lines and a
+    // SEND record)
+    long offset = 0;
+    for ( const auto& file : this->files() ) {
+
+      for ( const auto& section : file.sections() ) {
+
+        if ( lineNumber <= offset + section.NC() + 1 ) {
+
+          const long line = lineNumber - offset;
+          return ParseError{ this->MAT(), file.MF(), section.MT(), line,
+                             context.record(),
+                             context.field().empty()
+                               ? section.invalidField( line ) : context.field(),
+                             "The section could not be parsed" };
+        }
+        offset += section.NC() + 1;
+      }
+
+      if ( lineNumber == ++offset ) {
+
+        return ParseError{ this->MAT(), file.MF(), 0, 1, context.record(),
+                           context.field(),
+                           "The FEND record could not be parsed" };
+      }
+    }
+
+    return ParseError{ this->MAT(), 0, 0, 1, context.record(),
+                       context.field(), "The material could not be parsed" };
+  }
+}
@@ -6,6 +6,8 @@
 #include "ENDFtk/tree/Material.hpp"
 
 // other includes
+#include <memory_resource>
+#include "ENDFtk/ParseOptions.hpp"
 
 // convenience typedefs
 using namespace njoy::ENDFtk;
@@ -389,6 +391,29 @@ SCENARIO( "tree::Material" ) {
     HeadRecord head( position, end, lineNumber );
     tree::Material material( head, start, position, end, lineNumber );
 
+    WHEN( "sections are parsed using multiple threads" ) {
+
+      std::pmr::monotonic_buffer_resource resource;
+      PrecisionReport report;
+      ParseOptions options;
+      options.memoryResource = &resource;
+      options.singlePrecision = true;
+      options.precisionReport = &report;
+
+      ParseOptions::Scope scope( options );
+      auto parsed = material.parse( { { 3, {} } }, 2 );
+
+      THEN( "the parse options of the calling thread are used" ) {
+
+        auto mf3 = std::get< file::Type< 3 > >( parsed.file( 3 ) );
+        CHECK( 2 == mf3.MTs().size() );
+        CHECK( 2 == mf3.section( 1 ).energies().size() );
+        CHECK( 2e+7 == mf3.section( 5 ).energies()[1] );
+        CHECK( 8 == report.values );
+        CHECK( 0 == report.inexact );
+      } // THEN
+    } // WHEN
+
     WHEN( "a section is inserted, replaced or removed" ) {
 
       material.insert( tree::Section( 125, 3, 102, chunkSectionMF3() + validSEND() ) );
@@ -0,0 +1,90 @@
+#ifndef NJOY_ENDFTK_TREE_MATERIALSTREAM
+#define NJOY_ENDFTK_TREE_MATERIALSTREAM
+
+// system includes
+#include <cstddef>
+#include <istream>
+#include <iterator>
+#include <optional>
+#include <string>
+
+// other includes
+#include "ENDFtk/Log.hpp"
+#include "ENDFtk/record.hpp"
+#include "ENDFtk/TapeIdentification.hpp"
+#include "ENDFtk/tree/Material.hpp"
+
+namespace njoy {
+namespace ENDFtk {
+namespace tree {
+
+  /**
+   *  @class
+   *  @brief A stream of ENDF tree materials read from an input stream
+   *
+   *  This class reads an ENDF tape from an input stream one material at a
+   *  time, so that tapes that are too large to be kept in memory can still be
+   *  processed. Only the lines of the current material are kept in memory:
+   *  every material that is read replaces the previous one. A material can
+   *  be parsed using its parse() function.
+   *
+   *  The materials can be read using the next() function or by iterating
+   *  over the stream (which is a single pass input range).
+   */
+  class MaterialStream {
+
+    /* fields */
+    std::istream* in_;
+    std::optional< TapeIdentification > tpid_;
+    std::string buffer_;
+    std::string line_;
+    long lineNumber_ = 0;
+    bool done_ = false;
+
+    /* auxiliary functions */
+    #include "ENDFtk/tree/MaterialStream/src/readLine.hpp"
+
+  public:
+
+    /* type aliases */
+    #include "ENDFtk/tree/MaterialStream/src/Iterator.hpp"
+
+    /* constructor */
+    #include "ENDFtk/tree/MaterialStream/src/ctor.hpp"
+
+    MaterialStream( const MaterialStream& ) = delete;
+    MaterialStream& operator=( const MaterialStream& ) = delete;
+
+    /* methods */
+
+    /**
+     *  @brief Return the tape identification (the first line in the stream)
+     */
+    const TapeIdentification& TPID() const { return *( this->tpid_ ); }
+
+    /**
+     *  @brief Return the current line number in the stream
+     */
+    long lineNumber() const { return this->lineNumber_; }
+
+    #include "ENDFtk/tree/MaterialStream/src/next.hpp"
+
+    /**
+     *  @brief Return a begin iterator to the materials in the stream
+     *
+     *  The stream can only be iterated over once: incrementing the iterator
+     *  reads the next material from the stream.
+     */
+    Iterator begin() { return Iterator( *this ); }
+
+    /**
+     *  @brief Return an end iterator to the materials in the stream
+     */
+    Iterator end() { return Iterator(); }
+  };
+
+} // tree namespace
+} // ENDFtk namespace
+} // njoy namespace
+
+#endif
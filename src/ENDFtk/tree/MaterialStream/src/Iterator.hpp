@@ -0,0 +1,64 @@
+/**
+ *  @class
+ *  @brief An input iterator over the materials in a stream
+ */
+class Iterator {
+
+  /* fields */
+  MaterialStream* stream_ = nullptr;
+  std::optional< Material > current_;
+
+public:
+
+  using iterator_category = std::input_iterator_tag;
+  using value_type = Material;
+  using difference_type = std::ptrdiff_t;
+  using pointer = Material*;
+  using reference = Material&;
+
+  /**
+   *  @brief Default constructor (the end iterator)
+   */
+  Iterator() = default;
+
+  /**
+   *  @brief Constructor
+   *
+   *  The first material is read from the stream upon construction.
+   *
+   *  @param[in] stream   the material stream
+   */
+  Iterator( MaterialStream& stream ) :
+    stream_( &stream ), current_( stream.next() ) {
+
+    if ( not this->current_ ) {
+
+      this->stream_ = nullptr;
+    }
+  }
+
+  reference operator*() { return *this->current_; }
+  pointer operator->() { return &*this->current_; }
+
+  Iterator& operator++() {
+
+    this->current_ = this->stream_->next();
+    if ( not this->current_ ) {
+
+      this->stream_ = nullptr;
+    }
+    return *this;
+  }
+
+  void operator++( int ) { ++*this; }
+
+  bool operator==( const Iterator& right ) const {
+
+    return this->stream_ == right.stream_;
+  }
+
+  bool operator!=( const Iterator& right ) const {
+
+    return not ( *this == right );
+  }
+};
@@ -0,0 +1,32 @@
+/**
+ *  @brief Constructor
+ *
+ *  The tape identification is read from the stream upon construction. The
+ *  stream must remain valid for as long as materials are read from it.
+ *
+ *  @param[in] in   the input stream
+ */
+MaterialStream( std::istream& in ) : in_( &in ) {
+
+  if ( not this->readLine() ) {
+
+    Log::error( "Encountered the end of the stream before the tape "
+                "identification" );
+    throw std::exception();
+  }
+
+  try {
+
+    this->line_ += '\n';
+    auto position = this->line_.cbegin();
+    auto end = this->line_.cend();
+    long lineNumber = 0;
+    this->tpid_ = TapeIdentification( position, end, lineNumber );
+  }
+  catch ( std::exception& e ) {
+
+    Log::info( "Trouble encountered while reading the tape identification "
+               "from a stream" );
+    throw e;
+  }
+}
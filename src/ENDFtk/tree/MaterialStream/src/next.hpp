@@ -0,0 +1,82 @@
+/**
+ *  @brief Read the next material from the stream
+ *
+ *  No value is returned when the TEND record was reached. An exception is
+ *  thrown when the stream ends before the TEND record or when the material
+ *  cannot be indexed.
+ */
+std::optional< Material > next() {
+
+  if ( this->done_ ) {
+
+    return std::nullopt;
+  }
+
+  this->buffer_.clear();
+  std::optional< record::Tail > head;
+  long start = this->lineNumber_;
+
+  while ( this->readLine() ) {
+
+    auto division = record::readDivision( this->line_.cbegin(),
+                                         this->line_.cend() );
+    if ( not division ) {
+
+      Log::error( "Encountered an illegal structure record" );
+      Log::info( "Error while reading line {}: \"{}\"",
+                 this->lineNumber_ - 1, this->line_ );
+      throw std::exception();
+    }
+
+    if ( not head ) {
+
+      // the end of the tape
+      if ( division->isTend() ) {
+
+        this->done_ = true;
+        return std::nullopt;
+      }
+
+      // skip any duplicate MEND records
+      if ( division->isMend() ) {
+
+        continue;
+      }
+
+      head = division->tail;
+      start = this->lineNumber_ - 1;
+    }
+
+    this->buffer_ += this->line_;
+    this->buffer_ += '\n';
+
+    // the material ends with its MEND record
+    if ( division->isMend() ) {
+
+      break;
+    }
+  }
+
+  if ( not head ) {
+
+    this->done_ = true;
+    Log::error( "Did not find a valid TEND record in the stream" );
+    throw std::exception();
+  }
+
+  try {
+
+    auto begin = this->buffer_.cbegin();
+    auto position = begin;
+    auto end = this->buffer_.cend();
+    long lineNumber = start;
+    record::scan( position, end, lineNumber );
+    return Material( *head, begin, position, end, lineNumber );
+  }
+  catch ( std::exception& e ) {
+
+    this->done_ = true;
+    Log::info( "Trouble encountered while reading a material from a stream" );
+    throw e;
+  }
+}
@@ -0,0 +1,22 @@
+/**
+ *  @brief Read the next line from the stream (without its end of line)
+ *
+ *  The function returns false when there are no more lines in the stream.
+ */
+bool readLine() {
+
+  if ( std::getline( *this->in_, this->line_ ) ) {
+
+    ++this->lineNumber_;
+    return true;
+  }
+
+  if ( this->in_->bad() ) {
+
+    Log::error( "Encountered an error while reading from the stream" );
+    Log::info( "Error after line {}", this->lineNumber_ );
+    throw std::exception();
+  }
+
+  return false;
+}
@@ -0,0 +1,146 @@
+// include Catch2
+#include <catch2/catch_test_macros.hpp>
+
+// what we are testing
+#include "ENDFtk/tree/MaterialStream.hpp"
+
+// other includes
+#include <sstream>
+#include <vector>
+
+// convenience typedefs
+using namespace njoy::ENDFtk;
+
+std::string chunkTPID();
+std::string chunkMaterial125();
+std::string chunkMaterial128();
+std::string validTEND();
+
+SCENARIO( "tree::MaterialStream" ) {
+
+  GIVEN( "a stream with multiple materials" ) {
+
+    std::istringstream in( chunkTPID() + chunkMaterial125() +
+                           chunkMaterial128() + chunkMaterial125() +
+                           validTEND() );
+
+    WHEN( "the materials are read one at a time" ) {
+
+      tree::MaterialStream stream( in );
+
+      THEN( "the materials are returned in the order of the stream" ) {
+
+        CHECK( "this is my tape identification                                    "
+               == stream.TPID().text() );
+
+        auto material = stream.next();
+        CHECK( material );
+        CHECK( 125 == material->MAT() );
+        CHECK( true == material->hasMF( 1 ) );
+        CHECK( true == material->hasMF( 3 ) );
+        CHECK( chunkMaterial125() == material->content() );
+
+        material = stream.next();
+        CHECK( material );
+        CHECK( 128 == material->MAT() );
+        CHECK( chunkMaterial128() == material->content() );
+
+        material = stream.next();
+        CHECK( material );
+        CHECK( 125 == material->MAT() );
+        CHECK( chunkMaterial125() == material->content() );
+
+        CHECK( not stream.next() );
+        CHECK( not stream.next() );
+      } // THEN
+    } // WHEN
+
+    WHEN( "the stream is iterated over" ) {
+
+      tree::MaterialStream stream( in );
+
+      std::vector< int > numbers;
+      for ( auto& material : stream ) {
+
+        numbers.push_back( material.MAT() );
+      }
+
+      THEN( "every material is visited once" ) {
+
+        CHECK( std::vector< int >{ 125, 128, 125 } == numbers );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+
+  GIVEN( "invalid data for a tree::MaterialStream" ) {
+
+    WHEN( "the stream is empty" ) {
+
+      std::istringstream in( "" );
+
+      THEN( "an exception is thrown" ) {
+
+        CHECK_THROWS( tree::MaterialStream( in ) );
+      } // THEN
+    } // WHEN
+
+    WHEN( "the stream does not have a TEND record" ) {
+
+      std::istringstream in( chunkTPID() + chunkMaterial125() );
+      tree::MaterialStream stream( in );
+
+      THEN( "an exception is thrown after the last material" ) {
+
+        CHECK( stream.next() );
+        CHECK_THROWS( stream.next() );
+      } // THEN
+    } // WHEN
+
+    WHEN( "a material does not have a MEND record" ) {
+
+      std::string material = chunkMaterial125();
+      material.erase( material.size() - 81 );
+      std::istringstream in( chunkTPID() + material );
+      tree::MaterialStream stream( in );
+
+      THEN( "an exception is thrown" ) {
+
+        CHECK_THROWS( stream.next() );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+} // SCENARIO
+
+std::string chunkTPID() {
+
+  return
+    "this is my tape identification                                       0 0  0     \n";
+}
+
+std::string chunkMaterial125() {
+
+  return
+    " 1.001000+3 9.991673-1          0          0          0          1 125 1451     \n"
+    "                                3          1          1          0 125 1451     \n"
+    "                                                                   125 1  0     \n"
+    "                                                                   125 0  0     \n"
+    " 1.001000+3 9.991673-1          0          0          0          0 125 3  1     \n"
+    "                                                                   125 3  0     \n"
+    "                                                                   125 0  0     \n"
+    "                                                                     0 0  0     \n";
+}
+
+std::string chunkMaterial128() {
+
+  return
+    " 1.002000+3 1.996800+0          0          0          0          0 128 3  1     \n"
+    "                                                                   128 3  0     \n"
+    "                                                                   128 0  0     \n"
+    "                                                                     0 0  0     \n";
+}
+
+std::string validTEND() {
+
+  return
+    "                                                                    -1 0  0     \n";
+}
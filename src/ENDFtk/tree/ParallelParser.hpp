@@ -0,0 +1,99 @@
+#ifndef NJOY_ENDFTK_TREE_PARALLELPARSER
+#define NJOY_ENDFTK_TREE_PARALLELPARSER
+
+// system includes
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <map>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <optional>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+// other includes
+#include "ENDFtk/Log.hpp"
+#include "ENDFtk/Material.hpp"
+#include "ENDFtk/LogSilencer.hpp"
+#include "ENDFtk/ParseOptions.hpp"
+#include "ENDFtk/tree/File.hpp"
+#include "ENDFtk/tree/parallelFor.hpp"
+
+namespace njoy {
+namespace ENDFtk {
+namespace tree {
+
+  /**
+   *  @class
+   *  @brief Parse the sections of one or more materials concurrently
+   *
+   *  The sections of the files that are added to the parser are parsed
+   *  independently of each other using a pool of threads, after which the
+   *  parsed files and materials are assembled in the same way they would be
+   *  when parsing them one section at a time.
+   *
+   *  When one or more sections cannot be parsed, the exception for the
+   *  section with the lowest MAT, MF and MT number (in the order the files
+   *  were added) is rethrown. Log messages are switched off while the
+   *  sections are parsed concurrently, so only the error for that section is
+   *  logged (it is parsed once more to do so).
+   *
+   *  The sections are parsed using the parse options of the calling thread.
+   *  When a memory resource is set in these options, the threads allocate
+   *  from it one at a time (the resource does not need to be thread safe).
+   *  When a precision report is set, the reports of the individual sections
+   *  are added to it once all sections were parsed successfully.
+   *
+   *  This class is used by tree::Material and tree::Tape and is not to be
+   *  used directly by a user.
+   */
+  class ParallelParser {
+
+    using FileVariant = ::njoy::ENDFtk::Material::FileVariant;
+
+    /**
+     *  @brief A section to be parsed
+     */
+    struct Task {
+
+      const Section* section;
+      std::function< void() > parse;
+    };
+
+    /* fields */
+    std::vector< Task > tasks_;
+    std::vector< std::pair< int, std::vector< std::function< FileVariant() > > > >
+    materials_;
+
+    /* auxiliary functions */
+    #include "ENDFtk/tree/ParallelParser/src/synchronised.hpp"
+    #include "ENDFtk/tree/ParallelParser/src/add.hpp"
+
+  public:
+
+    /* methods */
+
+    /**
+     *  @brief Start a new material
+     *
+     *  @param[in] mat   the MAT number of the material
+     */
+    void material( int mat ) {
+
+      this->materials_.emplace_back(
+          mat, std::vector< std::function< FileVariant() > >{} );
+    }
+
+    #include "ENDFtk/tree/ParallelParser/src/file.hpp"
+    #include "ENDFtk/tree/ParallelParser/src/parse.hpp"
+  };
+
+} // tree namespace
+} // ENDFtk namespace
+} // njoy namespace
+
+#endif
@@ -0,0 +1,50 @@
+/**
+ *  @brief Add the sections of a file to the current material
+ *
+ *  Every section is parsed by a separate task into its own slot, the file is
+ *  assembled from these slots once all tasks are done.
+ *
+ *  @param[in] sections   the sections of the file to be added
+ */
+template< int MF >
+void add( const std::vector< const Section* >& sections ) {
+
+  using FileType = file::Type< MF >;
+  using Iterator = std::string_view::const_iterator;
+  using SectionType =
+      decltype( FileType::parseSection( std::declval< Iterator& >(),
+                                        std::declval< const Iterator& >(),
+                                        std::declval< long& >() ) );
+
+  auto parsed =
+      std::make_shared< std::vector< std::optional< SectionType > > >(
+          sections.size() );
+
+  std::size_t index = 0;
+  for ( const auto section : sections ) {
+
+    this->tasks_.push_back(
+        { section,
+          [section, parsed, index] () {
+
+            auto content = section->view();
+            auto begin = content.begin();
+            auto end = content.end();
+            long lineNumber = 1;
+            ( *parsed )[ index ].emplace(
+                FileType::parseSection( begin, end, lineNumber ) );
+          } } );
+    ++index;
+  }
+
+  this->materials_.back().second.push_back( [parsed] () -> FileVariant {
+
+    std::vector< SectionType > sections;
+    sections.reserve( parsed->size() );
+    for ( auto& section : *parsed ) {
+
+      sections.push_back( std::move( *section ) );
+    }
+    return FileType( std::move( sections ) );
+  } );
+}
@@ -0,0 +1,69 @@
+/**
+ *  @brief Add the sections of a file to the current material
+ *
+ *  When MT numbers are given, only those sections of the file are added
+ *  (sections that are not present in the file are ignored). The other
+ *  sections are never read. Nothing is added when none of the requested
+ *  sections are present.
+ *
+ *  @param[in] file   the file to be added
+ *  @param[in] mts    the MT numbers of the sections to be added (all sections
+ *                    are added when this is empty)
+ */
+void file( const File& file, const std::vector< int >& mts = {} ) {
+
+  std::vector< const Section* > sections;
+  for ( const auto& section : file.sections() ) {
+
+    if ( mts.empty() ||
+         std::find( mts.begin(), mts.end(), section.MT() ) != mts.end() ) {
+
+      sections.push_back( &section );
+    }
+  }
+
+  if ( sections.empty() && not mts.empty() ) {
+
+    return;
+  }
+
+  switch ( file.MF() ) {
+
+    case  1 : { this->add<  1 >( sections ); break; }
+    case  2 : { this->add<  2 >( sections ); break; }
+    case  3 : { this->add<  3 >( sections ); break; }
+    case  4 : { this->add<  4 >( sections ); break; }
+    case  5 : { this->add<  5 >( sections ); break; }
+    case  6 : { this->add<  6 >( sections ); break; }
+    case  7 : { this->add<  7 >( sections ); break; }
+    case  8 : { this->add<  8 >( sections ); break; }
+    case  9 : { this->add<  9 >( sections ); break; }
+    case 10 : { this->add< 10 >( sections ); break; }
+    case 12 : { this->add< 12 >( sections ); break; }
+    case 13 : { this->add< 13 >( sections ); break; }
+    case 14 : { this->add< 14 >( sections ); break; }
+    case 15 : { this->add< 15 >( sections ); break; }
+    case 23 : { this->add< 23 >( sections ); break; }
+    case 26 : { this->add< 26 >( sections ); break; }
+    case 27 : { this->add< 27 >( sections ); break; }
+    case 28 : { this->add< 28 >( sections ); break; }
+    case 30 : {
+
+      Log::info( "Found unsupported file MF30 - skipping file" );
+      this->materials_.back().second.push_back(
+          [] () -> FileVariant { return file::Type< 30 >(); } );
+      break;
+    }
+    case 31 : { this->add< 31 >( sections ); break; }
+    case 32 : { this->add< 32 >( sections ); break; }
+    case 33 : { this->add< 33 >( sections ); break; }
+    case 34 : { this->add< 34 >( sections ); break; }
+    case 35 : { this->add< 35 >( sections ); break; }
+    case 40 : { this->add< 40 >( sections ); break; }
+    default : {
+
+      Log::error( "Found unsupported file MF{} - skipping file", file.MF() );
+      throw std::exception();
+    }
+  }
+}
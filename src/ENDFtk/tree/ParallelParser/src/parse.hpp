@@ -0,0 +1,90 @@
+/**
+ *  @brief Parse the sections and return the parsed materials
+ *
+ *  @param[in] threads   the number of threads to be used (0 uses all
+ *                       available hardware threads)
+ */
+std::vector< ::njoy::ENDFtk::Material > parse( unsigned int threads ) {
+
+  const std::size_t size = this->tasks_.size();
+  std::vector< std::exception_ptr > errors( size );
+  std::atomic< std::size_t > failure( size );
+
+  // the worker threads use the parse options of the calling thread: calls
+  // to the memory resource are serialised and every section gets its own
+  // precision report, these are added to the caller's report afterwards
+  const ParseOptions caller = ParseOptions::active();
+  ParseOptions options = caller;
+  if ( options.memoryResource ) {
+
+    options.memoryResource = synchronised( options.memoryResource );
+  }
+  std::vector< PrecisionReport > reports( caller.precisionReport ? size : 0 );
+
+  // sections after a failed section do not need to be parsed and log
+  // messages are switched off in every thread so that only the first error
+  // gets reported
+  {
+    LogSilencer silencer;
+    parallelFor( size, threads, [&] ( std::size_t index ) {
+
+      if ( index > failure ) {
+
+        return;
+      }
+
+      LogSilencer worker;
+      try {
+
+        ParseOptions local = options;
+        local.precisionReport = reports.empty() ? nullptr : &reports[ index ];
+        ParseOptions::Scope scope( local );
+        this->tasks_[ index ].parse();
+      }
+      catch ( ... ) {
+
+        errors[ index ] = std::current_exception();
+        auto current = failure.load();
+        while ( ( index < current ) &&
+                not failure.compare_exchange_weak( current, index ) ) {}
+      }
+    } );
+  }
+
+  // the first section that failed is parsed again to log its error
+  if ( failure < size ) {
+
+    const auto& section = *this->tasks_[ failure ].section;
+    try {
+
+      ParseOptions again = options;
+      again.precisionReport = nullptr;
+      ParseOptions::Scope scope( again );
+      this->tasks_[ failure ].parse();
+    }
+    catch ( ... ) {}
+    Log::info( "Error while parsing section MAT{} MF{} MT{}",
+               section.MAT(), section.MF(), section.MT() );
+    std::rethrow_exception( errors[ failure ] );
+  }
+
+  for ( const auto& report : reports ) {
+
+    caller.precisionReport->add( report );
+  }
+
+  std::vector< ::njoy::ENDFtk::Material > materials;
+  materials.reserve( this->materials_.size() );
+  for ( const auto& [ mat, assemblers ] : this->materials_ ) {
+
+    std::vector< FileVariant > files;
+    files.reserve( assemblers.size() );
+    for ( const auto& assemble : assemblers ) {
+
+      files.push_back( assemble() );
+    }
+    materials.emplace_back( mat, std::move( files ) );
+  }
+
+  return materials;
+}
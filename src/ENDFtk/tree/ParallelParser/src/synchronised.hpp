@@ -0,0 +1,62 @@
+/**
+ *  @class
+ *  @brief A memory resource that serialises the calls to another resource
+ */
+class SynchronisedResource : public std::pmr::memory_resource {
+
+  std::pmr::memory_resource* upstream_;
+  std::mutex mutex_;
+
+  void* do_allocate( std::size_t bytes, std::size_t alignment ) override {
+
+    std::lock_guard< std::mutex > lock( this->mutex_ );
+    return this->upstream_->allocate( bytes, alignment );
+  }
+
+  void do_deallocate( void* pointer, std::size_t bytes,
+                      std::size_t alignment ) override {
+
+    std::lock_guard< std::mutex > lock( this->mutex_ );
+    this->upstream_->deallocate( pointer, bytes, alignment );
+  }
+
+  bool do_is_equal( const std::pmr::memory_resource& other )
+  const noexcept override {
+
+    return this == &other;
+  }
+
+public:
+
+  SynchronisedResource( std::pmr::memory_resource* upstream ) :
+    upstream_( upstream ) {}
+};
+
+/**
+ *  @brief Return a thread safe memory resource allocating from the given
+ *         memory resource
+ *
+ *  The values parsed by the worker threads keep a pointer to the memory
+ *  resource they were allocated with, so the synchronised resource cannot
+ *  be destroyed when parsing is done. One synchronised resource is kept for
+ *  every memory resource used in a parallel parse for the lifetime of the
+ *  program (only the mutex and the pointer to the resource are kept, the
+ *  memory itself belongs to the resource).
+ *
+ *  @param[in] resource   the memory resource to be synchronised
+ */
+static std::pmr::memory_resource*
+synchronised( std::pmr::memory_resource* resource ) {
+
+  static std::mutex mutex;
+  static std::map< std::pmr::memory_resource*,
+                   std::unique_ptr< SynchronisedResource > > resources;
+
+  std::lock_guard< std::mutex > lock( mutex );
+  auto& synchronised = resources[ resource ];
+  if ( not synchronised ) {
+
+    synchronised = std::make_unique< SynchronisedResource >( resource );
+  }
+  return synchronised.get();
+}
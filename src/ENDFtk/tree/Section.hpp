@@ -2,12 +2,31 @@
 #define NJOY_ENDFTK_TREE_SECTION
 
 // system includes
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
 
 // other includes
 #include "range/v3/view/subrange.hpp"
 #include "ENDFtk/HeadRecord.hpp"
+#include "ENDFtk/MemoryUsage.hpp"
+#include "ENDFtk/ParseError.hpp"
+#include "ENDFtk/ParseOptions.hpp"
+#include "ENDFtk/ParseResult.hpp"
 #include "ENDFtk/TextRecord.hpp"
 #include "ENDFtk/section.hpp"
+#include "ENDFtk/record/RealParser.hpp"
+#include "ENDFtk/record/SharedBuffer.hpp"
+#include "ENDFtk/tree/MappedFile.hpp"
+#include "ENDFtk/tree/SectionHeader.hpp"
+#include "ENDFtk/tree/TapeIndex.hpp"
 
 namespace njoy {
 namespace ENDFtk {
@@ -19,6 +38,16 @@ namespace tree {
    *
    *  This class represents a single section in an ENDF tape, it is the smallest
    *  piece available in the ENDF tree prior to parsing it.
+   *
+   *  When the section was indexed from a memory mapped file, the section
+   *  refers to its content inside the mapping instead of owning a copy of it.
+   *  An owned copy of the content is only made when the section is modified
+   *  or when its content is requested as a string (see content() and view()).
+   *
+   *  Owned content is immutable and shared between copies of the section, so
+   *  that copying a section (or the file, material or tape it belongs to) does
+   *  not copy its content. A modification of the section replaces its content
+   *  without affecting any of its copies.
    */
   class Section {
 
@@ -26,10 +55,15 @@ namespace tree {
     int mat_;
     int mf_;
     int mt_;
-    std::string content_;
+    std::shared_ptr< const MappedFile > mapping_;
+    std::string_view view_;
+    mutable std::shared_ptr< const std::string > content_;
+    unsigned int nc_;
+    mutable std::optional< std::uint64_t > hash_;
 
-    /* auxiliary function */
+    /* auxiliary functions */
     #include "ENDFtk/tree/Section/src/findEnd.hpp"
+    #include "ENDFtk/tree/Section/src/writeInteger.hpp"
 
   public:
 
@@ -38,6 +72,10 @@ namespace tree {
 
     /* methods */
     #include "ENDFtk/tree/Section/src/parse.hpp"
+    #include "ENDFtk/tree/Section/src/verify.hpp"
+    #include "ENDFtk/tree/Section/src/invalidField.hpp"
+    #include "ENDFtk/tree/Section/src/tryParse.hpp"
+    #include "ENDFtk/tree/Section/src/header.hpp"
 
     /**
      *  @brief Return MAT number of the section
@@ -70,18 +108,63 @@ namespace tree {
 
     /**
      *  @brief Return the section's content
+     *
+     *  The content of a section that refers to a memory mapped file is copied
+     *  into a string the first time this function is called (the copy is
+     *  kept for as long as the section is not modified). Use view() to
+     *  access the content without copying it.
      */
-    const std::string& content() const { return this->content_; }
+    const std::string& content() const {
+
+      if ( not this->mapping_ ) {
+
+        return *this->content_;
+      }
+
+      auto content = std::atomic_load( &this->content_ );
+      if ( not content ) {
+
+        std::shared_ptr< const std::string > expected;
+        content = std::make_shared< const std::string >( this->view_ );
+        if ( not std::atomic_compare_exchange_strong( &this->content_,
+                                                      &expected, content ) ) {
+
+          content = expected;
+        }
+      }
+      return *content;
+    }
 
     /**
-     *  @brief Return the number lines in the section
+     *  @brief Return a view of the section's content
+     *
+     *  For a section that refers to a memory mapped file, the view refers to
+     *  the content inside the mapping. The view remains valid for as long as
+     *  the section (or one of its copies) is not modified or destroyed.
      */
-    unsigned int NC() const {
+    std::string_view view() const {
 
-      // count all newline characters, subtract 1 for the SEND record
-      return std::count( this->content_.begin(), this->content_.end(), '\n' ) - 1;
+      return this->mapping_ ? this->view_ : std::string_view( *this->content_ );
     }
 
+    /**
+     *  @brief Return whether or not the section's content refers to a memory
+     *         mapped file
+     */
+    bool isMapped() const { return this->mapping_ != nullptr; }
+
+    /**
+     *  @brief Return the number lines in the section
+     *
+     *  The number of lines is determined when the section is created, so
+     *  that this function does not need to go over the content.
+     */
+    unsigned int NC() const { return this->nc_; }
+
+    #include "ENDFtk/tree/Section/src/hash.hpp"
+    #include "ENDFtk/tree/Section/src/memoryUsage.hpp"
+
+    #include "ENDFtk/tree/Section/src/normalise.hpp"
     #include "ENDFtk/tree/Section/src/clean.hpp"
   };
 
@@ -1,23 +1,24 @@
 /**
  *  @brief Clean up the section
  *
- *  This section removes the sequence numbers from the section
+ *  This section removes the sequence numbers from the section. The MAT, MF
+ *  and MT numbers of every line are verified first, an exception is thrown
+ *  when they do not match those of the section (use normalise() to overwrite
+ *  them instead). If the section referred to a memory mapped file, it will
+ *  own its content afterwards.
  */
 void clean() {
 
-  int NC = this->NC();
-  std::string content = this->content();
+  const auto content = this->view();
   auto position = content.begin();
   auto end = content.end();
   long lineNumber = 0;
 
-  this->content_.clear();
-  auto output = std::back_inserter( this->content_ );
+  for ( unsigned int NC = this->NC(); NC > 0; --NC ) {
 
-  while ( NC-- > 0 ) {
-
-    TextRecord text( position, end, lineNumber, this->MAT(), this->MF(), this->MT() );
-    text.print( output, this->MAT(), this->MF(), this->MT() );
+    TextRecord( position, end, lineNumber,
+                this->MAT(), this->MF(), this->MT() );
   }
-  SEND( this->MAT(), this->MF() ).print( output );
+
+  this->normalise();
 }
@@ -9,29 +9,109 @@
  *  @param[in] buffer   the buffer representing the section
  */
 Section( int MAT, int MF, int MT, std::string&& buffer ) :
-  mat_( MAT ), mf_( MF ), mt_( MT ), content_( std::move( buffer ) ) {}
+  mat_( MAT ), mf_( MF ), mt_( MT ),
+  content_( std::make_shared< const std::string >( std::move( buffer ) ) ),
+  nc_( countLines( *this->content_ ) ) {}
+
+private:
+
+/**
+ *  @brief Private intermediate constructor
+ *
+ *  The section refers to the content in the mapping if a mapping is given,
+ *  otherwise a copy of the content is made.
+ *
+ *  @param[in] MAT       the MAT number of the section
+ *  @param[in] MF        the MF number of the section
+ *  @param[in] MT        the MT number of the section
+ *  @param[in] begin     the beginning of the section in the buffer
+ *  @param[in] end       the end of the section in the buffer and the number
+ *                       of lines in the section
+ *  @param[in] mapping   the memory mapped file the buffer belongs to (if any)
+ */
+template< typename BufferIterator >
+Section( int MAT, int MF, int MT, BufferIterator begin,
+         std::pair< BufferIterator, unsigned int > end,
+         std::shared_ptr< const MappedFile >&& mapping ) :
+  mat_( MAT ), mf_( MF ), mt_( MT ), mapping_( std::move( mapping ) ),
+  nc_( end.second ) {
+
+  if ( this->mapping_ ) {
+
+    this->view_ = std::string_view( &*begin,
+                                    std::distance( begin, end.first ) );
+  }
+  else {
+
+    this->content_ = std::make_shared< const std::string >( begin, end.first );
+  }
+}
+
+public:
+
+/**
+ *  @brief Constructor (from a memory mapped file)
+ *
+ *  This constructor is not to be called directly by a user.
+ *
+ *  @param[in] MAT       the MAT number of the section
+ *  @param[in] MF        the MF number of the section
+ *  @param[in] MT        the MT number of the section
+ *  @param[in] mapping   the memory mapped file
+ *  @param[in] offset    the offset of the section in the mapped file
+ *  @param[in] length    the length of the section in the mapped file
+ *  @param[in] NC        the number of lines in the section
+ */
+Section( int MAT, int MF, int MT, std::shared_ptr< const MappedFile > mapping,
+         std::size_t offset, std::size_t length, unsigned int NC ) :
+  Section( MAT, MF, MT, mapping->begin() + offset,
+           std::make_pair( mapping->begin() + offset + length, NC ),
+           std::move( mapping ) ) {}
 
 /**
  *  @brief Constructor (from a buffer)
  *
  *  This constructor is not to be called directly by a user.
  *
- *  @param[in] head         the head record of the section
+ *  @param[in] tail         the MAT, MF and MT numbers of the section
  *  @param[in] begin        the beginning of the buffer
  *  @param[in] position     the current position in the buffer
  *  @param[in] end          the end of the buffer
  *  @param[in] lineNumber   the current line number
+ *  @param[in] mapping      the memory mapped file the buffer belongs to (if any)
  */
 template< typename BufferIterator >
-Section( const HEAD& head, BufferIterator begin,
+Section( const record::Tail& tail, BufferIterator begin,
          BufferIterator& position, const BufferIterator& end,
-         long& lineNumber )
-  try: Section( head.MAT(), head.MF(), head.MT(),
-                std::string( begin, findEnd( position, end, lineNumber ) ) ) {}
+         long& lineNumber,
+         std::shared_ptr< const MappedFile > mapping = nullptr )
+  try: Section( tail.MAT(), tail.MF(), tail.MT(),
+                begin, findEnd( position, end, lineNumber ),
+                std::move( mapping ) ) {}
   catch( std::exception& e ) {
 
     Log::info( "Trouble encountered while constructing an ENDF tree section" );
     Log::info( "Current position: MAT{} MF{} MT{} at line {}",
-               head.MAT(), head.MF(), head.MT(), lineNumber );
+               tail.MAT(), tail.MF(), tail.MT(), lineNumber );
     throw e;
   }
+
+/**
+ *  @brief Constructor (from a buffer)
+ *
+ *  This constructor is not to be called directly by a user.
+ *
+ *  @param[in] head         the head record of the section
+ *  @param[in] begin        the beginning of the buffer
+ *  @param[in] position     the current position in the buffer
+ *  @param[in] end          the end of the buffer
+ *  @param[in] lineNumber   the current line number
+ *  @param[in] mapping      the memory mapped file the buffer belongs to (if any)
+ */
+template< typename BufferIterator >
+Section( const HEAD& head, BufferIterator begin,
+         BufferIterator& position, const BufferIterator& end,
+         long& lineNumber,
+         std::shared_ptr< const MappedFile > mapping = nullptr ) :
+  Section( record::Tail( head.MAT(), head.MF(), head.MT() ),
+           begin, position, end, lineNumber, std::move( mapping ) ) {}
@@ -1,9 +1,26 @@
+/**
+ *  @brief Find the end of the section
+ *
+ *  The position (just after the HEAD record of the section) is advanced
+ *  beyond the SEND record of the section. The end of the section and the
+ *  number of lines in the section are returned. The number of lines includes
+ *  the HEAD record and excludes the SEND record (it is the NC value of the
+ *  section): the HEAD record was already read, so that counting the lines
+ *  read here (including the SEND record) gives the same number.
+ *
+ *  @param[in,out] position     the current position in the buffer
+ *  @param[in]     end          the end of the buffer
+ *  @param[in,out] lineNumber   the current line number
+ */
 template< typename BufferIterator >
-static BufferIterator findEnd
-( BufferIterator& position, const BufferIterator& end, long& lineNumber ) {
+static std::pair< BufferIterator, unsigned int >
+findEnd( BufferIterator& position, const BufferIterator& end,
+         long& lineNumber ) {
+
+  const long start = lineNumber;
 
   // skip to the first SEND record
-  while ( record::skip( position, end, lineNumber ).MT() != 0 ) {
+  while ( record::scan( position, end, lineNumber ).MT() != 0 ) {
 
     if ( position >= end ) {
 
@@ -11,5 +28,16 @@ static BufferIterator findEnd
       throw std::exception();
     }
   }
-  return position;
+  return { position, lineNumber - start };
+}
+
+/**
+ *  @brief Count the number of lines in the section (excluding the SEND record)
+ *
+ *  @param[in] content   the content of the section
+ */
+static unsigned int countLines( std::string_view content ) {
+
+  // count all newline characters, subtract 1 for the SEND record
+  return std::count( content.begin(), content.end(), '\n' ) - 1;
 }
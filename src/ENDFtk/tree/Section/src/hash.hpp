@@ -0,0 +1,34 @@
+/**
+ *  @brief Return a 64-bit hash of the section's content
+ *
+ *  The hash ignores the sequence numbers (columns 76 to 80) and the line
+ *  endings, so that two sections that only differ in these have the same
+ *  hash. The hash is computed on the first call and cached until the content
+ *  of the section is changed. Calling this function concurrently on the same
+ *  section before the hash was cached is not thread safe.
+ */
+std::uint64_t hash() const {
+
+  if ( not this->hash_ ) {
+
+    const auto content = this->view();
+    std::uint64_t value = TapeIndex::hash( "" );
+    std::size_t position = 0;
+    while ( position < content.size() ) {
+
+      auto eol = content.find( '\n', position );
+      eol = eol == std::string_view::npos ? content.size() : eol;
+      auto length = std::min< std::size_t >( eol - position, 75 );
+      while ( ( length > 0 ) && ( content[ position + length - 1 ] == '\r' ) ) {
+
+        --length;
+      }
+
+      value = TapeIndex::hash( content.substr( position, length ), value );
+      value = TapeIndex::hash( "\n", value );
+      position = eol + 1;
+    }
+    this->hash_ = value;
+  }
+  return *this->hash_;
+}
@@ -0,0 +1,37 @@
+/**
+ *  @brief Return the metadata of the section without parsing the section
+ *
+ *  Only the HEAD record and the second record of the section (if there is
+ *  one) are decoded, so the cost of this function does not depend on the
+ *  size of the section.
+ *
+ *  @param[in] lineNumber   the line number to be used in parsing
+ */
+SectionHeader header( long& lineNumber ) const {
+
+  const auto content = this->view();
+  auto position = content.begin();
+  auto end = content.end();
+
+  HeadRecord head( position, end, lineNumber );
+
+  // the next line is the SEND record for a section with a single record
+  auto division =
+      record::readDivision( position, record::findLineEnd( position, end ) );
+  if ( not ( division && division->isSend() ) ) {
+
+    return SectionHeader( std::move( head ),
+                          ControlRecord( position, end, lineNumber,
+                                         head.MAT(), head.MF(), head.MT() ) );
+  }
+  return SectionHeader( std::move( head ), std::nullopt );
+}
+
+/**
+ *  @brief Return the metadata of the section without parsing the section
+ */
+SectionHeader header() const {
+
+  long lineNumber = 1;
+  return this->header( lineNumber );
+}
@@ -0,0 +1,38 @@
+/**
+ *  @brief Return the first field on a line of the section that cannot be
+ *         read as a number
+ *
+ *  The field is returned as "field 1" to "field 6", or as an empty string
+ *  when every field on the line can be read (or when the section does not
+ *  have the line).
+ *
+ *  @param[in] line   the line number (the first line of a section is line 1)
+ */
+std::string invalidField( long line ) const {
+
+  const auto content = this->view();
+  auto position = content.begin();
+  const auto end = content.end();
+  while ( ( --line > 0 ) && ( position != end ) ) {
+
+    const auto eol = record::findLineEnd( position, end );
+    position = eol == end ? end : std::next( eol );
+  }
+  if ( ( line != 0 ) || ( position == end ) ) {
+
+    return "";
+  }
+
+  const auto eol = record::findLineEnd( position, end );
+  const std::string_view text( &*position, std::distance( position, eol ) );
+  for ( int index = 0; index < 6; ++index ) {
+
+    double value = 0.;
+    const auto start = std::min< std::size_t >( 11 * index, text.size() );
+    if ( not record::RealParser::decode( text.substr( start, 11 ), value ) ) {
+
+      return ParseError::fieldName( index );
+    }
+  }
+  return "";
+}
@@ -0,0 +1,25 @@
+/**
+ *  @brief Return the memory used by the section
+ *
+ *  The content of a section that refers to a memory mapped file is reported
+ *  as mapped text (and the copy made by content() as text), owned content as
+ *  text (even when the content is shared with copies of the section).
+ */
+MemoryUsage memoryUsage() const {
+
+  MemoryUsage usage;
+  usage.overhead = sizeof( Section );
+  if ( this->mapping_ ) {
+
+    usage.mapped = this->view_.size();
+    if ( const auto content = std::atomic_load( &this->content_ ) ) {
+
+      usage.text = content->capacity();
+    }
+  }
+  else {
+
+    usage.text = this->content_->capacity();
+  }
+  return usage;
+}
@@ -0,0 +1,63 @@
+/**
+ *  @brief Normalise the section
+ *
+ *  This function rewrites every line of the section in a single pass over
+ *  its content: the first 66 columns of each line are kept (short lines are
+ *  padded with blanks), the MAT, MF and MT columns are set to those of the
+ *  section, the sequence numbers are removed or renumbered and every line
+ *  is terminated by a single newline character. The last line is written
+ *  as the SEND record of the section.
+ *
+ *  When sequence numbers are renumbered, the lines in the section are
+ *  numbered starting from 1 and the SEND record receives 99999.
+ *
+ *  If the section referred to a memory mapped file, it will own its content
+ *  afterwards. Copies of the section are not affected.
+ *
+ *  @param[in] renumber   renumber the lines instead of removing the
+ *                        sequence numbers
+ */
+void normalise( bool renumber = false ) {
+
+  const auto content = this->view();
+  const char* position = content.data();
+  const char* end = position + content.size();
+
+  std::string buffer( std::size_t( this->NC() + 1 ) * 81, ' ' );
+  char* line = buffer.data();
+  for ( unsigned int i = 0; i <= this->NC(); ++i, line += 81 ) {
+
+    // find the end of the line, excluding the line ending
+    const char* eol = static_cast< const char* >(
+                          std::memchr( position, '\n', end - position ) );
+    const char* next = eol ? eol + 1 : end;
+    eol = eol ? eol : end;
+    while ( ( eol != position ) && ( *( eol - 1 ) == '\r' ) ) {
+
+      --eol;
+    }
+
+    // the SEND record does not have any content
+    const bool send = i == this->NC();
+    if ( not send ) {
+
+      const auto length = std::min< std::ptrdiff_t >( eol - position, 66 );
+      std::copy( position, position + length, line );
+    }
+
+    writeInteger( line + 66, 4, this->MAT() );
+    writeInteger( line + 70, 2, this->MF() );
+    writeInteger( line + 72, 3, send ? 0 : this->MT() );
+    if ( renumber ) {
+
+      writeInteger( line + 75, 5, send ? 99999 : ( i + 1 ) % 100000 );
+    }
+    line[80] = '\n';
+    position = next;
+  }
+
+  this->mapping_.reset();
+  this->view_ = std::string_view();
+  this->content_ = std::make_shared< const std::string >( std::move( buffer ) );
+  this->hash_.reset();
+}
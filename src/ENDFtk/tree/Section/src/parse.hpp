@@ -1,13 +1,22 @@
 /**
  *  @brief Parse the section
  *
+ *  Lazily decoded records share ownership of the content of the section (or
+ *  of the memory mapped file it refers to) instead of copying their lines.
+ *
  *  @param[in] lineNumber   the line number to be used in parsing
  */
 template< int MF, int... OptionalMT >
 section::Type< MF, OptionalMT... > parse( long& lineNumber ) const {
 
-  auto position = this->content().begin();
-  auto end = this->content().end();
+  const auto content = this->view();
+  record::SharedBuffer::Scope buffer(
+      this->mapping_ ? std::shared_ptr< const void >( this->mapping_ )
+                     : std::shared_ptr< const void >( this->content_ ),
+      content );
+
+  auto position = content.begin();
+  auto end = content.end();
 
   HeadRecord head( position, end, lineNumber );
   return { head, position, end, lineNumber, head.MAT() };
@@ -22,3 +31,46 @@ section::Type< MF, OptionalMT... > parse() const {
   long lineNumber = 1;
   return this->parse< MF, OptionalMT... >( lineNumber );
 }
+
+/**
+ *  @brief Parse the section using the given parse options
+ *
+ *  @param[in] options      the parse options
+ *  @param[in] lineNumber   the line number to be used in parsing
+ */
+template< int MF, int... OptionalMT >
+section::Type< MF, OptionalMT... >
+parse( const ParseOptions& options, long& lineNumber ) const {
+
+  ParseOptions::Scope scope( options );
+  return this->parse< MF, OptionalMT... >( lineNumber );
+}
+
+/**
+ *  @brief Parse the section using the given parse options
+ *
+ *  @param[in] options   the parse options
+ */
+template< int MF, int... OptionalMT >
+section::Type< MF, OptionalMT... > parse( const ParseOptions& options ) const {
+
+  long lineNumber = 1;
+  return this->parse< MF, OptionalMT... >( options, lineNumber );
+}
+
+/**
+ *  @brief Parse the section using the given memory resource for the values
+ *         of the records in the section
+ *
+ *  The memory resource must outlive the parsed section.
+ *
+ *  @param[in] resource   the memory resource
+ */
+template< int MF, int... OptionalMT >
+section::Type< MF, OptionalMT... >
+parse( std::pmr::memory_resource& resource ) const {
+
+  ParseOptions options = ParseOptions::active();
+  options.memoryResource = &resource;
+  return this->parse< MF, OptionalMT... >( options );
+}
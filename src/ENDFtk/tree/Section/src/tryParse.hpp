@@ -0,0 +1,35 @@
+/**
+ *  @brief Parse the section without throwing an exception
+ *
+ *  The structure of the section is verified before it is parsed (see
+ *  verify()) so that the most common errors are reported without throwing
+ *  and catching exceptions internally. Any other error is detected by the
+ *  record decoders, which log it and throw an exception as they do for
+ *  parse(): this function catches that exception and returns the error with
+ *  the line on which it was detected, the type of the record that failed and
+ *  the field that could not be read (when these are known). Callers that do
+ *  not want these log messages can create a LogSilencer.
+ */
+template< int MF, int... OptionalMT >
+ParseResult< section::Type< MF, OptionalMT... > > tryParse() const {
+
+  if ( auto error = this->verify() ) {
+
+    return std::move( *error );
+  }
+
+  long lineNumber = 1;
+  ParseError::Context context;
+  try {
+
+    return this->parse< MF, OptionalMT... >( lineNumber );
+  }
+  catch ( ... ) {
+
+    return ParseError{ this->MAT(), this->MF(), this->MT(), lineNumber,
+                       context.record(),
+                       context.field().empty()
+                         ? this->invalidField( lineNumber ) : context.field(),
+                       "The section could not be parsed" };
+  }
+}
@@ -0,0 +1,56 @@
+/**
+ *  @brief Verify the structure of the section without parsing it
+ *
+ *  Every line of the section must contain the MAT, MF and MT number of the
+ *  section, except for the last one which must be a SEND record (the missing
+ *  columns of short lines are read as blanks, see record::readTail()). The
+ *  function does not throw and does not log anything: the first error that
+ *  is encountered is returned (if there is one).
+ */
+std::optional< ParseError > verify() const {
+
+  const auto content = this->view();
+  auto position = content.begin();
+  const auto end = content.end();
+
+  long line = 0;
+  auto error = [&] ( const char* reason, const char* field = "" ) {
+
+    return ParseError{ this->MAT(), this->MF(), this->MT(), line, "", field,
+                       reason };
+  };
+
+  while ( position != end ) {
+
+    ++line;
+    const auto eol = record::findLineEnd( position, end );
+    const auto tail = record::readTail( position, eol );
+    if ( not tail ) {
+
+      return error( "Encountered an illegal MAT, MF or MT number" );
+    }
+
+    position = eol == end ? end : std::next( eol );
+    const bool last = position == end;
+    if ( tail->MAT() != this->MAT() ) {
+
+      return error( "The MAT number is inconsistent with the section", "MAT" );
+    }
+    if ( tail->MF() != this->MF() ) {
+
+      return error( "The MF number is inconsistent with the section", "MF" );
+    }
+    if ( tail->MT() != ( last ? 0 : this->MT() ) ) {
+
+      return last ? error( "The section does not end with a SEND record", "MT" )
+                  : error( "The MT number is inconsistent with the section", "MT" );
+    }
+  }
+
+  if ( line < 2 ) {
+
+    return error( "The section does not contain a HEAD and SEND record" );
+  }
+
+  return std::nullopt;
+}
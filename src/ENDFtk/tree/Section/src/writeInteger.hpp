@@ -0,0 +1,28 @@
+/**
+ *  @brief Write a right aligned integer in a field of the given width
+ *
+ *  The field is filled with blanks before the integer is written.
+ *
+ *  @param[in] field   the first character of the field
+ *  @param[in] width   the width of the field
+ *  @param[in] value   the integer to be written
+ */
+static void writeInteger( char* field, int width, long value ) {
+
+  std::fill_n( field, width, ' ' );
+
+  const bool negative = value < 0;
+  unsigned long number = negative ? -value : value;
+  char* current = field + width;
+  do {
+
+    *--current = static_cast< char >( '0' + number % 10 );
+    number /= 10;
+  }
+  while ( ( number != 0 ) && ( current != field ) );
+
+  if ( negative && ( current != field ) ) {
+
+    *--current = '-';
+  }
+}
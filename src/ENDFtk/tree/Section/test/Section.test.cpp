@@ -1,5 +1,7 @@
 // include Catch2
 #include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+using Catch::Matchers::WithinRel;
 
 // what we are testing
 #include "ENDFtk/tree/Section.hpp"
@@ -95,6 +97,174 @@ SCENARIO( "tree::Section" ) {
       THEN( "the sequence numbers will be removed" ) {
 
         CHECK( chunkClean() + validSEND() == section.content() );
+        CHECK( 4 == section.NC() );
+      } // THEN
+    } // WHEN
+
+    WHEN( "a section with inconsistent MAT numbers is cleaned" ) {
+
+      tree::Section other( 126, mf, mt, std::string( sectionString ) );
+
+      THEN( "an exception is thrown and the section is not modified" ) {
+
+        CHECK_THROWS( other.clean() );
+        CHECK( sectionString == other.content() );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+
+  GIVEN( "a copy of a tree::Section" ) {
+
+    std::string sectionString = chunkDirty() + validSEND();
+    tree::Section section( 125, 3, 1, std::string( sectionString ) );
+    tree::Section copy( section );
+
+    WHEN( "the content of the sections is requested" ) {
+
+      THEN( "the content is shared" ) {
+
+        CHECK( section.content().data() == copy.content().data() );
+      } // THEN
+    } // WHEN
+
+    WHEN( "the copy is modified" ) {
+
+      copy.clean();
+
+      THEN( "the copy has its own content and the original is not modified" ) {
+
+        CHECK( section.content().data() != copy.content().data() );
+        CHECK( sectionString == section.content() );
+        CHECK( chunkClean() + validSEND() == copy.content() );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+
+  GIVEN( "tree::Section objects that only differ in sequence numbers" ) {
+
+    tree::Section dirty( 125, 3, 1, chunkDirty() + validSEND() );
+    tree::Section clean( 125, 3, 1, chunkClean() + validSEND() );
+    tree::Section other( 125, 3, 1, chunk() + validSEND() );
+
+    WHEN( "the hash of the sections is requested" ) {
+
+      auto hash = dirty.hash();
+
+      THEN( "the sequence numbers are ignored" ) {
+
+        CHECK( hash == clean.hash() );
+        CHECK( hash != other.hash() );
+      } // THEN
+
+      THEN( "the hash is updated when the section is changed" ) {
+
+        dirty.normalise();
+        CHECK( hash == dirty.hash() );
+
+        tree::Section changed( 126, 3, 1, chunkDirty() + validSEND() );
+        hash = changed.hash();
+        changed.normalise();
+        CHECK( hash != changed.hash() );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+
+  GIVEN( "a buffer for a tree::Section that is not normalised" ) {
+
+    std::string sectionString =
+      " 1.001000+3 9.991673-1          0          0          0          0 125 3  1    1\r\n"
+      " 0.000000+0 0.000000+0          0          0          1          2 126 3  1    2\n"
+      "          4          2\n"
+      " 1.000000-5 1.000000+0 2.000000+7 2.000000+0                       125 3  1    4\n"
+      "                                                                   125 3  0    5\n";
+
+    WHEN( "the section is normalised" ) {
+
+      tree::Section section( 125, 3, 1, std::string( sectionString ) );
+      section.normalise();
+
+      THEN( "the lines are fixed and the sequence numbers are removed" ) {
+
+        CHECK( 4 == section.NC() );
+        CHECK( chunkClean() + validSEND() == section.content() );
+      } // THEN
+    } // WHEN
+
+    WHEN( "the section is normalised and renumbered" ) {
+
+      tree::Section section( 125, 3, 1, std::string( sectionString ) );
+      section.normalise( true );
+
+      THEN( "the lines are fixed and the sequence numbers are renumbered" ) {
+
+        CHECK( 4 == section.NC() );
+        CHECK( chunkDirty() +
+               "                                                                   125 3  099999\n"
+               == section.content() );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+
+  GIVEN( "a tree::Section with more than one record" ) {
+
+    std::string sectionString = chunk() + validSEND();
+    tree::Section section( 125, 3, 1, std::string( sectionString ) );
+
+    WHEN( "the header of the section is requested" ) {
+
+      long lineNumber = 1;
+      auto header = section.header( lineNumber );
+
+      THEN( "only the first two records are read" ) {
+
+        CHECK( 3 == lineNumber );
+
+        CHECK( 125 == header.MAT() );
+        CHECK( 3 == header.MF() );
+        CHECK( 1 == header.MT() );
+        CHECK( 1001 == header.ZA() );
+        CHECK_THAT( 0.9991673, WithinRel( header.AWR() ) );
+        CHECK_THAT( 0.9991673, WithinRel( header.atomicWeightRatio() ) );
+
+        CHECK( true == header.hasSecondRecord() );
+        CHECK_THAT( 0., WithinRel( header.QM() ) );
+        CHECK_THAT( 0., WithinRel( header.QI() ) );
+        CHECK( 2 == header.secondRecord().N1() );
+        CHECK( 96 == header.secondRecord().N2() );
+
+        CHECK_THROWS( header.LRP() );
+        CHECK_THROWS( header.LFI() );
+        CHECK_THROWS( header.LTT() );
+        CHECK_THROWS( header.LCT() );
+        CHECK_THROWS( header.NK() );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+
+  GIVEN( "a tree::Section with a single record" ) {
+
+    std::string sectionString =
+      " 1.001000+3 9.991673-1          1          2          0          0 125 1451     \n"
+      "                                                                   125 1  0     \n";
+    tree::Section section( 125, 1, 451, std::string( sectionString ) );
+
+    WHEN( "the header of the section is requested" ) {
+
+      auto header = section.header();
+
+      THEN( "only the HEAD record is read" ) {
+
+        CHECK( 125 == header.MAT() );
+        CHECK( 1 == header.MF() );
+        CHECK( 451 == header.MT() );
+        CHECK( 1001 == header.ZA() );
+        CHECK_THAT( 0.9991673, WithinRel( header.AWR() ) );
+        CHECK( 1 == header.LRP() );
+        CHECK( 2 == header.LFI() );
+
+        CHECK( false == header.hasSecondRecord() );
+        CHECK_THROWS( header.secondRecord() );
+        CHECK_THROWS( header.QM() );
       } // THEN
     } // WHEN
   } // GIVEN
@@ -131,6 +301,54 @@ SCENARIO( "tree::Section" ) {
       } // THEN
     } // WHEN
   } // GIVEN
+
+  GIVEN( "valid and invalid data for a tree::Section" ) {
+
+    std::string valid = chunk() + validSEND();
+
+    // line 5 has an MF number of 4
+    std::string wrongMF = valid;
+    wrongMF.replace( 4 * 81 + 66, 9, " 125 4  1" );
+
+    // line 6 has a field that cannot be read
+    std::string wrongField = valid;
+    wrongField.replace( 5 * 81, 11, " 1.0000x0-3" );
+
+    // the last line is not a SEND record
+    std::string wrongSEND = chunk() + invalidSEND();
+
+    WHEN( "the sections are parsed without throwing exceptions" ) {
+
+      auto success = tree::Section( 125, 3, 1, std::move( valid ) ).tryParse< 3 >();
+      auto mf = tree::Section( 125, 3, 1, std::move( wrongMF ) ).tryParse< 3 >();
+      auto field = tree::Section( 125, 3, 1, std::move( wrongField ) ).tryParse< 3 >();
+      auto send = tree::Section( 125, 3, 1, std::move( wrongSEND ) ).tryParse< 3 >();
+
+      THEN( "the parsed section or a structured error is returned" ) {
+
+        CHECK( true == success.hasValue() );
+        CHECK( 96 == success.value().NP() );
+
+        CHECK( false == mf.hasValue() );
+        CHECK( 125 == mf.error().mat );
+        CHECK( 3 == mf.error().mf );
+        CHECK( 1 == mf.error().mt );
+        CHECK( 5 == mf.error().line );
+        CHECK( "" == mf.error().record );
+        CHECK( "MF" == mf.error().field );
+
+        CHECK( false == bool( field ) );
+        CHECK( 6 == field.error().line );
+        CHECK( "TAB1" == field.error().record );
+        CHECK( "field 1" == field.error().field );
+        CHECK( "The section could not be parsed" == field.error().reason );
+
+        CHECK( false == send.hasValue() );
+        CHECK( 36 == send.error().line );
+        CHECK( "MT" == send.error().field );
+      } // THEN
+    } // WHEN
+  } // GIVEN
 } // SCENARIO
 
 std::string chunk() {
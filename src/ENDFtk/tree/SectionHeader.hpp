@@ -0,0 +1,188 @@
+#ifndef NJOY_ENDFTK_TREE_SECTIONHEADER
+#define NJOY_ENDFTK_TREE_SECTIONHEADER
+
+// system includes
+#include <optional>
+
+// other includes
+#include "ENDFtk/Log.hpp"
+#include "ENDFtk/HeadRecord.hpp"
+#include "ENDFtk/ControlRecord.hpp"
+
+namespace njoy {
+namespace ENDFtk {
+namespace tree {
+
+  /**
+   *  @class
+   *  @brief The metadata of an ENDF tree section
+   *
+   *  This class holds the first record (the HEAD record) of a section and,
+   *  when the section has one, its second record. The second record of every
+   *  ENDF section starts with 2 doubles and 4 integers (a CONT record or the
+   *  first line of a LIST or TAB1 record) so it is decoded as a CONT record.
+   *  The body of the section is never decoded.
+   *
+   *  The most commonly used metadata are available through named accessors:
+   *    - LRP and LFI: MF1 MT451, L1 and L2 of the HEAD record
+   *    - QM and QI: MF3, C1 and C2 of the second record
+   *    - LTT: MF4, L2 of the HEAD record
+   *    - LCT: MF4, L2 of the second record and MF6, L2 of the HEAD record
+   *    - NK: MF5, MF6 and MF26, N1 of the HEAD record
+   */
+  class SectionHeader {
+
+    /* fields */
+    HeadRecord head_;
+    std::optional< ControlRecord > second_;
+
+    /* auxiliary functions */
+    void verify( bool valid, const char* name ) const {
+
+      if ( not valid ) {
+
+        Log::error( "The {} value is not defined for MF{} MT{}",
+                    name, this->MF(), this->MT() );
+        throw std::exception();
+      }
+    }
+
+  public:
+
+    /* constructor */
+
+    /**
+     *  @brief Constructor
+     *
+     *  @param[in] head     the HEAD record of the section
+     *  @param[in] second   the second record of the section (if any)
+     */
+    SectionHeader( HeadRecord&& head,
+                   std::optional< ControlRecord >&& second ) :
+      head_( std::move( head ) ), second_( std::move( second ) ) {}
+
+    /* methods */
+
+    /**
+     *  @brief Return the HEAD record of the section
+     */
+    const HeadRecord& head() const { return this->head_; }
+
+    /**
+     *  @brief Return whether or not the section has a second record
+     */
+    bool hasSecondRecord() const { return this->second_.has_value(); }
+
+    /**
+     *  @brief Return the second record of the section
+     */
+    const ControlRecord& secondRecord() const {
+
+      this->verify( this->hasSecondRecord(), "second record" );
+      return *this->second_;
+    }
+
+    /**
+     *  @brief Return the MAT number of the section
+     */
+    int MAT() const { return this->head_.MAT(); }
+
+    /**
+     *  @brief Return the MF number of the section
+     */
+    int MF() const { return this->head_.MF(); }
+
+    /**
+     *  @brief Return the MT number of the section
+     */
+    int MT() const { return this->head_.MT(); }
+
+    /**
+     *  @brief Return the ZA identifier of the section
+     */
+    int ZA() const { return this->head_.ZA(); }
+
+    /**
+     *  @brief Return the atomic weight ratio of the section
+     */
+    double AWR() const { return this->head_.AWR(); }
+
+    /**
+     *  @brief Return the atomic weight ratio of the section
+     */
+    double atomicWeightRatio() const { return this->AWR(); }
+
+    /**
+     *  @brief Return the resonance parameter flag (MF1 MT451 only)
+     */
+    int LRP() const {
+
+      this->verify( ( this->MF() == 1 ) && ( this->MT() == 451 ), "LRP" );
+      return this->head_.L1();
+    }
+
+    /**
+     *  @brief Return the fission flag (MF1 MT451 only)
+     */
+    int LFI() const {
+
+      this->verify( ( this->MF() == 1 ) && ( this->MT() == 451 ), "LFI" );
+      return this->head_.L2();
+    }
+
+    /**
+     *  @brief Return the mass difference Q value (MF3 only)
+     */
+    double QM() const {
+
+      this->verify( ( this->MF() == 3 ) && this->hasSecondRecord(), "QM" );
+      return this->second_->C1();
+    }
+
+    /**
+     *  @brief Return the reaction Q value (MF3 only)
+     */
+    double QI() const {
+
+      this->verify( ( this->MF() == 3 ) && this->hasSecondRecord(), "QI" );
+      return this->second_->C2();
+    }
+
+    /**
+     *  @brief Return the distribution law flag (MF4 only)
+     */
+    int LTT() const {
+
+      this->verify( this->MF() == 4, "LTT" );
+      return this->head_.L2();
+    }
+
+    /**
+     *  @brief Return the reference frame flag (MF4 and MF6 only)
+     */
+    int LCT() const {
+
+      if ( this->MF() == 6 ) {
+
+        return this->head_.L2();
+      }
+      this->verify( ( this->MF() == 4 ) && this->hasSecondRecord(), "LCT" );
+      return this->second_->L2();
+    }
+
+    /**
+     *  @brief Return the number of subsections (MF5, MF6 and MF26 only)
+     */
+    int NK() const {
+
+      this->verify( ( this->MF() == 5 ) || ( this->MF() == 6 ) ||
+                    ( this->MF() == 26 ), "NK" );
+      return this->head_.N1();
+    }
+  };
+
+} // tree namespace
+} // ENDFtk namespace
+} // njoy namespace
+
+#endif
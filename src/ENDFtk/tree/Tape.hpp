@@ -5,15 +5,34 @@
 #include <vector>
 #include <map>
 #include <optional>
+#include <memory>
+#include <atomic>
+#include <thread>
+#include <algorithm>
+#include <numeric>
+#include <functional>
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <ostream>
+#include <string_view>
+#if !defined( _WIN32 )
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
 
 // other includes
 #include "range/v3/action/sort.hpp"
 #include "range/v3/action/unique.hpp"
 #include "range/v3/range/operations.hpp"
+#include "ENDFtk/LogSilencer.hpp"
+#include "ENDFtk/MemoryUsage.hpp"
 #include "ENDFtk/TapeIdentification.hpp"
 #include "ENDFtk/Tape.hpp"
 #include "ENDFtk/tree/Material.hpp"
 #include "ENDFtk/tree/toMaterial.hpp"
+#include "ENDFtk/tree/TapeIndex.hpp"
+#include "ENDFtk/tree/parallelFor.hpp"
 
 namespace njoy {
 namespace ENDFtk {
@@ -39,7 +58,10 @@ namespace tree {
     std::multimap< int, Material > materials_;
 
     /* auxiliary function */
+    #include "ENDFtk/tree/Tape/src/findMaterials.hpp"
+    #include "ENDFtk/tree/Tape/src/createMapInParallel.hpp"
     #include "ENDFtk/tree/Tape/src/createMap.hpp"
+    #include "ENDFtk/tree/Tape/src/createMapFromIndex.hpp"
 
   public:
 
@@ -153,28 +175,21 @@ namespace tree {
      */
     std::size_t size() const { return this->materials_.size(); }
 
+    #include "ENDFtk/tree/Tape/src/forEachChunk.hpp"
+
     /**
      *  @brief Return the tape's content
      */
     auto content() const {
 
-      std::string content;
-      if ( this->tpid_ ) {
-
-        auto output = std::back_inserter( content );
-        this->tpid_->print( output, 0, 0, 0 );
-      }
-
-      for ( const auto& material : this->materials() ) {
-
-        content += material.content();
-      }
+      std::size_t size = 0;
+      this->forEachChunk( [&] ( std::string_view chunk )
+                              { size += chunk.size(); } );
 
-      if ( content.size() ) {
-
-        auto output = std::back_inserter( content );
-        TEND().print( output );
-      }
+      std::string content;
+      content.reserve( size );
+      this->forEachChunk( [&] ( std::string_view chunk )
+                              { content += chunk; } );
 
       return content;
     }
@@ -199,7 +214,15 @@ namespace tree {
     #include "ENDFtk/tree/Tape/src/replace.hpp"
 
     #include "ENDFtk/tree/Tape/src/parse.hpp"
+    #include "ENDFtk/tree/Tape/src/tryParse.hpp"
+
+    #include "ENDFtk/tree/Tape/src/index.hpp"
+
+    #include "ENDFtk/tree/Tape/src/write.hpp"
+
+    #include "ENDFtk/tree/Tape/src/memoryUsage.hpp"
 
+    #include "ENDFtk/tree/Tape/src/normalise.hpp"
     #include "ENDFtk/tree/Tape/src/clean.hpp"
   };
 
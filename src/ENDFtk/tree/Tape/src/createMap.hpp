@@ -1,26 +1,41 @@
 template < typename BufferIterator >
 static auto
 createMap( BufferIterator position, const BufferIterator& end,
-           long& lineNumber ) {
+           long& lineNumber,
+           const std::shared_ptr< const MappedFile >& mapping = nullptr,
+           unsigned int threads = 1 ) {
+
+  if ( threads == 0 ) {
+
+    threads = std::max( 1u, std::thread::hardware_concurrency() );
+  }
 
   std::multimap< int, Material > materials;
 
+  // the serial indexing resumes where the parallel indexing stopped
+  if ( threads > 1 ) {
+
+    createMapInParallel( materials, position, end, lineNumber,
+                         mapping, threads );
+  }
+
   auto begin = position;
-  auto division = StructureDivision( position, end, lineNumber );
+  auto division = record::scan( position, end, lineNumber );
 
   while ( division.isHead() ) {
 
     materials.emplace(
-      division.tail.MAT(),
-      Material( asHead( division ), begin, position, end, lineNumber ) );
+      division.MAT(),
+      Material( division.tail, begin, position, end, lineNumber,
+                mapping ) );
 
     begin = position;
-    division = StructureDivision( position, end, lineNumber );
+    division = record::scan( position, end, lineNumber );
 
     while ( division.isMend() ) {
 
       begin = position;
-      division = StructureDivision( position, end, lineNumber );
+      division = record::scan( position, end, lineNumber );
       if ( position >= end ) {
 
         break;
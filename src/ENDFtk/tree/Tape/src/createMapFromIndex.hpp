@@ -0,0 +1,39 @@
+/**
+ *  @brief Create the materials from an index of the memory mapped file
+ *
+ *  @param[in] index   the index of the memory mapped file
+ *  @param[in] file    the memory mapped file
+ */
+static std::multimap< int, Material >
+createMapFromIndex( const TapeIndex& index,
+                    const std::shared_ptr< const MappedFile >& file ) {
+
+  std::multimap< int, Material > materials;
+
+  std::optional< Material > material;
+  std::uint32_t current = 0;
+  for ( const auto& entry : index.entries() ) {
+
+    if ( material && ( entry.material != current ) ) {
+
+      materials.emplace( material->MAT(), std::move( *material ) );
+      material.reset();
+    }
+
+    if ( not material ) {
+
+      material.emplace( entry.MAT );
+      current = entry.material;
+    }
+
+    material->insert( Section( entry.MAT, entry.MF, entry.MT, file,
+                               entry.offset, entry.length, entry.NC ) );
+  }
+
+  if ( material ) {
+
+    materials.emplace( material->MAT(), std::move( *material ) );
+  }
+
+  return materials;
+}
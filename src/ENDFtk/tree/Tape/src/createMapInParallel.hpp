@@ -0,0 +1,128 @@
+/**
+ *  @brief Index the materials in the buffer using multiple threads
+ *
+ *  The beginning of each material is first located using the MAT numbers in
+ *  the buffer, after which the materials are indexed concurrently with the
+ *  log messages of every thread involved switched off. The boundaries between the materials are then
+ *  verified in the same way the serial indexing does.
+ *
+ *  The materials up to the first one (in tape order) that could not be
+ *  indexed this way are added to the map, and the position and line number
+ *  are moved to the beginning of that material. The serial indexing should
+ *  then resume from there: it reports the problem exactly once, in the same
+ *  way it would have without the parallel indexing. When all materials were
+ *  indexed, the position and line number are moved to the TEND record.
+ *
+ *  @param[in,out] materials    the map of materials
+ *  @param[in,out] position     the current position in the buffer
+ *  @param[in]     end          the end of the buffer
+ *  @param[in,out] lineNumber   the current line number
+ *  @param[in]     mapping      the memory mapped file the buffer belongs to
+ *                              (if any)
+ *  @param[in]     threads      the number of threads to be used
+ */
+template < typename BufferIterator >
+static void
+createMapInParallel( std::multimap< int, Material >& materials,
+                     BufferIterator& position, const BufferIterator& end,
+                     long& lineNumber,
+                     const std::shared_ptr< const MappedFile >& mapping,
+                     unsigned int threads ) {
+
+  auto starts = findMaterials( position, end, lineNumber );
+  if ( ( not starts ) || starts->empty() ||
+       ( starts->front().first != position ) ) {
+
+    return;
+  }
+
+  // index every material in a pool of threads (materials after the first
+  // failure do not need to be indexed)
+  const std::size_t size = starts->size();
+  std::vector< std::optional< Material > > indexed( size );
+  std::vector< std::pair< BufferIterator, long > >
+  ends( size, std::make_pair( end, 0l ) );
+  std::atomic< std::size_t > failure( size );
+
+  // log messages are only switched off for the current thread, so every
+  // worker silences its own messages
+  LogSilencer silencer;
+  parallelFor( size, threads, [&] ( std::size_t index ) {
+
+    if ( index > failure ) {
+
+      return;
+    }
+
+    LogSilencer worker;
+    try {
+
+      auto begin = ( *starts )[ index ].first;
+      auto current = begin;
+      long line = ( *starts )[ index ].second;
+      auto division = record::scan( current, end, line );
+      if ( division.isHead() ) {
+
+        indexed[ index ].emplace( division.tail, begin, current, end, line,
+                                  mapping );
+        ends[ index ] = { current, line };
+        return;
+      }
+    }
+    catch ( ... ) {}
+
+    auto current = failure.load();
+    while ( ( index < current ) &&
+            not failure.compare_exchange_weak( current, index ) ) {}
+  } );
+
+  // verify that every material is followed by the next one (or the TEND)
+  std::size_t count = failure;
+  for ( std::size_t index = 0; index < count; ++index ) {
+
+    auto current = ends[ index ].first;
+    long line = ends[ index ].second;
+    auto begin = current;
+    long beginLine = line;
+    bool valid = false;
+
+    try {
+
+      auto division = record::scan( current, end, line );
+      while ( division.isMend() ) {
+
+        begin = current;
+        beginLine = line;
+        division = record::scan( current, end, line );
+        if ( current >= end ) {
+
+          break;
+        }
+      }
+
+      valid = index + 1 < size
+              ? division.isHead() && ( begin == ( *starts )[ index + 1 ].first )
+              : division.isTend();
+    }
+    catch ( ... ) {}
+
+    if ( not valid ) {
+
+      count = index;
+    }
+    else if ( index + 1 == size ) {
+
+      ends[ index ] = { begin, beginLine };
+    }
+  }
+
+  // materials are inserted in the same order as the serial indexing
+  for ( std::size_t index = 0; index < count; ++index ) {
+
+    materials.emplace( indexed[ index ]->MAT(), std::move( *indexed[ index ] ) );
+  }
+
+  const auto& resume = count < size ? ( *starts )[ count ] : ends[ size - 1 ];
+  position = resume.first;
+  lineNumber = resume.second;
+}
@@ -8,17 +8,79 @@ Tape( TapeIdentification&& id ) : tpid_( std::move( id ) ) {}
 /**
  *  @brief Constructor
  *
+ *  Materials can be indexed concurrently by setting the number of threads to
+ *  a value larger than 1 (a value of 0 uses all available hardware threads).
+ *  The resulting tape is identical to the one obtained with a single thread.
+ *
  *  @param[in] buffer       the buffer from which a buffer can be constructed
  *  @param[in] lineNumber   the line numbers
+ *  @param[in] threads      the number of threads used for indexing (default 1)
  */
 template< typename Buffer >
-Tape( const Buffer& buffer, long lineNumber = 0 )
+Tape( const Buffer& buffer, long lineNumber = 0, unsigned int threads = 1 )
   try {
 
     auto position = ranges::cpp20::begin( buffer );
     auto end = ranges::cpp20::end( buffer );
     this->tpid_ = TapeIdentification{ position, end, lineNumber };
-    materials_ = createMap( position, end, lineNumber );
+    materials_ = createMap( position, end, lineNumber, nullptr, threads );
+  }
+  catch ( std::exception& e ) {
+
+    Log::info( "Trouble encountered while constructing a tape syntax tree." );
+    throw e;
+  }
+
+/**
+ *  @brief Constructor (from a memory mapped file)
+ *
+ *  The sections in the tape refer to their content in the memory mapped file
+ *  instead of owning a copy of it. The mapping is kept alive for as long as
+ *  a section refers to it.
+ *
+ *  @param[in] file         the memory mapped file
+ *  @param[in] lineNumber   the line numbers
+ *  @param[in] threads      the number of threads used for indexing (default 1)
+ */
+Tape( std::shared_ptr< const MappedFile > file, long lineNumber = 0,
+      unsigned int threads = 1 )
+  try {
+
+    auto position = file->begin();
+    auto end = file->end();
+    this->tpid_ = TapeIdentification{ position, end, lineNumber };
+    materials_ = createMap( position, end, lineNumber, file, threads );
+  }
+  catch ( std::exception& e ) {
+
+    Log::info( "Trouble encountered while constructing a tape syntax tree." );
+    throw e;
+  }
+
+/**
+ *  @brief Constructor (from a memory mapped file and its index)
+ *
+ *  The materials and sections are created from the index instead of scanning
+ *  the content of the memory mapped file. An exception is thrown if the index
+ *  is not valid for the memory mapped file.
+ *
+ *  @param[in] file    the memory mapped file
+ *  @param[in] index   the index of the memory mapped file
+ */
+Tape( std::shared_ptr< const MappedFile > file, const TapeIndex& index )
+  try {
+
+    if ( not index.isValid( *file ) ) {
+
+      Log::error( "The index does not correspond to the memory mapped file" );
+      throw std::exception();
+    }
+
+    auto position = file->begin();
+    auto end = file->end();
+    long lineNumber = 0;
+    this->tpid_ = TapeIdentification{ position, end, lineNumber };
+    materials_ = createMapFromIndex( index, file );
   }
   catch ( std::exception& e ) {
 
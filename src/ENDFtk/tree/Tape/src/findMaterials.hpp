@@ -0,0 +1,52 @@
+/**
+ *  @brief Find the beginning of every material in the buffer
+ *
+ *  Only the MAT number in columns 67-70 of each line is looked at: a material
+ *  starts on a line with a positive MAT number that differs from the MAT
+ *  number on the previous line. The search stops at the first TEND record.
+ *
+ *  No value is returned if the lines in the buffer do not have the expected
+ *  structure, in which case the serial indexing should be used to report the
+ *  problem.
+ *
+ *  @param[in] position     the current position in the buffer
+ *  @param[in] end          the end of the buffer
+ *  @param[in] lineNumber   the current line number
+ */
+template < typename BufferIterator >
+static std::optional< std::vector< std::pair< BufferIterator, long > > >
+findMaterials( BufferIterator position, const BufferIterator& end,
+               long lineNumber ) {
+
+  std::vector< std::pair< BufferIterator, long > > materials;
+
+  int previous = 0;
+  while ( position < end ) {
+
+    auto eol = record::findLineEnd( position, end );
+    if ( ( eol == end ) && ( std::distance( position, eol ) < 75 ) ) {
+
+      return std::nullopt;
+    }
+
+    auto tail = record::readTail( position, eol );
+    if ( not tail ) {
+
+      return std::nullopt;
+    }
+    if ( tail->MAT() == -1 ) {
+
+      break;
+    }
+    if ( ( tail->MAT() > 0 ) && ( tail->MAT() != previous ) ) {
+
+      materials.emplace_back( position, lineNumber );
+    }
+
+    previous = tail->MAT();
+    ++lineNumber;
+    position = eol == end ? end : std::next( eol );
+  }
+
+  return materials;
+}
@@ -0,0 +1,45 @@
+/**
+ *  @brief Call a function for every piece of the tape's content
+ *
+ *  The function is called with a std::string_view for the tape
+ *  identification, the content of every section and every FEND and MEND
+ *  record, followed by the TEND record. Concatenating them yields the
+ *  tape's content without ever building it.
+ *
+ *  The string views for the sections refer to their content and remain
+ *  valid as long as the sections are not modified, the string views for
+ *  the tape identification and the structure records are only valid during
+ *  the call.
+ *
+ *  @param[in] function   the function to be called
+ */
+template< typename Function >
+void forEachChunk( Function&& function ) const {
+
+  std::string record;
+  auto output = std::back_inserter( record );
+
+  bool empty = true;
+  if ( this->tpid_ ) {
+
+    this->tpid_->print( output, 0, 0, 0 );
+    function( std::string_view( record ) );
+    empty = false;
+  }
+
+  for ( const auto& material : this->materials() ) {
+
+    material.forEachChunk( [&] ( std::string_view chunk ) {
+
+      empty = false;
+      function( chunk );
+    } );
+  }
+
+  if ( not empty ) {
+
+    record.clear();
+    TEND().print( output );
+    function( std::string_view( record ) );
+  }
+}
@@ -0,0 +1,72 @@
+/**
+ *  @brief Return an index of the tape
+ *
+ *  The index can be written next to the file the tape was read from, so that
+ *  the tape can be reconstructed without scanning the file again. All
+ *  sections in the tape must refer to the given memory mapped file, i.e. the
+ *  tape must have been read from that file and sections must not have been
+ *  modified since.
+ *
+ *  @param[in] file   the memory mapped file the tape was read from
+ */
+TapeIndex index( const MappedFile& file ) const {
+
+  std::vector< TapeIndex::Entry > entries;
+
+  std::uint32_t number = 0;
+  for ( const auto& material : this->materials() ) {
+
+    for ( const auto& mf : material.files() ) {
+
+      for ( const auto& section : mf.sections() ) {
+
+        auto content = section.view();
+        std::less< const char* > less;
+        if ( ( not section.isMapped() ) ||
+             less( content.data(), file.begin() ) ||
+             less( file.end(), content.data() + content.size() ) ) {
+
+          Log::error( "Cannot index a section that is not part of the "
+                      "memory mapped file" );
+          Log::info( "Current section: MAT{} MF{} MT{}",
+                     section.MAT(), section.MF(), section.MT() );
+          throw std::exception();
+        }
+
+        TapeIndex::Entry entry;
+        entry.material = number;
+        entry.MAT = section.MAT();
+        entry.MF = section.MF();
+        entry.MT = section.MT();
+        entry.offset = content.data() - file.begin();
+        entry.length = content.size();
+        entry.line = 0;
+        entry.NC = section.NC();
+        entry.checksum = TapeIndex::hash( content );
+        entries.push_back( entry );
+      }
+    }
+    ++number;
+  }
+
+  // line numbers are determined in a single pass over the file
+  std::vector< std::size_t > order( entries.size() );
+  std::iota( order.begin(), order.end(), 0 );
+  std::sort( order.begin(), order.end(),
+             [&entries] ( auto left, auto right ) {
+
+               return entries[ left ].offset < entries[ right ].offset;
+             } );
+
+  auto position = file.begin();
+  std::int64_t line = 0;
+  for ( auto i : order ) {
+
+    auto next = file.begin() + entries[ i ].offset;
+    line += std::count( position, next, '\n' );
+    entries[ i ].line = line;
+    position = next;
+  }
+
+  return TapeIndex( file, std::move( entries ) );
+}
@@ -0,0 +1,19 @@
+/**
+ *  @brief Return the memory used by the tape, its materials, files and
+ *         sections
+ */
+MemoryUsage memoryUsage() const {
+
+  MemoryUsage usage;
+  usage.overhead = sizeof( Tape );
+  if ( this->tpid_ ) {
+
+    usage.text += this->tpid_->text().capacity();
+  }
+  for ( const auto& entry : this->materials_ ) {
+
+    usage.overhead += MemoryUsage::node< int, Material >();
+    usage += entry.second.memoryUsage();
+  }
+  return usage;
+}
@@ -0,0 +1,26 @@
+/**
+ *  @brief Normalise the tape
+ *
+ *  This function normalises every section in the tape (see
+ *  Section::normalise()). The materials are normalised concurrently when
+ *  more than one thread is requested (a thread count of 0 uses all available
+ *  hardware threads). When a material cannot be normalised, the error for
+ *  the first such material is rethrown once all threads are done.
+ *
+ *  @param[in] renumber   renumber the lines instead of removing the
+ *                        sequence numbers
+ *  @param[in] threads    the number of threads to be used
+ */
+void normalise( bool renumber = false, unsigned int threads = 1 ) {
+
+  std::vector< Material* > materials;
+  materials.reserve( this->materials_.size() );
+  for ( auto& material : this->materials() ) {
+
+    materials.push_back( &material );
+  }
+
+  parallelFor( materials.size(), threads,
+               [&] ( std::size_t index )
+                   { materials[ index ]->normalise( renumber ); } );
+}
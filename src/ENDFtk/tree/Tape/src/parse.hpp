@@ -20,3 +20,101 @@
   long lineNumber = 1;
   return this->parse( lineNumber );
 }
+
+/**
+ *  @brief Parse the tape using the given parse options
+ *
+ *  @param[in] options      the parse options
+ *  @param[in] lineNumber   the line number to be used in parsing
+ */
+::njoy::ENDFtk::Tape parse( const ParseOptions& options,
+                            long& lineNumber ) const {
+
+  ParseOptions::Scope scope( options );
+  return this->parse( lineNumber );
+}
+
+/**
+ *  @brief Parse the tape using the given parse options
+ *
+ *  @param[in] options   the parse options
+ */
+::njoy::ENDFtk::Tape parse( const ParseOptions& options ) const {
+
+  long lineNumber = 1;
+  return this->parse( options, lineNumber );
+}
+
+/**
+ *  @brief Parse the tape using the given memory resource for the values of
+ *         the records in the tape
+ *
+ *  The memory resource must outlive the parsed tape.
+ *
+ *  @param[in] resource   the memory resource
+ */
+::njoy::ENDFtk::Tape parse( std::pmr::memory_resource& resource ) const {
+
+  ParseOptions options = ParseOptions::active();
+  options.memoryResource = &resource;
+  return this->parse( options );
+}
+
+/**
+ *  @brief Parse the tape using multiple threads
+ *
+ *  The sections of all materials in the tape are parsed concurrently, the
+ *  resulting tape is identical to the one obtained with parse(). When
+ *  sections cannot be parsed, the error for the section with the lowest MAT,
+ *  MF and MT number is reported.
+ *
+ *  @param[in] threads   the number of threads to be used (default 0, which
+ *                       uses all available hardware threads)
+ */
+::njoy::ENDFtk::Tape parallelParse( unsigned int threads = 0 ) const {
+
+  ParallelParser parser;
+  for ( const auto& material : this->materials() ) {
+
+    parser.material( material.MAT() );
+    for ( const auto& file : material.files() ) {
+
+      parser.file( file );
+    }
+  }
+
+  return { TapeIdentification( *this->tpid_ ), parser.parse( threads ) };
+}
+
+/**
+ *  @brief Parse a selection of files and sections of every material in the
+ *         tape
+ *
+ *  The selection maps MF numbers onto the MT numbers of the sections to be
+ *  parsed (an empty list of MT numbers selects all sections in the file).
+ *  The resulting materials only contain the selected files and sections
+ *  that are present in each material.
+ *
+ *  @param[in] selection   the MF and MT numbers to be parsed
+ *  @param[in] threads     the number of threads to be used (default 1, 0
+ *                         uses all available hardware threads)
+ */
+::njoy::ENDFtk::Tape
+parse( const std::map< int, std::vector< int > >& selection,
+       unsigned int threads = 1 ) const {
+
+  ParallelParser parser;
+  for ( const auto& material : this->materials() ) {
+
+    parser.material( material.MAT() );
+    for ( const auto& [ mf, mts ] : selection ) {
+
+      if ( material.hasMF( mf ) ) {
+
+        parser.file( material.MF( mf ), mts );
+      }
+    }
+  }
+
+  return { TapeIdentification( *this->tpid_ ), parser.parse( threads ) };
+}
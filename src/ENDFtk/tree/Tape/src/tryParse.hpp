@@ -0,0 +1,23 @@
+/**
+ *  @brief Parse the tape without throwing an exception
+ *
+ *  The materials of the tape are parsed using Material::tryParse() and the
+ *  error for the first material that cannot be parsed is returned.
+ */
+ParseResult< ::njoy::ENDFtk::Tape > tryParse() const {
+
+  std::vector< ::njoy::ENDFtk::Material > materials;
+  materials.reserve( this->materials_.size() );
+  for ( const auto& material : this->materials() ) {
+
+    auto result = material.tryParse();
+    if ( not result ) {
+
+      return ParseError( result.error() );
+    }
+    materials.emplace_back( std::move( result ).value() );
+  }
+
+  return ::njoy::ENDFtk::Tape( TapeIdentification( *this->tpid_ ),
+                               std::move( materials ) );
+}
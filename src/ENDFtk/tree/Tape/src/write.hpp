@@ -0,0 +1,97 @@
+/**
+ *  @brief Write the tape to an output stream
+ *
+ *  The content of the tape is streamed to the output without building it in
+ *  memory first (see forEachChunk()).
+ *
+ *  @param[in,out] out   the output stream
+ */
+void write( std::ostream& out ) const {
+
+  this->forEachChunk( [&] ( std::string_view chunk ) {
+
+    out.write( chunk.data(), chunk.size() );
+  } );
+}
+
+#if !defined( _WIN32 )
+/**
+ *  @brief Write the tape to a file descriptor
+ *
+ *  The content of the tape is streamed to the file descriptor without
+ *  building it in memory first (see forEachChunk()). The content is written
+ *  in batches of chunks using vectored writes, short chunks (like the
+ *  FEND, MEND and TEND records) are copied into a fixed size buffer since
+ *  they are only valid while they are handed out.
+ *
+ *  An exception is thrown if writing to the file descriptor fails.
+ *
+ *  @param[in] fd   the file descriptor
+ */
+void write( int fd ) const {
+
+  constexpr std::size_t batch = 64;
+  constexpr std::size_t length = 81;
+
+  std::array< iovec, batch > vectors;
+  std::array< std::array< char, length >, batch > records;
+  std::size_t count = 0;
+
+  auto flush = [&] () {
+
+    iovec* current = vectors.data();
+    std::size_t remaining = count;
+    while ( remaining > 0 ) {
+
+      const ssize_t written = ::writev( fd, current, remaining );
+      if ( written < 0 ) {
+
+        if ( errno == EINTR ) {
+
+          continue;
+        }
+
+        Log::error( "Could not write the tape to the file descriptor" );
+        Log::info( "Error: {}", std::strerror( errno ) );
+        throw std::exception();
+      }
+
+      // skip the chunks that were written completely
+      std::size_t done = static_cast< std::size_t >( written );
+      while ( ( remaining > 0 ) && ( done >= current->iov_len ) ) {
+
+        done -= current->iov_len;
+        ++current;
+        --remaining;
+      }
+      if ( remaining > 0 ) {
+
+        current->iov_base = static_cast< char* >( current->iov_base ) + done;
+        current->iov_len -= done;
+      }
+    }
+    count = 0;
+  };
+
+  this->forEachChunk( [&] ( std::string_view chunk ) {
+
+    if ( count == batch ) {
+
+      flush();
+    }
+
+    const char* data = chunk.data();
+    if ( chunk.size() <= length ) {
+
+      std::copy( chunk.begin(), chunk.end(), records[ count ].begin() );
+      data = records[ count ].data();
+    }
+
+    vectors[ count ].iov_base = const_cast< char* >( data );
+    vectors[ count ].iov_len = chunk.size();
+    ++count;
+  } );
+
+  flush();
+}
+#endif
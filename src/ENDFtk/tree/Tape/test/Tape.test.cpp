@@ -5,12 +5,17 @@
 #include "ENDFtk/tree/Tape.hpp"
 
 // other includes
+#include <fstream>
+#include <sstream>
+#include <fcntl.h>
+#include <unistd.h>
 
 // convenience typedefs
 using namespace njoy::ENDFtk;
 
 std::string chunk();
 std::string chunkMaterial125();
+std::string chunkMaterial128();
 std::string chunkTPID();
 std::string validTEND();
 std::string invalidTEND();
@@ -63,6 +68,158 @@ SCENARIO( "tree::Tape" ) {
         CHECK( tapeString == tape.content() );
       } // THEN
     } // WHEN
+
+    WHEN( "the data is read from a memory mapped file" ) {
+
+      {
+        std::ofstream out( "tape.endf", std::ios::out | std::ios::binary );
+        out << tapeString;
+      }
+
+      tree::Tape tape( std::make_shared< const tree::MappedFile >( "tape.endf" ) );
+
+      THEN( "the tape is populated correctly" ) {
+
+        CHECK( true == tape.hasMAT( 125 ) );
+        CHECK( 1 == tape.size() );
+
+        auto& material = tape.MAT( 125 ).front();
+        CHECK( true == material.section( 3, 1 ).isMapped() );
+        CHECK( 4 == material.section( 3, 1 ).NC() );
+
+        CHECK( tapeString == tape.content() );
+      } // THEN
+
+      THEN( "the content of a section can be viewed or copied" ) {
+
+        const auto& section = tape.MAT( 125 ).front().section( 3, 1 );
+        const auto view = section.view();
+        const std::string& content = section.content();
+
+        CHECK( true == section.isMapped() );
+        CHECK( view == content );
+        CHECK( view.data() != content.data() );
+        CHECK( &content == &section.content() );
+        CHECK( view.size() == section.memoryUsage().mapped );
+        CHECK( content.size() <= section.memoryUsage().text );
+      } // THEN
+
+      THEN( "a section owns its content after it is cleaned" ) {
+
+        auto& section = tape.MAT( 125 ).front().section( 3, 1 );
+        section.clean();
+
+        CHECK( false == section.isMapped() );
+        CHECK( true == tape.MAT( 125 ).front().section( 3, 5 ).isMapped() );
+
+        CHECK( tapeString == tape.content() );
+      } // THEN
+
+      THEN( "sections remain valid after the tape is destroyed" ) {
+
+        auto section = tape.MAT( 125 ).front().section( 3, 1 );
+        tape = tree::Tape( TapeIdentification( "an empty tape" ) );
+
+        CHECK( true == section.isMapped() );
+        CHECK( 4 == section.NC() );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+
+  GIVEN( "valid data for a tree::Tape with multiple materials" ) {
+
+    std::string tapeString = chunk() + chunkMaterial128()
+                             + chunkMaterial125() + validTEND();
+
+    WHEN( "the materials are indexed using multiple threads" ) {
+
+      tree::Tape serial( tapeString );
+      tree::Tape parallel( tapeString, 0, 3 );
+
+      THEN( "the tape is identical to the one indexed using a single thread" ) {
+
+        CHECK( 3 == parallel.size() );
+        CHECK( 2 == parallel.numberMAT( 125 ) );
+        CHECK( 1 == parallel.numberMAT( 128 ) );
+        CHECK( serial.materialNumbers() == parallel.materialNumbers() );
+
+        auto mats = parallel.materials()
+                    | ranges::cpp20::views::transform(
+                        [] ( const auto& material ) { return material.MAT(); } )
+                    | ranges::to_vector;
+        CHECK( std::vector< int >{ 125, 125, 128 } == mats );
+
+        CHECK( serial.content() == parallel.content() );
+        CHECK( chunk() + chunkMaterial125() + chunkMaterial128() + validTEND()
+               == parallel.content() );
+      } // THEN
+    } // WHEN
+
+    WHEN( "the tape is written without building its content" ) {
+
+      tree::Tape tape( tapeString );
+
+      std::ostringstream out;
+      tape.write( out );
+
+      {
+        std::ofstream file( "written.endf", std::ios::out | std::ios::binary );
+      }
+      int fd = ::open( "written.endf", O_WRONLY | O_TRUNC );
+      tape.write( fd );
+      ::close( fd );
+
+      std::ifstream in( "written.endf", std::ios::in | std::ios::binary );
+      std::string written( ( std::istreambuf_iterator< char >( in ) ),
+                           std::istreambuf_iterator< char >() );
+
+      std::size_t chunks = 0;
+      tape.forEachChunk( [&] ( std::string_view ) { ++chunks; } );
+
+      THEN( "the written content is the content of the tape" ) {
+
+        CHECK( tape.content() == out.str() );
+        CHECK( tape.content() == written );
+
+        // TPID, 12 sections, 9 FEND, 3 MEND and TEND
+        CHECK( 26 == chunks );
+      } // THEN
+    } // WHEN
+
+    WHEN( "the materials are normalised using multiple threads" ) {
+
+      tree::Tape serial( tapeString );
+      tree::Tape parallel( tapeString );
+      serial.normalise( true );
+      parallel.normalise( true, 3 );
+
+      THEN( "the tape is identical to the one normalised using a single "
+            "thread" ) {
+
+        CHECK( serial.content() == parallel.content() );
+
+        auto content = parallel.MAT( 128 ).front().section( 1, 451 ).content();
+        CHECK( "    1\n" == content.substr( 75, 6 ) );
+        CHECK( "99999\n" == content.substr( content.size() - 6 ) );
+      } // THEN
+    } // WHEN
+
+    WHEN( "the data has an invalid TEND and multiple threads are used" ) {
+
+      std::string invalid = chunk() + chunkMaterial128() + invalidTEND();
+
+      CHECK_THROWS( tree::Tape( invalid, 0, 2 ) );
+    } // WHEN
+
+    WHEN( "the data has an invalid material and multiple threads are used" ) {
+
+      std::string material = chunkMaterial128();
+      material.replace( material.find( "128 1  0" ), 8, "128 1 ab" );
+      std::string invalid = chunk() + material + chunkMaterial125()
+                            + validTEND();
+
+      CHECK_THROWS( tree::Tape( invalid, 0, 3 ) );
+    } // WHEN
   } // GIVEN
 
   GIVEN( "a valid tree tape" ) {
@@ -0,0 +1,112 @@
+#ifndef NJOY_ENDFTK_TREE_TAPEINDEX
+#define NJOY_ENDFTK_TREE_TAPEINDEX
+
+// system includes
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <istream>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// other includes
+#include "ENDFtk/Log.hpp"
+#include "ENDFtk/tree/MappedFile.hpp"
+
+namespace njoy {
+namespace ENDFtk {
+namespace tree {
+
+  /**
+   *  @class
+   *  @brief A persistent index of the sections in an ENDF tape
+   *
+   *  The index stores the byte offset, length, line number, number of lines
+   *  and a checksum for every section in a tape, so that a tape can be
+   *  reconstructed from a memory mapped file without scanning its content.
+   *  The index is usually stored next to the tape (e.g. file.endf.idx).
+   *
+   *  An index is only valid for the file it was created for: the size,
+   *  modification time and a hash of the beginning and end of the file are
+   *  stored in the index and are compared with the file it is used for, and
+   *  the checksum of every section is verified unless this is explicitly
+   *  skipped (see isValid()).
+   */
+  class TapeIndex {
+
+  public:
+
+    /**
+     *  @brief The index entry for a single section
+     */
+    struct Entry {
+
+      std::uint32_t material;   // the position of the material in the tape
+      std::int32_t MAT;
+      std::int32_t MF;
+      std::int32_t MT;
+      std::uint64_t offset;     // the byte offset of the section in the tape
+      std::uint64_t length;     // the number of bytes in the section
+      std::int64_t line;        // the line number of the section's head record
+      std::uint64_t NC;         // the number of lines in the section
+      std::uint64_t checksum;   // the hash of the section's content
+    };
+
+    /**
+     *  @brief The version of the binary index format
+     */
+    static constexpr std::uint32_t version = 1;
+
+  private:
+
+    /* fields */
+    std::uint64_t size_ = 0;
+    std::int64_t modified_ = 0;
+    std::uint64_t fingerprint_ = 0;
+    std::vector< Entry > entries_;
+
+    /* auxiliary functions */
+    #include "ENDFtk/tree/TapeIndex/src/fingerprint.hpp"
+    #include "ENDFtk/tree/TapeIndex/src/read.hpp"
+
+  public:
+
+    /* constructor */
+    #include "ENDFtk/tree/TapeIndex/src/ctor.hpp"
+
+    /* methods */
+    #include "ENDFtk/tree/TapeIndex/src/hash.hpp"
+
+    /**
+     *  @brief Return the size of the indexed file (in bytes)
+     */
+    std::uint64_t size() const { return this->size_; }
+
+    /**
+     *  @brief Return the modification time of the indexed file
+     */
+    std::int64_t modificationTime() const { return this->modified_; }
+
+    /**
+     *  @brief Return the hash of the beginning and end of the indexed file
+     */
+    std::uint64_t fingerprint() const { return this->fingerprint_; }
+
+    /**
+     *  @brief Return the index entries (in the order of the tape)
+     */
+    const std::vector< Entry >& entries() const { return this->entries_; }
+
+    #include "ENDFtk/tree/TapeIndex/src/isValid.hpp"
+    #include "ENDFtk/tree/TapeIndex/src/write.hpp"
+  };
+
+} // tree namespace
+} // ENDFtk namespace
+} // njoy namespace
+
+#endif
@@ -0,0 +1,107 @@
+/**
+ *  @brief Constructor
+ *
+ *  @param[in] file      the memory mapped file that was indexed
+ *  @param[in] entries   the index entries (in the order of the tape)
+ */
+TapeIndex( const MappedFile& file, std::vector< Entry >&& entries ) :
+  size_( file.size() ), modified_( file.modificationTime() ),
+  fingerprint_( fingerprint( file ) ), entries_( std::move( entries ) ) {}
+
+/**
+ *  @brief Constructor (from a binary stream)
+ *
+ *  The number of entries read from the stream is not trusted: it is verified
+ *  against the number of bytes remaining in the stream before memory is
+ *  reserved for the entries (when the length of the stream is not known,
+ *  the memory reserved up front is limited).
+ *
+ *  @param[in,out] in   the input stream
+ */
+TapeIndex( std::istream& in ) {
+
+  char buffer[ 8 ];
+  in.read( buffer, 8 );
+  if ( ( not in ) || std::memcmp( buffer, magic(), 8 ) ) {
+
+    Log::error( "The stream does not contain an ENDF tape index" );
+    throw std::exception();
+  }
+
+  std::uint32_t number = 0;
+  read( in, number );
+  if ( number != version ) {
+
+    Log::error( "Encountered an unsupported index version" );
+    Log::info( "Expected version {}, found version {}", version, number );
+    throw std::exception();
+  }
+
+  read( in, number );
+  if ( number != byteOrder() ) {
+
+    Log::error( "The index was written on a platform with a different "
+                "byte order" );
+    throw std::exception();
+  }
+
+  std::uint64_t count = 0;
+  read( in, this->size_ );
+  read( in, this->modified_ );
+  read( in, this->fingerprint_ );
+  read( in, count );
+
+  // every entry takes 4 32 bit and 5 64 bit values
+  constexpr std::uint64_t bytes = 4 * 4 + 5 * 8;
+  const auto remaining = length( in );
+  if ( remaining && ( count > *remaining / bytes ) ) {
+
+    Log::error( "Encountered a number of index entries that exceeds the "
+                "remaining length of the stream" );
+    Log::info( "Number of entries: {}", count );
+    throw std::exception();
+  }
+
+  this->entries_.reserve( remaining ? count
+                                    : std::min< std::uint64_t >( count, 4096 ) );
+  for ( std::uint64_t i = 0; i < count; ++i ) {
+
+    Entry entry;
+    read( in, entry.material );
+    read( in, entry.MAT );
+    read( in, entry.MF );
+    read( in, entry.MT );
+    read( in, entry.offset );
+    read( in, entry.length );
+    read( in, entry.line );
+    read( in, entry.NC );
+    read( in, entry.checksum );
+    this->entries_.push_back( entry );
+  }
+}
+
+/**
+ *  @brief Constructor (from an index file)
+ *
+ *  @param[in] filename   the name of the index file
+ */
+TapeIndex( const std::string& filename ) {
+
+  std::ifstream in( filename, std::ios::in | std::ios::binary );
+  if ( not in ) {
+
+    Log::error( "Could not open file \'{}\'", filename );
+    throw std::exception();
+  }
+
+  try {
+
+    *this = TapeIndex( in );
+  }
+  catch ( std::exception& e ) {
+
+    Log::info( "Trouble encountered while reading the index file \'{}\'",
+               filename );
+    throw e;
+  }
+}
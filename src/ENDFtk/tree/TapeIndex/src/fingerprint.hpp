@@ -0,0 +1,13 @@
+/**
+ *  @brief Return the hash of the first and last 4096 bytes of a file
+ *
+ *  @param[in] file   the memory mapped file
+ */
+static std::uint64_t fingerprint( const MappedFile& file ) {
+
+  const std::size_t block = 4096;
+  auto content = file.content();
+  const std::size_t size = std::min( block, content.size() );
+  const auto value = hash( content.substr( 0, size ) );
+  return hash( content.substr( content.size() - size ), value );
+}
@@ -0,0 +1,17 @@
+/**
+ *  @brief Return the 64-bit FNV-1a hash of a string
+ *
+ *  @param[in] content   the string to be hashed
+ *  @param[in] seed      the initial value of the hash (used to chain hashes)
+ */
+static std::uint64_t hash( std::string_view content,
+                           std::uint64_t seed = 14695981039346656037ull ) {
+
+  std::uint64_t value = seed;
+  for ( unsigned char c : content ) {
+
+    value ^= c;
+    value *= 1099511628211ull;
+  }
+  return value;
+}
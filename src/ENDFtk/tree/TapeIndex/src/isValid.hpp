@@ -0,0 +1,42 @@
+/**
+ *  @brief Return whether or not the index is valid for a memory mapped file
+ *
+ *  The size, modification time and the hash of the beginning and end of the
+ *  file are compared with the values stored in the index. By default, the
+ *  checksum of every section is recomputed as well (which requires reading
+ *  the entire file), since a file can be modified without changing its
+ *  size, modification time or the beginning and end of the file. Skipping
+ *  this verification is only safe when the file is known not to have been
+ *  modified in place.
+ *
+ *  @param[in] file     the memory mapped file
+ *  @param[in] verify   verify the checksum of every section (default true)
+ */
+bool isValid( const MappedFile& file, bool verify = true ) const {
+
+  if ( ( this->size() != file.size() ) ||
+       ( this->modificationTime() != file.modificationTime() ) ||
+       ( this->fingerprint() != fingerprint( file ) ) ) {
+
+    return false;
+  }
+
+  auto content = file.content();
+  for ( const auto& entry : this->entries() ) {
+
+    if ( ( entry.offset > content.size() ) ||
+         ( entry.length > content.size() - entry.offset ) ) {
+
+      return false;
+    }
+
+    if ( verify &&
+         ( hash( content.substr( entry.offset, entry.length ) ) !=
+           entry.checksum ) ) {
+
+      return false;
+    }
+  }
+
+  return true;
+}
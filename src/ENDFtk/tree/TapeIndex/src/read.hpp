@@ -0,0 +1,51 @@
+/**
+ *  @brief Read a value from a binary stream
+ *
+ *  @param[in,out] in      the input stream
+ *  @param[out]    value   the value to be read
+ */
+template< typename Type >
+static void read( std::istream& in, Type& value ) {
+
+  in.read( reinterpret_cast< char* >( &value ), sizeof( Type ) );
+  if ( not in ) {
+
+    Log::error( "Encountered the end of the stream while reading an index" );
+    throw std::exception();
+  }
+}
+
+/**
+ *  @brief Return the number of bytes remaining in a stream (if it is known)
+ *
+ *  @param[in,out] in   the input stream
+ */
+static std::optional< std::uint64_t > length( std::istream& in ) {
+
+  const auto current = in.tellg();
+  if ( current == std::istream::pos_type( -1 ) ) {
+
+    in.clear();
+    return std::nullopt;
+  }
+
+  in.seekg( 0, std::ios::end );
+  const auto end = in.tellg();
+  in.clear();
+  in.seekg( current );
+  if ( ( end == std::istream::pos_type( -1 ) ) || ( end < current ) ) {
+
+    return std::nullopt;
+  }
+  return static_cast< std::uint64_t >( end - current );
+}
+
+/**
+ *  @brief Return the magic number that starts every index
+ */
+static constexpr const char* magic() { return "ENDFtkIX"; }
+
+/**
+ *  @brief Return a value used to verify the byte order of an index
+ */
+static constexpr std::uint32_t byteOrder() { return 0x01020304u; }
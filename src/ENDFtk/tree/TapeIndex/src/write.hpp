@@ -0,0 +1,55 @@
+/**
+ *  @brief Write the index to a binary stream
+ *
+ *  @param[in,out] out   the output stream
+ */
+void write( std::ostream& out ) const {
+
+  auto put = [&out] ( const auto& value ) {
+
+    out.write( reinterpret_cast< const char* >( &value ), sizeof( value ) );
+  };
+
+  out.write( magic(), 8 );
+  put( version );
+  put( byteOrder() );
+  put( this->size_ );
+  put( this->modified_ );
+  put( this->fingerprint_ );
+  put( static_cast< std::uint64_t >( this->entries_.size() ) );
+  for ( const auto& entry : this->entries_ ) {
+
+    put( entry.material );
+    put( entry.MAT );
+    put( entry.MF );
+    put( entry.MT );
+    put( entry.offset );
+    put( entry.length );
+    put( entry.line );
+    put( entry.NC );
+    put( entry.checksum );
+  }
+
+  if ( not out ) {
+
+    Log::error( "Could not write the index to the stream" );
+    throw std::exception();
+  }
+}
+
+/**
+ *  @brief Write the index to a file
+ *
+ *  @param[in] filename   the name of the index file
+ */
+void write( const std::string& filename ) const {
+
+  std::ofstream out( filename, std::ios::out | std::ios::binary );
+  if ( not out ) {
+
+    Log::error( "Could not open file \'{}\'", filename );
+    throw std::exception();
+  }
+
+  this->write( static_cast< std::ostream& >( out ) );
+}
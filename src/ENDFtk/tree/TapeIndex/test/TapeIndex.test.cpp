@@ -0,0 +1,223 @@
+// include Catch2
+#include <catch2/catch_test_macros.hpp>
+
+// what we are testing
+#include "ENDFtk/tree/TapeIndex.hpp"
+
+// other includes
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include "ENDFtk/tree/Tape.hpp"
+#include "ENDFtk/tree/fromIndexedFile.hpp"
+
+// convenience typedefs
+using namespace njoy::ENDFtk;
+
+std::string chunk();
+std::string chunkModified();
+
+void writeFile( const std::string& filename, const std::string& content ) {
+
+  std::ofstream out( filename, std::ios::out | std::ios::binary );
+  out << content;
+}
+
+SCENARIO( "tree::TapeIndex" ) {
+
+  GIVEN( "a tape read from a memory mapped file" ) {
+
+    std::string tapeString = chunk();
+    writeFile( "index.endf", tapeString );
+
+    auto file = std::make_shared< const tree::MappedFile >( "index.endf" );
+    tree::Tape tape( file );
+
+    WHEN( "the tape is indexed" ) {
+
+      tree::TapeIndex index = tape.index( *file );
+
+      THEN( "the index contains every section" ) {
+
+        CHECK( tapeString.size() == index.size() );
+        CHECK( file->modificationTime() == index.modificationTime() );
+        CHECK( true == index.isValid( *file ) );
+        CHECK( true == index.isValid( *file, true ) );
+
+        auto entries = index.entries();
+        CHECK( 3 == entries.size() );
+
+        CHECK( 0 == entries[0].material );
+        CHECK( 125 == entries[0].MAT );
+        CHECK( 1 == entries[0].MF );
+        CHECK( 451 == entries[0].MT );
+        CHECK( 81 == entries[0].offset );
+        CHECK( 243 == entries[0].length );
+        CHECK( 1 == entries[0].line );
+        CHECK( 2 == entries[0].NC );
+
+        CHECK( 0 == entries[1].material );
+        CHECK( 125 == entries[1].MAT );
+        CHECK( 3 == entries[1].MF );
+        CHECK( 1 == entries[1].MT );
+        CHECK( 405 == entries[1].offset );
+        CHECK( 162 == entries[1].length );
+        CHECK( 5 == entries[1].line );
+        CHECK( 1 == entries[1].NC );
+
+        CHECK( 1 == entries[2].material );
+        CHECK( 128 == entries[2].MAT );
+        CHECK( 3 == entries[2].MF );
+        CHECK( 1 == entries[2].MT );
+        CHECK( 729 == entries[2].offset );
+        CHECK( 162 == entries[2].length );
+        CHECK( 9 == entries[2].line );
+        CHECK( 1 == entries[2].NC );
+      } // THEN
+
+      THEN( "the index can be written and read back" ) {
+
+        std::stringstream buffer;
+        index.write( buffer );
+        tree::TapeIndex copy( buffer );
+
+        CHECK( index.size() == copy.size() );
+        CHECK( index.modificationTime() == copy.modificationTime() );
+        CHECK( index.fingerprint() == copy.fingerprint() );
+        CHECK( index.entries().size() == copy.entries().size() );
+        CHECK( index.entries()[2].offset == copy.entries()[2].offset );
+        CHECK( index.entries()[2].checksum == copy.entries()[2].checksum );
+
+        // the number of entries follows the magic number, the version, the
+        // byte order, the size, the modification time and the fingerprint
+        std::string content = buffer.str();
+        const std::uint64_t count = std::uint64_t( 1 ) << 60;
+        std::memcpy( content.data() + 40, &count, sizeof( count ) );
+        std::stringstream corrupted( content );
+        CHECK_THROWS( tree::TapeIndex( corrupted ) );
+      } // THEN
+
+      THEN( "a tape can be created using the index" ) {
+
+        tree::Tape indexed( file, index );
+
+        CHECK( 2 == indexed.size() );
+        CHECK( true == indexed.hasMAT( 125 ) );
+        CHECK( true == indexed.hasMAT( 128 ) );
+        CHECK( true == indexed.MAT( 128 ).front().section( 3, 1 ).isMapped() );
+        CHECK( tapeString == indexed.content() );
+      } // THEN
+
+      THEN( "the index is not valid for another file" ) {
+
+        writeFile( "modified.endf", chunkModified() );
+        auto other = std::make_shared< const tree::MappedFile >( "modified.endf" );
+
+        CHECK( false == index.isValid( *other ) );
+        CHECK_THROWS( tree::Tape( other, index ) );
+      } // THEN
+    } // WHEN
+
+    WHEN( "a section was modified" ) {
+
+      tape.MAT( 125 ).front().section( 3, 1 ).clean();
+
+      THEN( "the tape cannot be indexed" ) {
+
+        CHECK_THROWS( tape.index( *file ) );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+
+  GIVEN( "a file and its index file" ) {
+
+    std::string tapeString = chunk();
+    writeFile( "indexed.endf", tapeString );
+    std::remove( "indexed.endf.idx" );
+
+    WHEN( "the tape is read for the first time" ) {
+
+      auto tape = tree::fromIndexedFile( "indexed.endf" );
+
+      THEN( "the index file is written" ) {
+
+        CHECK( tapeString == tape.content() );
+        CHECK( true == std::ifstream( "indexed.endf.idx" ).good() );
+
+        tree::TapeIndex index( "indexed.endf.idx" );
+        CHECK( 3 == index.entries().size() );
+
+        auto again = tree::fromIndexedFile( "indexed.endf" );
+        CHECK( tapeString == again.content() );
+      } // THEN
+    } // WHEN
+
+    WHEN( "the file changed after the index file was written" ) {
+
+      tree::fromIndexedFile( "indexed.endf" );
+      writeFile( "indexed.endf", chunkModified() );
+
+      auto tape = tree::fromIndexedFile( "indexed.endf" );
+
+      THEN( "the index file is ignored and replaced" ) {
+
+        CHECK( chunkModified() == tape.content() );
+
+        tree::MappedFile file( "indexed.endf" );
+        CHECK( true == tree::TapeIndex( "indexed.endf.idx" ).isValid( file ) );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+
+  GIVEN( "invalid index data" ) {
+
+    WHEN( "the stream does not contain an index" ) {
+
+      std::stringstream buffer( "this is not an index" );
+
+      THEN( "an exception is thrown" ) {
+
+        CHECK_THROWS( tree::TapeIndex( buffer ) );
+      } // THEN
+    } // WHEN
+
+    WHEN( "the index file does not exist" ) {
+
+      THEN( "an exception is thrown" ) {
+
+        CHECK_THROWS( tree::TapeIndex( std::string( "does-not-exist.idx" ) ) );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+} // SCENARIO
+
+std::string chunk() {
+
+  return
+    "this is my tape identification                                       0 0  0     \n"
+    " 1.001000+3 9.991673-1          0          0          0          1 125 1451     \n"
+    "                                3          1          1          0 125 1451     \n"
+    "                                                                   125 1  0     \n"
+    "                                                                   125 0  0     \n"
+    " 1.001000+3 9.991673-1          0          0          0          0 125 3  1     \n"
+    "                                                                   125 3  0     \n"
+    "                                                                   125 0  0     \n"
+    "                                                                     0 0  0     \n"
+    " 1.002000+3 1.996800+0          0          0          0          0 128 3  1     \n"
+    "                                                                   128 3  0     \n"
+    "                                                                   128 0  0     \n"
+    "                                                                     0 0  0     \n"
+    "                                                                    -1 0  0     \n";
+}
+
+std::string chunkModified() {
+
+  return
+    "this is my tape identification                                       0 0  0     \n"
+    " 1.002000+3 1.996800+0          0          0          0          0 128 3  1     \n"
+    "                                                                   128 3  0     \n"
+    "                                                                   128 0  0     \n"
+    "                                                                     0 0  0     \n"
+    "                                                                    -1 0  0     \n";
+}
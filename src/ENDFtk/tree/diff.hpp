@@ -0,0 +1,109 @@
+#ifndef NJOY_ENDFTK_TREE_DIFF
+#define NJOY_ENDFTK_TREE_DIFF
+
+// system includes
+#include <tuple>
+#include <vector>
+
+// other includes
+#include "ENDFtk/tree/Tape.hpp"
+#include "ENDFtk/tree/Difference.hpp"
+
+namespace njoy {
+namespace ENDFtk {
+namespace tree {
+
+  /**
+   *  @brief Compare the sections in two ENDF tapes
+   *
+   *  The sections in both tapes are matched using their MAT, MF and MT
+   *  numbers (when a tape contains a MAT number more than once, the materials
+   *  with that MAT number are matched in the order of the tape). Matched
+   *  sections are compared using their number of lines and their hash (see
+   *  Section::hash()), so sequence numbers are ignored and no section is
+   *  parsed. The cost of the comparison is proportional to the number of
+   *  sections once the hashes have been computed.
+   *
+   *  The differences are returned in MAT, MF and MT order.
+   *
+   *  @param[in] reference   the reference tape
+   *  @param[in] candidate   the candidate tape
+   */
+  inline std::vector< Difference > diff( const Tape& reference,
+                                         const Tape& candidate ) {
+
+    using Entry = std::tuple< int, std::size_t, int, int, const Section* >;
+
+    // list the sections in each tape (in MAT, MF and MT order)
+    auto collect = [] ( const Tape& tape ) {
+
+      std::vector< Entry > entries;
+      int previous = 0;
+      std::size_t occurrence = 0;
+      for ( const auto& material : tape.materials() ) {
+
+        occurrence = material.MAT() == previous ? occurrence + 1 : 0;
+        previous = material.MAT();
+        for ( const auto& file : material.files() ) {
+
+          for ( const auto& section : file.sections() ) {
+
+            entries.emplace_back( material.MAT(), occurrence,
+                                  section.MF(), section.MT(), &section );
+          }
+        }
+      }
+      return entries;
+    };
+
+    auto key = [] ( const Entry& entry ) {
+
+      return std::make_tuple( std::get< 0 >( entry ), std::get< 1 >( entry ),
+                              std::get< 2 >( entry ), std::get< 3 >( entry ) );
+    };
+
+    auto difference = [] ( const Entry& entry, Difference::Status status ) {
+
+      return Difference( std::get< 0 >( entry ), std::get< 2 >( entry ),
+                         std::get< 3 >( entry ), status );
+    };
+
+    const auto left = collect( reference );
+    const auto right = collect( candidate );
+
+    // walk through both lists at the same time
+    std::vector< Difference > differences;
+    auto lhs = left.begin();
+    auto rhs = right.begin();
+    while ( ( lhs != left.end() ) || ( rhs != right.end() ) ) {
+
+      if ( ( rhs == right.end() ) ||
+           ( ( lhs != left.end() ) && ( key( *lhs ) < key( *rhs ) ) ) ) {
+
+        differences.push_back( difference( *lhs++, Difference::Status::Removed ) );
+      }
+      else if ( ( lhs == left.end() ) || ( key( *rhs ) < key( *lhs ) ) ) {
+
+        differences.push_back( difference( *rhs++, Difference::Status::Added ) );
+      }
+      else {
+
+        const Section& first = *std::get< 4 >( *lhs );
+        const Section& second = *std::get< 4 >( *rhs );
+        if ( ( first.NC() != second.NC() ) || ( first.hash() != second.hash() ) ) {
+
+          differences.push_back( difference( *lhs, Difference::Status::Changed ) );
+        }
+        ++lhs;
+        ++rhs;
+      }
+    }
+
+    return differences;
+  }
+
+} // tree namespace
+} // ENDFtk namespace
+} // njoy namespace
+
+#endif
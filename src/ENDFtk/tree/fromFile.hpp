@@ -6,7 +6,7 @@
 #include <fstream>
 
 // other includes
-#include "tools/Log.hpp"
+#include "ENDFtk/Log.hpp"
 #include "ENDFtk/tree/Tape.hpp"
 
 namespace njoy {
@@ -17,8 +17,9 @@ namespace tree {
    *  @brief Factory function to make a tape from a file
    *
    *  @param[in] filename   the file name
+   *  @param[in] threads    the number of threads used for indexing (default 1)
    */
-  inline auto fromFile( const std::string& filename ) {
+  inline auto fromFile( const std::string& filename, unsigned int threads = 1 ) {
 
     std::string content;
     std::ifstream in( filename,
@@ -33,7 +34,7 @@ namespace tree {
     in.seekg( 0, std::ios::beg );
     content.resize( file_size / sizeof( char ) );
     in.read( &( content[ 0 ] ), file_size );
-    return njoy::ENDFtk::tree::Tape( content );
+    return njoy::ENDFtk::tree::Tape( content, 0, threads );
   }
 
 } // tree namespace
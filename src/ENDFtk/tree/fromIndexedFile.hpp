@@ -0,0 +1,80 @@
+#ifndef NJOY_ENDFTK_TREE_FROMINDEXEDFILE
+#define NJOY_ENDFTK_TREE_FROMINDEXEDFILE
+
+// system includes
+#include <fstream>
+#include <memory>
+#include <optional>
+#include <string>
+
+// other includes
+#include "ENDFtk/Log.hpp"
+#include "ENDFtk/tree/MappedFile.hpp"
+#include "ENDFtk/tree/TapeIndex.hpp"
+#include "ENDFtk/tree/Tape.hpp"
+
+namespace njoy {
+namespace ENDFtk {
+namespace tree {
+
+  /**
+   *  @brief Factory function to make a tape from a memory mapped file using
+   *         the index stored next to it
+   *
+   *  The index is read from the file with the same name and the .idx
+   *  extension appended to it (e.g. file.endf.idx). When the index is missing
+   *  or when it is no longer valid for the file (because the file's size,
+   *  modification time or content changed), the file is indexed in the usual
+   *  way and the index file is replaced if requested.
+   *
+   *  @param[in] filename   the file name
+   *  @param[in] threads    the number of threads used for indexing (default 1)
+   *  @param[in] update     write the index if it was missing or not valid
+   *                        (default true)
+   */
+  inline Tape fromIndexedFile( const std::string& filename,
+                               unsigned int threads = 1,
+                               bool update = true ) {
+
+    auto file = std::make_shared< const MappedFile >( filename );
+    const std::string indexname = filename + ".idx";
+
+    std::optional< TapeIndex > index;
+    if ( std::ifstream( indexname ).good() ) {
+
+      try {
+
+        index.emplace( indexname );
+      }
+      catch ( std::exception& ) {
+
+        Log::info( "The index file \'{}\' will be ignored", indexname );
+      }
+    }
+
+    if ( index && index->isValid( *file ) ) {
+
+      return Tape( std::move( file ), *index );
+    }
+
+    Tape tape( file, 0, threads );
+    if ( update ) {
+
+      try {
+
+        tape.index( *file ).write( indexname );
+      }
+      catch ( std::exception& ) {
+
+        Log::info( "The index file \'{}\' could not be updated", indexname );
+      }
+    }
+
+    return tape;
+  }
+
+} // tree namespace
+} // ENDFtk namespace
+} // njoy namespace
+
+#endif
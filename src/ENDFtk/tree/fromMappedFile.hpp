@@ -0,0 +1,36 @@
+#ifndef NJOY_ENDFTK_TREE_FROMMAPPEDFILE
+#define NJOY_ENDFTK_TREE_FROMMAPPEDFILE
+
+// system includes
+#include <memory>
+#include <string>
+
+// other includes
+#include "ENDFtk/tree/MappedFile.hpp"
+#include "ENDFtk/tree/Tape.hpp"
+
+namespace njoy {
+namespace ENDFtk {
+namespace tree {
+
+  /**
+   *  @brief Factory function to make a tape from a memory mapped file
+   *
+   *  Unlike fromFile(), the content of the file is not copied: the sections
+   *  of the tape refer to the memory mapped file until they are modified.
+   *
+   *  @param[in] filename   the file name
+   *  @param[in] threads    the number of threads used for indexing (default 1)
+   */
+  inline auto fromMappedFile( const std::string& filename,
+                              unsigned int threads = 1 ) {
+
+    return njoy::ENDFtk::tree::Tape(
+               std::make_shared< const MappedFile >( filename ), 0, threads );
+  }
+
+} // tree namespace
+} // ENDFtk namespace
+} // njoy namespace
+
+#endif
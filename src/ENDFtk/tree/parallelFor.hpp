@@ -0,0 +1,91 @@
+#ifndef NJOY_ENDFTK_TREE_PARALLELFOR
+#define NJOY_ENDFTK_TREE_PARALLELFOR
+
+// system includes
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// other includes
+
+namespace njoy {
+namespace ENDFtk {
+namespace tree {
+
+  /**
+   *  @brief Call a function for every index in [0, size) using a pool of
+   *         threads
+   *
+   *  The indices are handed out to the threads in increasing order and the
+   *  calling thread takes part in the work. A thread count of 0 uses all
+   *  available hardware threads.
+   *
+   *  When the function throws, indices after the index for which it threw
+   *  are no longer handed out and the exception for the lowest index is
+   *  rethrown in the calling thread once all threads are done.
+   *
+   *  @param[in] size       the number of indices
+   *  @param[in] threads    the number of threads to be used
+   *  @param[in] function   the function to be called for every index
+   */
+  template< typename Function >
+  void parallelFor( std::size_t size, unsigned int threads,
+                    const Function& function ) {
+
+    if ( threads == 0 ) {
+
+      threads = std::max( 1u, std::thread::hardware_concurrency() );
+    }
+    threads = static_cast< unsigned int >(
+                  std::min< std::size_t >( threads, size ) );
+
+    std::atomic< std::size_t > next( 0 );
+    std::atomic< std::size_t > failure( size );
+    std::exception_ptr error;
+    std::mutex mutex;
+    auto work = [&] () {
+
+      for ( auto index = next++; index < failure; index = next++ ) {
+
+        try {
+
+          function( index );
+        }
+        catch ( ... ) {
+
+          std::lock_guard< std::mutex > lock( mutex );
+          if ( index < failure ) {
+
+            failure = index;
+            error = std::current_exception();
+          }
+        }
+      }
+    };
+
+    std::vector< std::thread > pool;
+    for ( unsigned int i = 1; i < threads; ++i ) {
+
+      pool.emplace_back( work );
+    }
+    work();
+    for ( auto& thread : pool ) {
+
+      thread.join();
+    }
+
+    if ( error ) {
+
+      std::rethrow_exception( error );
+    }
+  }
+
+} // tree namespace
+} // ENDFtk namespace
+} // njoy namespace
+
+#endif
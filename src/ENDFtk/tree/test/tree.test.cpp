@@ -3,8 +3,12 @@
 
 // what we are testing
 #include "ENDFtk/tree/updateDirectory.hpp"
+#include "ENDFtk/tree/diff.hpp"
+#include "ENDFtk/tree/parallelFor.hpp"
 
 // other includes
+#include <atomic>
+#include <stdexcept>
 
 // convenience typedefs
 using namespace njoy::ENDFtk;
@@ -26,12 +30,16 @@ SCENARIO( "Update index" ) {
 
     HeadRecord head( position, end, lineNumber );
     tree::Material material( head, start, position, end, lineNumber );
+    const char* data = material.file( 1 ).section( 451 ).content().data();
 
     njoy::ENDFtk::tree::updateDirectory( material );
 
     THEN( "the index is not changed" ) {
 
       CHECK( correct == material.content() );
+
+      // the MF1 MT451 section was not replaced
+      CHECK( data == material.file( 1 ).section( 451 ).content().data() );
     } // GIVEN
   } // GIVEN
 
@@ -53,6 +61,103 @@ SCENARIO( "Update index" ) {
       CHECK( correct == material.content() );
     } // GIVEN
   } // GIVEN
+
+  GIVEN( "a material with sequence numbers in MF1 MT451" ) {
+
+    // number the HEAD, CONT and description lines
+    std::string numbered = chunkWithIncorrectIndex();
+    for ( int line = 0; line < 12; ++line ) {
+
+      numbered.replace( 81 * line + 75, 5, std::to_string( 10000 + line ) );
+    }
+    auto position = numbered.begin();
+    auto start = numbered.begin();
+    auto end = numbered.end();
+    long lineNumber = 0;
+
+    HeadRecord head( position, end, lineNumber );
+    tree::Material material( head, start, position, end, lineNumber );
+
+    njoy::ENDFtk::tree::updateDirectory( material );
+
+    THEN( "the copied lines have blank sequence numbers" ) {
+
+      CHECK( correct == material.content() );
+    } // THEN
+  } // GIVEN
+
+  GIVEN( "a material with a non canonical fourth line in MF1 MT451" ) {
+
+    // the C1 and C2 values on the fourth line are not written as ENDFtk would
+    std::string incorrect = chunkWithIncorrectIndex();
+    incorrect.replace( 3 * 81, 22, " 0.0        0.0       " );
+    std::string expected = correct;
+    expected.replace( 3 * 81, 22, " 0.0        0.0       " );
+    auto position = incorrect.begin();
+    auto start = incorrect.begin();
+    auto end = incorrect.end();
+    long lineNumber = 0;
+
+    HeadRecord head( position, end, lineNumber );
+    tree::Material material( head, start, position, end, lineNumber );
+
+    njoy::ENDFtk::tree::updateDirectory( material );
+
+    THEN( "only the NXC value on the fourth line is changed" ) {
+
+      CHECK( expected == material.content() );
+    } // THEN
+  } // GIVEN
+
+  GIVEN( "a tape with two materials with an incorrect index" ) {
+
+    std::string tpid =
+      "this is my tape identification                                       0 0  0     \n";
+    std::string second = chunkWithIncorrectIndex();
+    for ( auto mat = second.find( " 125 " ); mat != std::string::npos;
+          mat = second.find( " 125 ", mat + 5 ) ) {
+
+      second.replace( mat, 5, " 126 " );
+    }
+    std::string expected = correct;
+    for ( auto mat = expected.find( " 125 " ); mat != std::string::npos;
+          mat = expected.find( " 125 ", mat + 5 ) ) {
+
+      expected.replace( mat, 5, " 126 " );
+    }
+    tree::Tape tape( tpid + chunkWithIncorrectIndex() + second );
+
+    njoy::ENDFtk::tree::updateDirectory( tape, false, 2 );
+
+    THEN( "the index of every material is changed" ) {
+
+      CHECK( correct == tape.MAT( 125 ).front().content() );
+      CHECK( expected == tape.MAT( 126 ).front().content() );
+    } // THEN
+  } // GIVEN
+
+  GIVEN( "a material that is not in the ENDF-6 format" ) {
+
+    // NFOR = 5 on the second line of MF1 MT451
+    std::string incorrect = chunkWithIncorrectIndex();
+    incorrect[ 81 + 65 ] = '5';
+    std::string expected = correct;
+    expected[ 81 + 65 ] = '5';
+    auto position = incorrect.begin();
+    auto start = incorrect.begin();
+    auto end = incorrect.end();
+    long lineNumber = 0;
+
+    HeadRecord head( position, end, lineNumber );
+    tree::Material material( head, start, position, end, lineNumber );
+
+    njoy::ENDFtk::tree::updateDirectory( material );
+
+    THEN( "the section is parsed and the index is changed" ) {
+
+      CHECK( expected == material.content() );
+    } // THEN
+  } // GIVEN
 } // SCENARIO
 
 SCENARIO( "Update index while preserving mod numbers" ) {
@@ -97,6 +202,175 @@ SCENARIO( "Update index while preserving mod numbers" ) {
   } // GIVEN
 } // SCENARIO
 
+SCENARIO( "Compare tapes" ) {
+
+  std::string tpid =
+    "this is my tape identification                                       0 0  0     \n";
+
+  GIVEN( "two tapes with the same content" ) {
+
+    tree::Tape reference( tpid + chunkWithCorrectIndex() );
+    tree::Tape candidate( tpid + chunkWithCorrectIndex() );
+
+    WHEN( "the tapes are compared" ) {
+
+      auto differences = tree::diff( reference, candidate );
+
+      THEN( "there are no differences" ) {
+
+        CHECK( 0 == differences.size() );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+
+  GIVEN( "two tapes with a different content" ) {
+
+    tree::Tape reference( tpid + chunkWithCorrectIndex() );
+    tree::Tape candidate( tpid + chunkWithIncorrectIndex() );
+
+    auto& material = candidate.MAT( 125 ).front();
+    material.remove( 1, 452 );
+    material.insert( tree::Section(
+      125, 3, 102,
+      " 1.001000+3 9.991673-1          0          0          0          0 125 3102     \n"
+      " 2.224631+6 2.224631+6          0          0          1          2 125 3102     \n"
+      "          2          2                                             125 3102     \n"
+      " 1.000000-5 1.000000+0 2.000000+7 2.000000+0                       125 3102     \n"
+      "                                                                   125 3  0     \n" ) );
+
+    WHEN( "the tapes are compared" ) {
+
+      auto differences = tree::diff( reference, candidate );
+
+      THEN( "the added, removed and changed sections are reported" ) {
+
+        using Status = tree::Difference::Status;
+
+        CHECK( 3 == differences.size() );
+        CHECK( tree::Difference( 125, 1, 451, Status::Changed ) == differences[0] );
+        CHECK( tree::Difference( 125, 1, 452, Status::Removed ) == differences[1] );
+        CHECK( tree::Difference( 125, 3, 102, Status::Added ) == differences[2] );
+
+        CHECK( true == differences[0].isChanged() );
+        CHECK( true == differences[1].isRemoved() );
+        CHECK( true == differences[2].isAdded() );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+} // SCENARIO
+
+SCENARIO( "Parse without exceptions" ) {
+
+  std::string tpid =
+    "this is my tape identification                                       0 0  0     \n";
+  std::string material =
+    " 1.001000+3 9.991673-1          0          0          0          0 125 3  1     \n"
+    " 1.123400+6 1.123400+6          0          0          1          2 125 3  1     \n"
+    "          2          2                                             125 3  1     \n"
+    " 1.000000-5 1.000000+0 2.000000+7 2.000000+0                       125 3  1     \n"
+    "                                                                   125 3  0     \n"
+    " 1.001000+3 9.991673-1          0          0          0          0 125 3  5     \n"
+    " 1.123400+6 1.123400+6          0          0          1          2 125 3  5     \n"
+    "          2          2                                             125 3  5     \n"
+    " 1.000000-5 1.000000+0 2.000000+7 2.000000+0                       125 3  5     \n"
+    "                                                                   125 3  0     \n"
+    "                                                                   125 0  0     \n"
+    "                                                                     0 0  0     \n";
+
+  GIVEN( "a valid tape" ) {
+
+    tree::Tape tape( tpid + material );
+
+    WHEN( "the tape is parsed without throwing exceptions" ) {
+
+      auto result = tape.tryParse();
+
+      THEN( "the parsed tape is returned" ) {
+
+        CHECK( true == result.hasValue() );
+        CHECK( true == result.value().hasMAT( 125 ) );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+
+  GIVEN( "tapes with errors" ) {
+
+    // line 2 of MF3 MT1 has an MT number of 2
+    std::string wrongMT = material;
+    wrongMT.replace( 81 + 66, 9, " 125 3  2" );
+
+    // line 4 of MF3 MT5 has a field that cannot be read
+    std::string wrongField = material;
+    wrongField.replace( 8 * 81, 11, " 1.0000x0-5" );
+
+    tree::Tape first( tpid + wrongMT );
+    tree::Tape second( tpid + wrongField );
+
+    WHEN( "the tapes are parsed without throwing exceptions" ) {
+
+      auto structure = first.tryParse();
+      auto field = second.materials().front().tryParse();
+
+      THEN( "the errors identify the section and line" ) {
+
+        CHECK( false == structure.hasValue() );
+        CHECK( 125 == structure.error().mat );
+        CHECK( 3 == structure.error().mf );
+        CHECK( 1 == structure.error().mt );
+        CHECK( 2 == structure.error().line );
+        CHECK( "" == structure.error().record );
+        CHECK( "MT" == structure.error().field );
+
+        CHECK( false == field.hasValue() );
+        CHECK( 125 == field.error().mat );
+        CHECK( 3 == field.error().mf );
+        CHECK( 5 == field.error().mt );
+        CHECK( 4 == field.error().line );
+        CHECK( "TAB1" == field.error().record );
+        CHECK( "field 1" == field.error().field );
+      } // THEN
+    } // WHEN
+  } // GIVEN
+} // SCENARIO
+
+SCENARIO( "Parallel for" ) {
+
+  GIVEN( "a function that throws for some indices" ) {
+
+    std::atomic< std::size_t > calls( 0 );
+    auto function = [&] ( std::size_t index ) {
+
+      ++calls;
+      if ( index == 3 || index == 7 ) {
+
+        throw std::runtime_error( std::to_string( index ) );
+      }
+    };
+
+    WHEN( "it is called using multiple threads" ) {
+
+      THEN( "the exception for the lowest index is rethrown" ) {
+
+        for ( unsigned int threads : { 1u, 4u } ) {
+
+          calls = 0;
+          std::string what;
+          try {
+
+            tree::parallelFor( 100, threads, function );
+          }
+          catch ( std::runtime_error& error ) {
+
+            what = error.what();
+          }
+          CHECK( "3" == what );
+          CHECK( calls < 100 );
+        }
+      } // THEN
+    } // WHEN
+  } // GIVEN
+} // SCENARIO
+
 std::string chunkWithCorrectIndex() {
 
   // yes, I know H1 cannot have a nubar but I needed to add another MF1 section
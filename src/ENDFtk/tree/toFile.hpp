@@ -4,6 +4,7 @@
 // system includes
 
 // other includes
+#include "ENDFtk/toString.hpp"
 #include "ENDFtk/file/Type.hpp"
 #include "ENDFtk/tree/File.hpp"
 
@@ -20,9 +21,7 @@ namespace tree {
   template< int MF >
   File toFile( const file::Type< MF  >& file, int mat ) {
 
-    std::string buffer;
-    auto output = std::back_inserter( buffer );
-    file.print( output, mat );
+    std::string buffer = toString( printedLines( file ), file, mat );
 
     auto position = buffer.begin();
     auto start = buffer.begin();
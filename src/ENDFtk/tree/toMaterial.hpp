@@ -5,6 +5,7 @@
 
 // other includes
 #include "ENDFtk/Material.hpp"
+#include "ENDFtk/toString.hpp"
 #include "ENDFtk/tree/Material.hpp"
 
 namespace njoy {
@@ -19,9 +20,7 @@ namespace tree {
    */
   inline Material toMaterial( const njoy::ENDFtk::Material& material ) {
 
-    std::string buffer;
-    auto output = std::back_inserter( buffer );
-    material.print( output );
+    std::string buffer = toString( printedLines( material ), material );
 
     auto position = buffer.begin();
     auto start = buffer.begin();
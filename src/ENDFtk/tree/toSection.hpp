@@ -4,6 +4,7 @@
 // system includes
 
 // other includes
+#include "ENDFtk/toString.hpp"
 #include "ENDFtk/tree/Section.hpp"
 
 namespace njoy {
@@ -19,11 +20,8 @@ namespace tree {
   Section toSection( const section::Type< MF, OptionalMT... >& section,
                      int mat ) {
 
-    std::string buffer;
-    auto output = std::back_inserter( buffer );
-    section.print( output, mat, MF );
-
-    return Section( mat, MF, section.MT(), std::move( buffer ) );
+    return Section( mat, MF, section.MT(),
+                    toString( printedLines( section ), section, mat, MF ) );
   }
 
 } // tree namespace
@@ -2,46 +2,35 @@
 #define NJOY_ENDFTK_TREE_UPDATEDIRECTORY
 
 // system includes
+#include <algorithm>
+#include <string>
+#include <vector>
 
 // other includes
 #include "ENDFtk/tree/Tape.hpp"
 #include "ENDFtk/tree/Material.hpp"
+#include "ENDFtk/tree/parallelFor.hpp"
 
 namespace njoy {
 namespace ENDFtk {
 namespace tree {
 
   /**
-   *  @brief Update the MF1 MT451 directory for the given material
+   *  @brief Create the MF1 MT451 directory for the given material
    *
-   *  An exception will be thrown if the MF1 MT451 section is not present, or if
-   *  there was an issue parsing it.
+   *  The MOD numbers are retrieved from the old directory when copyMod is
+   *  true (for efficiency, the old directory is assumed to be ordered).
    *
-   *  @param[in,out] material   the ENDF material to update
-   *  @param[in]     copyMod    copy the modification number if available
+   *  @param[in] material   the ENDF material
+   *  @param[in] oldindex   the old directory
+   *  @param[in] nwd        the number of lines in the description
+   *  @param[in] copyMod    copy the modification number if available
    */
-  inline void updateDirectory( Material& material, bool copyMod = false ) {
-
-    // verify if MF1 MT451 is present
-    if ( !material.hasMF( 1 ) ) {
-
-      Log::error( "Cannot update the directory because MF1 is absent." );
-      throw std::exception();
-    }
-    else {
-
-      if ( !material.file( 1 ).hasMT( 451 ) ) {
-
-        Log::error( "Cannot update the directory because MF1 MT451 is absent." );
-        throw std::exception();
-      }
-    }
-
-    // parse MF1 MT451 and retrieve the old index
-    auto old = material.file( 1 ).section( 451 ).parse< 1, 451 >();
-    decltype(auto) oldindex = old.index();
+  template < typename Index >
+  std::vector< DirectoryRecord >
+  createDirectory( const Material& material, const Index& oldindex,
+                   long nwd, bool copyMod ) {
 
-    // create the new index
     std::vector< DirectoryRecord > index;
     for ( const auto& file : material.files() ) {
 
@@ -53,7 +42,6 @@ namespace tree {
         long mt = section.MT();
 
         // set the MOD number (if copyMod is true, retrieve the original MOD)
-        // for efficiency, we assume the index to be ordered
         long mod = 0;
         if ( copyMod ) {
 
@@ -74,36 +62,181 @@ namespace tree {
     }
 
     // replace the index for MF1 MT451
-    index[0] = DirectoryRecord( 1, 451, 4 + old.NWD() + index.size(), index[0].MOD() );
-
-    // create a new MF1 MT451 section using the new index
-    section::Type< 1, 451 > updated(
-          old.ZA(), old.AWR(), old.LRP(), old.LFI(), old.NLIB(), old.NMOD(),
-          old.ELIS(), old.STA(), old.LIS(), old.LISO(), old.NFOR(),
-          old.AWI(), old.EMAX(), old.LREL(), old.NSUB(), old.NVER(),
-          old.TEMP(), old.LDRV(),
-          ranges::to< std::string >( old.description() ),
-          std::move( index ), old.RTOL() );
-
-    // replace the section in the material
-    material.insertOrReplace( updated );
+    index[0] = DirectoryRecord( 1, 451, 4 + nwd + index.size(),
+                                index[0].MOD() );
+    return index;
+  }
+
+  /**
+   *  @brief Update the MF1 MT451 directory for the given material
+   *
+   *  For the ENDF-6 format (NFOR = 6), only the records of MF1 MT451
+   *  preceding the description are decoded, the records preceding the
+   *  directory are copied (only the NXC value on the fourth line is replaced)
+   *  and the number of lines in each section is taken from the tree. The
+   *  copied lines are given the same blank sequence numbers as the directory
+   *  lines. Any other format is handled by parsing MF1 MT451 and creating a
+   *  new section. The MF1 MT451 section is only replaced when it was changed.
+   *
+   *  An exception will be thrown if the MF1 MT451 section is not present, or if
+   *  there was an issue parsing it.
+   *
+   *  @param[in,out] material   the ENDF material to update
+   *  @param[in]     copyMod    copy the modification number if available
+   */
+  inline void updateDirectory( Material& material, bool copyMod = false ) {
+
+    // verify if MF1 MT451 is present
+    if ( !material.hasMF( 1 ) ) {
+
+      Log::error( "Cannot update the directory because MF1 is absent." );
+      throw std::exception();
+    }
+    else {
+
+      if ( !material.file( 1 ).hasMT( 451 ) ) {
+
+        Log::error( "Cannot update the directory because MF1 MT451 is absent." );
+        throw std::exception();
+      }
+    }
+
+    const int mat = material.MAT();
+    const auto content = material.file( 1 ).section( 451 ).view();
+    auto position = content.begin();
+    auto end = content.end();
+    long lineNumber = 0;
+
+    auto next = [&] () {
+
+      if ( record::scan( position, end, lineNumber ).MT() != 451 ) {
+
+        Log::error( "Cannot update the directory because MF1 MT451 is "
+                    "incomplete." );
+        throw std::exception();
+      }
+    };
+
+    // the layout of MF1 MT451 is only known for the ENDF-6 format (NFOR is
+    // given on the second line)
+    next();
+    if ( ControlRecord( position, end, lineNumber, mat, 1, 451 ).N2() != 6 ) {
+
+      // parse MF1 MT451 and create a new section using the new index
+      auto old = material.file( 1 ).section( 451 ).parse< 1, 451 >();
+      auto index = createDirectory( material, old.index(), old.NWD(), copyMod );
+      section::Type< 1, 451 > updated(
+            old.ZA(), old.AWR(), old.LRP(), old.LFI(), old.NLIB(), old.NMOD(),
+            old.ELIS(), old.STA(), old.LIS(), old.LISO(), old.NFOR(),
+            old.AWI(), old.EMAX(), old.LREL(), old.NSUB(), old.NVER(),
+            old.TEMP(), old.LDRV(),
+            ranges::to< std::string >( old.description() ),
+            std::move( index ), old.RTOL() );
+
+      auto section = toSection( updated, mat );
+      if ( section.view() != content ) {
+
+        material.insertOrReplace( std::move( section ) );
+      }
+      return;
+    }
+
+    // locate the records in MF1 MT451 without parsing the description
+    next();
+    const auto cont = position;
+    ControlRecord parameters( position, end, lineNumber, mat, 1, 451 );
+    const auto description = position;
+    for ( long i = 0; i < parameters.N1(); ++i ) {
+
+      next();
+    }
+    const auto directory = position;
+
+    // retrieve the old index (only needed for the MOD numbers)
+    std::vector< DirectoryRecord > oldindex;
+    if ( copyMod ) {
+
+      oldindex.reserve( parameters.N2() );
+      for ( long i = 0; i < parameters.N2(); ++i ) {
+
+        oldindex.emplace_back( position, end, lineNumber, mat, 1, 451 );
+      }
+    }
+
+    auto index = createDirectory( material, oldindex, parameters.N1(), copyMod );
+
+    // copy the given number of columns of a line (padded with blanks)
+    char tail[ 15 ];
+    record::Tail( mat, 1, 451 ).format( tail );
+    std::string buffer;
+    buffer.reserve( content.size() + 81 * index.size() );
+    auto columns = [&] ( auto first, auto last, long width ) {
+
+      auto eol = std::find( first, last, '\n' );
+      const long length = std::min( std::distance( first, eol ), width );
+      buffer.append( first, first + length );
+      buffer.append( width - length, ' ' );
+      return eol == last ? last : std::next( eol );
+    };
+
+    // copy lines with the first 66 columns unchanged and a normalised tail
+    auto copy = [&] ( auto first, auto last ) {
+
+      while ( first != last ) {
+
+        first = columns( first, last, 66 );
+        buffer.append( tail, tail + 15 );
+      }
+    };
+
+    // create the new MF1 MT451 section: the HEAD record, the three CONT
+    // records (with the new NXC value) and the description are copied
+    auto output = std::back_inserter( buffer );
+    copy( content.begin(), cont );
+    columns( cont, description, 55 );
+    disco::Integer< 11 >::write( static_cast< long >( index.size() ), output );
+    buffer.append( tail, tail + 15 );
+    copy( description, directory );
+    for ( const auto& entry : index ) {
+
+      entry.print( output, mat, 1, 451 );
+    }
+    SEND( mat, 1 ).print( output );
+
+    // replace the section in the material (only when it was changed)
+    if ( buffer != content ) {
+
+      material.insertOrReplace( Section( mat, 1, 451, std::move( buffer ) ) );
+    }
   }
 
   /**
    *  @brief Update the MF1 MT451 directory for all materials in the tape
    *
+   *  The directories of the materials are independent, so the materials are
+   *  updated concurrently when more than one thread is requested (a thread
+   *  count of 0 uses all available hardware threads).
+   *
    *  An exception will be thrown if a material in the tape has no MF1 MT451
-   *  section is not present, or if there was an issue parsing it.
+   *  section, or if there was an issue parsing it (the error for the first
+   *  such material is rethrown once all threads are done).
    *
    *  @param[in,out] tape       the ENDF tape to update
    *  @param[in]     copyMod    copy the modification number if available
+   *  @param[in]     threads    the number of threads to be used
    */
-  inline void updateDirectory( Tape& tape, bool copyMod = false ) {
+  inline void updateDirectory( Tape& tape, bool copyMod = false,
+                               unsigned int threads = 1 ) {
 
+    std::vector< Material* > materials;
     for ( auto& material : tape.materials() ) {
 
-      updateDirectory( material, copyMod );
+      materials.push_back( &material );
     }
+
+    parallelFor( materials.size(), threads,
+                 [&] ( std::size_t index )
+                     { updateDirectory( *materials[ index ], copyMod ); } );
   }
 
 } // tree namespace